@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AppMessages.hpp
+ * @ingroup app
+ * @class AppMessages
+ * @brief Typed messages of the application and the schema benchmark
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_APPMESSAGES_HPP
+#define AGENT_TEAM_TEST_APP_APPMESSAGES_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+#include "app/MessageSchema.hpp"
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Periodic sensor sample (26 bytes on the wire)
+ */
+struct Telemetry
+{
+    uint32_t sequence;
+    int16_t temperature;            /**< 0.01 degC */
+    std::array<float, 3> position;
+    uint64_t timestamp_ns;
+
+    using Fields = MessageFields<&Telemetry::sequence, &Telemetry::temperature,
+                                 &Telemetry::position, &Telemetry::timestamp_ns>;
+    static constexpr std::string_view MESSAGE_NAME = "Telemetry";
+    static constexpr uint8_t MESSAGE_VERSION = 1U;
+};
+
+/**
+ * @brief Request to a peer (6 bytes on the wire)
+ */
+struct Command
+{
+    uint16_t opcode;
+    uint32_t argument;
+
+    using Fields = MessageFields<&Command::opcode, &Command::argument>;
+    static constexpr std::string_view MESSAGE_NAME = "Command";
+    static constexpr uint8_t MESSAGE_VERSION = 1U;
+};
+
+/* Wire layout is part of the protocol: a change here must bump MESSAGE_VERSION */
+static_assert(MessageSchema<Telemetry>::WIRE_SIZE == 26U, "Telemetry wire layout changed");
+static_assert(MessageSchema<Command>::WIRE_SIZE == 6U, "Command wire layout changed");
+static_assert(MessageSchema<Telemetry>::TYPE_ID != MESSAGE_TYPE_NONE, "Telemetry needs a type id");
+static_assert(MessageSchema<Command>::TYPE_ID != MESSAGE_TYPE_NONE, "Command needs a type id");
+static_assert(messageTypesUnique<Telemetry, Command>(), "Message type ids collide");
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Checks of the application message schemas
+ */
+class AppMessages
+{
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    /**
+     * @brief Typed encode/decode against hand-packed fields (--schema-bench)
+     *
+     * @return true if every message survived both round trips
+     */
+    static bool benchmark(std::ostream& out);
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_APPMESSAGES_HPP
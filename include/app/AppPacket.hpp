@@ -17,15 +17,29 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <array>
 #include <cstdint>
 #include <cstddef>
-#include <chrono>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <sys/uio.h>
+
+#include "app/Crc32.hpp"
+#include "app/MessageSchema.hpp"
 
 
 /*******************************************************************************
  * Macro
  ******************************************************************************/
-static constexpr size_t   APP_PACKET_MAX_DATA_SIZE         = 256U;
+static constexpr size_t   APP_PACKET_MAX_DATA_SIZE         = 1456U;  /**< 1500 MTU - IPv4 20 - UDP 8 - header 12 - footer 4 */
+static constexpr uint8_t  APP_PACKET_VERSION               = 2U;     /**< Wire format version (2: version/flags header) */
+static constexpr uint8_t  APP_PACKET_FLAG_CRC32C           = 0x01U;  /**< Footer is CRC-32C, else CRC-32 (IEEE) */
+static constexpr uint8_t  APP_PACKET_FLAG_CRC32C_CAPABLE   = 0x02U;  /**< Sender can verify CRC-32C */
+static constexpr uint8_t  APP_PACKET_FLAG_FRAGMENT         = 0x04U;  /**< Payload is a FragmentHeader + message slice */
+static constexpr uint8_t  APP_PACKET_FLAG_FEC_PARITY       = 0x08U;  /**< Payload is a FecHeader + parity of earlier packets */
+static constexpr size_t   APP_PACKET_MAX_PAYLOAD_PIECES    = 2U;     /**< Payload iovecs per encodeGather() */
+static constexpr size_t   APP_PACKET_MAX_BATCH             = 64U;    /**< Frames per encodeBatch()/decodeBatch() call */
 static constexpr uint32_t APP_PACKET_COMM_TIMEOUT_MS       = 1000U;  /**< Default communication timeout (ms) */
 static constexpr uint32_t APP_PACKET_EXPECTED_INTERVAL_MS  = 100U;   /**< Default expected receive interval (ms) */
 static constexpr uint32_t APP_PACKET_INTERVAL_TOLERANCE_US = 5000U;  /**< Default tolerance (us) */
@@ -43,6 +57,9 @@ struct AppPacketHeader
     uint32_t unique_id;     /**< Unique packet identifier */
     uint16_t lifesign;      /**< Lifesign counter */
     uint16_t data_length;   /**< Length of payload data */
+    uint8_t  version;       /**< APP_PACKET_VERSION */
+    uint8_t  flags;         /**< APP_PACKET_FLAG_* */
+    uint16_t message_type;  /**< MessageSchema<T>::TYPE_ID, MESSAGE_TYPE_NONE if untyped */
 };
 
 /**
@@ -54,9 +71,60 @@ struct AppPacketFooter
 };
 
 
+/**
+ * @brief Encoded packet as scatter-gather pieces: header, payload, footer
+ *
+ * Header and footer live here, the payload iovecs point at the caller's
+ * data, so nothing is copied to encode. iov points into this object:
+ * do not copy or move it between encodeGather() and the send/push.
+ */
+struct AppPacketGather
+{
+    AppPacketHeader header;
+    AppPacketFooter footer;
+    struct iovec iov[APP_PACKET_MAX_PAYLOAD_PIECES + 2U];  /**< header, payload piece(s), footer */
+    size_t iovcnt;          /**< Used entries of iov */
+    size_t length;          /**< Total packet length in bytes */
+};
+
+/**
+ * @brief Buffer that holds exactly one encoded packet of a typed message
+ */
+template <SchemaMessage Message>
+using AppPacketMessageBuffer =
+    std::array<uint8_t, sizeof(AppPacketHeader) + MessageSchema<Message>::WIRE_SIZE + sizeof(AppPacketFooter)>;
+
+/**
+ * @brief Read-only bytes of one frame: a payload to encode or a received packet
+ */
+struct AppPacketFrame
+{
+    const uint8_t* data;    /**< Frame bytes (not copied) */
+    size_t length;          /**< Frame length in bytes */
+};
+
+/**
+ * @brief Output buffer of one encoded packet
+ */
+struct AppPacketSlot
+{
+    uint8_t* buffer;        /**< Destination */
+    size_t size;            /**< Capacity in bytes */
+    size_t length;          /**< Bytes written by encodeBatch() */
+};
+
+
 /*******************************************************************************
  * Class Declaration
  ******************************************************************************/
+/**
+ * @brief Packet codec: encodes the TX stream, decodes into its RX fields
+ *
+ * decode() keeps the fields of the last packet for the getters, so one
+ * AppPacket must not be shared between threads. For stateless decoding use
+ * AppPacketView (one packet) or decodeBatch(); lifesign and stability
+ * monitoring live in PeerMonitor.
+ */
 class AppPacket
 {
 /***********************************************************
@@ -71,8 +139,31 @@ public:
         BufferTooSmall,
         InvalidPacket,
         CrcMismatch,
-        UnstableCommunication,
-        LossOfCommunication
+        UnstableCommunication,  /**< PeerMonitor: PeerState::Unstable */
+        LossOfCommunication,    /**< PeerMonitor: PeerState::Lost */
+        UnsupportedVersion
+    };
+
+    /**
+     * @brief Per-frame results of decodeBatch(), one array per field
+     *
+     * Structure of arrays so a consumer scanning one field (all lifesigns,
+     * all statuses) walks contiguous memory. data is nullptr unless the
+     * status is None; the header fields are filled whenever the header
+     * itself was readable.
+     */
+    struct BatchSummary
+    {
+        size_t count;                                       /**< Frames described */
+        size_t valid;                                       /**< Frames with status None */
+        size_t interleaved;                                 /**< Frames whose CRC ran in a multi-lane group */
+        uint32_t unique_id[APP_PACKET_MAX_BATCH];
+        uint16_t lifesign[APP_PACKET_MAX_BATCH];
+        uint16_t data_length[APP_PACKET_MAX_BATCH];
+        const uint8_t* data[APP_PACKET_MAX_BATCH];          /**< Payload inside the frame (not copied) */
+        CrcAlgorithm crc_algorithm[APP_PACKET_MAX_BATCH];
+        uint8_t flags[APP_PACKET_MAX_BATCH];
+        AppPacketError status[APP_PACKET_MAX_BATCH];
     };
 
 /***********************************************************
@@ -89,36 +180,38 @@ public:
     /* Transmit packet management */
     void setUniqueId(uint32_t id);
     void setDataPointer(const uint8_t* data, size_t length);
+    void setCrcAlgorithm(CrcAlgorithm algorithm);  /**< Footer CRC of encoded packets */
     size_t encode(uint8_t* buffer, size_t buffer_size);
+    size_t encodeGather(AppPacketGather& gather);
+    size_t encodeGather(AppPacketGather& gather, const struct iovec* payload, size_t pieces, uint8_t flags = 0U);
+    size_t encodeBatch(std::span<const AppPacketFrame> payloads, std::span<AppPacketSlot> slots);
+
+    template <SchemaMessage Message>
+    size_t encodeMessage(const Message& message, AppPacketMessageBuffer<Message>& buffer);
 
     /* Receive packet management */
     bool decode(const uint8_t* buffer, size_t buffer_size);
-    void updateReceivedLifesign(uint16_t lifesign);
-    bool isCommLost(void) const;
-    bool isCommUnstable(void) const;
-    void setCommTimeout(uint32_t timeout_ms);
-    void setExpectedInterval(uint32_t interval_ms, uint32_t tolerance_us);
-    void resetCommMonitor(void);
-    uint32_t getTimeSinceLastChange(void) const;
-    uint32_t getLastIntervalUs(void) const;
+    static size_t decodeBatch(std::span<const AppPacketFrame> frames, AppPacket::BatchSummary& summary);
 
     uint32_t getUniqueId(void) const;
     uint16_t getLifesign(void) const;           /**< Get TX lifesign */
     uint16_t getReceivedLifesign(void) const;   /**< Get last RX lifesign */
-    uint32_t getCommTimeout(void) const;         /**< Get configured timeout (ms) */
-    uint32_t getExpectedIntervalMs(void) const;  /**< Get expected interval (ms) */
-    uint32_t getIntervalToleranceUs(void) const; /**< Get tolerance (us) */
-    uint16_t getUnstableCounter(void) const;     /**< Get consecutive unstable count */
     const uint8_t* getData(void) const;
     size_t getDataLength(void) const;
     uint32_t getCrc32(void) const;
+    CrcAlgorithm getCrcAlgorithm(void) const;   /**< TX: configured, RX: of the last packet */
+    bool isPeerCrc32cCapable(void) const;       /**< Last packet advertised CRC-32C support */
     AppPacket::AppPacketError getError(void) const;
 
-/***********************************************************
- * Helper Method
- **********************************************************/
+    /**
+     * @brief Per-packet encode()/AppPacketView against encodeBatch()/decodeBatch() (--crc-bench)
+     *
+     * @return false if a batch result differs from the per-packet one
+     */
+    static bool benchmark(std::ostream& out);
+
 private:
-    static uint32_t calculateCrc32(const uint8_t* data, size_t length);
+    AppPacketHeader buildHeader(size_t data_length, uint8_t flags, uint16_t message_type) const;
 
 /***********************************************************
  * Data
@@ -130,23 +223,56 @@ private:
     const uint8_t* m_data_ptr;
     size_t m_data_length;
     uint32_t m_crc32;
-
-    /* RX lifesign monitoring */
-    uint16_t m_rx_lifesign;         /**< Last received lifesign */
-    uint16_t m_rx_lifesign_prev;    /**< Previous received lifesign */
-    std::chrono::steady_clock::time_point m_last_change_time;  /**< Time of last lifesign change */
-    std::chrono::steady_clock::time_point m_last_recv_time;    /**< Time of last packet receive */
-    uint32_t m_comm_timeout_ms;     /**< Timeout to declare loss of communication (ms) */
-
-    /* Stability monitoring */
-    uint32_t m_expected_interval_ms;  /**< Expected receive interval (ms) */
-    uint32_t m_tolerance_us;          /**< Allowed tolerance (us) */
-    uint32_t m_last_interval_us;      /**< Last measured interval (us) */
-    uint16_t m_unstable_counter;      /**< Consecutive out-of-tolerance count */
-    bool     m_comm_unstable;         /**< Current stability status */
+    CrcAlgorithm m_crc_algorithm;   /**< TX: footer CRC to use, RX: footer CRC of last packet */
+    uint8_t m_rx_flags;             /**< Header flags of the last received packet */
+    uint16_t m_rx_lifesign;         /**< Lifesign of the last received packet */
 
     AppPacket::AppPacketError m_error;
 };
 
 
+/*******************************************************************************
+ * Template Definition
+ ******************************************************************************/
+
+/**
+ * @brief Encode a typed message: header with its type id, fields, footer
+ *
+ * The buffer type fixes the packet length, so nothing is checked at run
+ * time: the header, each field and the footer are copied to constant
+ * offsets and the CRC runs over a constant length. Does not touch the
+ * payload set with setDataPointer().
+ *
+ * @param[in]  message  Message to send
+ * @param[out] buffer   Encoded packet
+ * @return Packet length in bytes (always the buffer size)
+ */
+template <SchemaMessage Message>
+size_t
+AppPacket::encodeMessage(const Message& message, AppPacketMessageBuffer<Message>& buffer)
+{
+    using Schema = MessageSchema<Message>;
+    static constexpr size_t PAYLOAD_OFFSET = sizeof(AppPacketHeader);
+    static constexpr size_t FOOTER_OFFSET  = PAYLOAD_OFFSET + Schema::WIRE_SIZE;
+    static_assert(Schema::WIRE_SIZE <= APP_PACKET_MAX_DATA_SIZE, "Message does not fit one packet");
+
+    AppPacketHeader header = buildHeader(Schema::WIRE_SIZE, 0U, Schema::TYPE_ID);
+    AppPacketFooter footer = {0};
+
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    Schema::serialize(message, &buffer[PAYLOAD_OFFSET]);
+
+    m_crc32 = Crc32::compute(m_crc_algorithm, buffer.data(), FOOTER_OFFSET);
+    footer.crc32 = m_crc32;
+    std::memcpy(&buffer[FOOTER_OFFSET], &footer, sizeof(footer));
+
+    m_error = AppPacketError::None;
+
+    /* Auto-increment TX lifesign for next packet */
+    m_lifesign++;
+
+    return buffer.size();
+}
+
+
 #endif  // AGENT_TEAM_TEST_APP_APPPACKET_HPP
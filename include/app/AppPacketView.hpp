@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AppPacketView.hpp
+ * @ingroup app
+ * @class AppPacketView
+ * @brief Stateless, zero-copy view of a received application packet
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_APPPACKETVIEW_HPP
+#define AGENT_TEAM_TEST_APP_APPPACKETVIEW_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "app/AppPacket.hpp"
+#include "app/Crc32.hpp"
+#include "app/MessageSchema.hpp"
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Validates a received packet in place and reads its fields from it
+ *
+ * Holds only the buffer pointer, its length and the validation result, so
+ * it is trivially copyable and can be created on any thread with no shared
+ * state. Header fields are loaded from the buffer on access; the payload
+ * is a span into the buffer, which must outlive the view.
+ *
+ * Lifesign, interval and loss monitoring are not part of decoding: feed
+ * getUniqueId() and getLifesign() of valid views to a PeerMonitor.
+ */
+class AppPacketView
+{
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    AppPacketView();
+
+    /**
+     * @brief Validate framing and, unless told otherwise, the CRC
+     *
+     * @param[in] buffer       Received packet (not copied)
+     * @param[in] buffer_size  Received length in bytes
+     * @param[in] verify_crc   false: framing only, the caller checks the CRC
+     *                         (AppPacket::decodeBatch() does so for a batch)
+     */
+    AppPacketView(const uint8_t* buffer, size_t buffer_size, bool verify_crc = true);
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool isValid(void) const;
+    AppPacket::AppPacketError getError(void) const;
+
+    /* Header fields: only meaningful when the header was readable */
+    bool hasHeader(void) const;
+    uint32_t getUniqueId(void) const;
+    uint16_t getLifesign(void) const;
+    uint16_t getDataLength(void) const;
+    uint8_t getVersion(void) const;
+    uint8_t getFlags(void) const;
+    uint16_t getMessageType(void) const;        /**< MessageSchema<T>::TYPE_ID or MESSAGE_TYPE_NONE */
+    CrcAlgorithm getCrcAlgorithm(void) const;   /**< From APP_PACKET_FLAG_CRC32C */
+    bool isPeerCrc32cCapable(void) const;       /**< Sender advertised CRC-32C support */
+
+    /* Framed fields: only meaningful when framing was valid */
+    std::span<const uint8_t> getPayload(void) const;
+    std::span<const uint8_t> getCrcCoverage(void) const;  /**< Header + payload */
+    uint32_t getCrc32(void) const;                       /**< Footer CRC */
+    size_t getPacketLength(void) const;                  /**< Header + payload + footer */
+
+    template <SchemaMessage Message>
+    bool decodeMessage(Message& message) const;
+
+    static size_t frameLength(const uint8_t* buffer, size_t buffer_size);
+
+private:
+    template <typename T>
+    T loadField(size_t offset) const;
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    const uint8_t* m_buffer;
+    size_t m_buffer_size;
+    AppPacket::AppPacketError m_error;
+};
+
+static_assert(std::is_trivially_copyable_v<AppPacketView>, "AppPacketView is passed between threads by value");
+
+
+/*******************************************************************************
+ * Template Definition
+ ******************************************************************************/
+
+/**
+ * @brief Read a typed message out of a valid packet
+ *
+ * One compare of the type id and one of the length stand in for all
+ * per-field checks; the fields are then copied from constant offsets.
+ *
+ * @param[out] message  Filled on success, untouched otherwise
+ * @return true if the packet is valid and carries a Message
+ */
+template <SchemaMessage Message>
+bool
+AppPacketView::decodeMessage(Message& message) const
+{
+    using Schema = MessageSchema<Message>;
+    bool result = false;
+
+    if ((isValid() == true) && (getMessageType() == Schema::TYPE_ID) && (getDataLength() == Schema::WIRE_SIZE))
+    {
+        Schema::deserialize(&m_buffer[sizeof(AppPacketHeader)], message);
+        result = true;
+    }
+
+    return result;
+}
+
+
+#endif  // AGENT_TEAM_TEST_APP_APPPACKETVIEW_HPP
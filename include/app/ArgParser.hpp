@@ -24,7 +24,7 @@
 /*******************************************************************************
  * Macro
  ******************************************************************************/
-
+static constexpr uint32_t ARG_MESSAGE_MAX_SIZE = 1024U * 1024U;  /**< --message limit: 729 fragments fit the TX Bulk queue */
 
 
 /*******************************************************************************
@@ -36,6 +36,17 @@ struct UdpPeerArgs
     uint16_t src_port;
     uint32_t dst_addr;
     uint16_t dst_port;
+    const char* control_path;   /**< --control <path>: runtime control socket (nullptr = off) */
+    bool crc32c;                /**< --crc32c: send CRC-32C once the peer supports it */
+    bool crc_bench;             /**< --crc-bench: benchmark the CRC kernels and exit */
+    bool frag_bench;            /**< --frag-bench: benchmark fragmentation/reassembly and exit */
+    bool peer_bench;            /**< --peer-bench: benchmark the peer monitor and exit */
+    bool fec_bench;             /**< --fec-bench: benchmark the FEC codec and exit */
+    bool schema_bench;          /**< --schema-bench: benchmark typed message encode/decode and exit */
+    bool coalesce;              /**< --coalesce: pack queued packets into shared datagrams */
+    uint8_t fec_data;           /**< --fec <k>[:<m>]: parity every k packets (0 = FEC off) */
+    uint8_t fec_parity;         /**< m parity packets per group (1 = XOR, more = Reed-Solomon) */
+    uint32_t message_size;      /**< --message <bytes>: fragmented test message once per second (0 = off) */
 };
 
 
@@ -0,0 +1,108 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ControlServer.hpp
+ * @ingroup app
+ * @class ControlServer
+ * @brief UNIX datagram socket for runtime thread and socket tuning
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_CONTROLSERVER_HPP
+#define AGENT_TEAM_TEST_APP_CONTROLSERVER_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <functional>
+#include <string>
+
+#include "thread/UdpThreadManager.hpp"
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Text command channel to a running UdpThreadManager
+ *
+ * One command per datagram on an AF_UNIX SOCK_DGRAM socket:
+ *
+ *   pin <thread> <cpu>
+ *   sched <thread> fifo|rr <priority>
+ *   sched <thread> other
+ *   sched <thread> deadline <runtime_us> <deadline_us> <period_us>
+ *   sockbuf <rx_bytes> <tx_bytes>      (0 = leave unchanged)
+ *   status
+ *
+ * where <thread> is rx, tx or worker<N>. The reply goes back to the
+ * sender's address, so the client must bind its own socket, e.g.
+ *   socat - UNIX-SENDTO:/tmp/udp.ctl,bind=/tmp/udp.ctl.client
+ *
+ * Commands run on the event loop thread, the same thread that calls
+ * start()/stop(), never on an RT thread.
+ */
+class ControlServer
+{
+public:
+    using LogCallback = std::function<void(const std::string&)>;
+
+public:
+    ControlServer();
+    ~ControlServer();
+
+    ControlServer(const ControlServer&) = delete;
+    ControlServer& operator=(const ControlServer&) = delete;
+
+    /**
+     * @brief Create the socket (a stale socket file at path is replaced)
+     *
+     * @param path Filesystem path of the socket
+     * @param threadMgr Manager the commands act on
+     * @return true if successful
+     */
+    bool open(const std::string& path, UdpThreadManager& threadMgr);
+
+    /**
+     * @brief Close the socket and remove its file
+     */
+    void close();
+
+    /**
+     * @brief Receive and execute every pending command (register on EPOLLIN)
+     */
+    void handleEvent();
+
+    /**
+     * @brief Called with each command and its reply
+     */
+    void setLogCallback(LogCallback callback) { m_logCallback = callback; }
+
+    int getFd() const { return m_fd; }
+
+private:
+    /**
+     * @brief Run one command line
+     *
+     * @return Reply text, "ok ..." or "error: ..."
+     */
+    std::string execute(const std::string& line);
+
+    /**
+     * @brief Parse rx, tx or worker<N>
+     */
+    static bool parseThread(const std::string& name, UdpThreadManager::ManagedThread& thread,
+                            size_t& worker);
+
+private:
+    int m_fd;
+    std::string m_path;
+    UdpThreadManager* m_threadMgr;
+    LogCallback m_logCallback;
+};
+
+#endif  // AGENT_TEAM_TEST_APP_CONTROLSERVER_HPP
@@ -0,0 +1,129 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Crc32.hpp
+ * @ingroup app
+ * @class Crc32
+ * @brief CRC-32 / CRC-32C engine with runtime CPU dispatch
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_CRC32_HPP
+#define AGENT_TEAM_TEST_APP_CRC32_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief CRC polynomial (both reflected, init and final XOR 0xFFFFFFFF)
+ */
+enum class CrcAlgorithm : uint8_t
+{
+    Ieee,       /**< CRC-32 (IEEE 802.3, 0xEDB88320), the original wire CRC */
+    Castagnoli  /**< CRC-32C (0x82F63B78), SSE4.2 crc32 instruction */
+};
+
+/**
+ * @brief CRC kernel, slowest first
+ */
+enum class CrcImpl : uint8_t
+{
+    Bitwise,    /**< One bit per step: reference only */
+    Slice8,     /**< 8 table lookups per 8 bytes */
+    Slice16,    /**< 16 table lookups per 16 bytes */
+    Pclmul,     /**< PCLMULQDQ 4x128-bit folding (CRC-32 only) */
+    Sse42,      /**< SSE4.2 crc32 instruction, 8 bytes per step (CRC-32C only) */
+    Count
+};
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Computes CRC-32 and CRC-32C with the fastest kernel the CPU has
+ *
+ * The kernel per algorithm is chosen once from CPUID (first call):
+ * CRC-32 uses PCLMULQDQ folding if available, CRC-32C the SSE4.2 crc32
+ * instruction, both fall back to slice-by-16. Tables are built at compile
+ * time, so no call allocates or initialises anything on the hot path.
+ */
+class Crc32
+{
+public:
+    /** Raw state to start update() with; final CRC = state ^ INIT_STATE */
+    static constexpr uint32_t INIT_STATE = 0xFFFFFFFFU;
+
+    /**
+     * @brief CRC of a buffer
+     */
+    static uint32_t compute(CrcAlgorithm algorithm, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Continue a CRC over the next bytes
+     *
+     * @param state Raw state: INIT_STATE to start, final CRC = state ^ INIT_STATE
+     * @return Updated raw state
+     */
+    static uint32_t update(CrcAlgorithm algorithm, uint32_t state, const uint8_t* data, size_t length);
+
+    /**
+     * @brief CRCs of several independent buffers
+     *
+     * With the SSE4.2 kernel, groups of four buffers are run interleaved so
+     * the 3-cycle crc32 latency of one stream hides behind the other three,
+     * and a remaining pair runs two-way; otherwise each buffer goes through
+     * the dispatched kernel in turn.
+     *
+     * @param data    Buffer pointers
+     * @param lengths Buffer lengths
+     * @param crcs    Output, one CRC per buffer
+     * @param count   Number of buffers
+     * @return Buffers whose CRC ran in an interleaved group (an even number)
+     */
+    static size_t computeMulti(CrcAlgorithm algorithm, const uint8_t* const* data, const size_t* lengths,
+                               uint32_t* crcs, size_t count);
+
+    /**
+     * @brief CRC with a given kernel (benchmark and cross-checks)
+     *
+     * Falls back to the dispatched kernel when impl is not supported.
+     */
+    static uint32_t computeWith(CrcImpl impl, CrcAlgorithm algorithm, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Whether a kernel exists for the algorithm and this CPU
+     */
+    static bool isSupported(CrcImpl impl, CrcAlgorithm algorithm);
+
+    /**
+     * @brief Kernel chosen by the dispatcher
+     */
+    static CrcImpl getSelected(CrcAlgorithm algorithm);
+
+    static const char* implName(CrcImpl impl);
+    static const char* algorithmName(CrcAlgorithm algorithm);
+
+    /**
+     * @brief Measure GB/s of every supported kernel over typical packet sizes
+     *
+     * Every kernel is first checked against the bitwise reference.
+     *
+     * @return false if a kernel disagreed with the reference
+     */
+    static bool benchmark(std::ostream& out);
+};
+
+#endif  // AGENT_TEAM_TEST_APP_CRC32_HPP
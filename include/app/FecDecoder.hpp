@@ -0,0 +1,185 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file FecDecoder.hpp
+ * @ingroup app
+ * @class FecDecoder
+ * @brief Rebuilds lost packets from FEC parity without a retransmission
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_FECDECODER_HPP
+#define AGENT_TEAM_TEST_APP_FECDECODER_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+#include "app/AppPacketView.hpp"
+#include "app/FecEncoder.hpp"
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr size_t FEC_HISTORY_SIZE   = 64U;   /**< Recent packets kept per sender (power of 2) */
+static constexpr size_t FEC_PENDING_GROUPS = 8U;    /**< Groups waiting for data or parity, per sender */
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Packets rebuilt by one FecDecoder::add() call
+ */
+struct FecRecovery
+{
+    struct Frame
+    {
+        uint16_t lifesign;
+        const uint8_t* data;    /**< Whole packet, in the history: valid until the next add() */
+        size_t length;
+    };
+
+    std::array<Frame, FEC_MAX_PARITY_PACKETS> frames;
+    size_t count;
+};
+
+/**
+ * @brief Decoder counters
+ */
+struct FecDecoderStats
+{
+    uint64_t dataPackets;       /**< Data packets stored */
+    uint64_t parityPackets;     /**< Parity packets accepted */
+    uint64_t recovered;         /**< Lost packets rebuilt */
+    uint64_t unrecoverable;     /**< Lost packets of groups given up (too few parity packets) */
+    uint64_t rejected;          /**< Malformed parity, oversize packets, senders beyond max_sources */
+    uint64_t decodeNs;          /**< Time spent in add() */
+};
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Keeps recent packets per sender and rebuilds lost ones from parity
+ *
+ * Every valid packet goes through add(). Data packets are delivered by
+ * the caller at once (FEC adds no latency to packets that arrive) and a
+ * copy is kept in a per-sender history of FEC_HISTORY_SIZE lifesigns.
+ * A parity packet whose group misses n packets is kept until the group
+ * has n parity packets; the missing packets are then solved from the
+ * received ones (XOR for a single loss on row 0, Gauss-Jordan over the
+ * Cauchy submatrix otherwise) and handed back for delivery. Rebuilt
+ * packets are whole encoded packets: validate them with AppPacketView.
+ *
+ * A waiting group is given up when its packets leave the history or its
+ * slot is needed by a newer group; its missing packets then count as
+ * unrecoverable. All memory is allocated in initialize().
+ *
+ * Threads: one writer calls add() (e.g. the RX worker); getStats() may
+ * be called from any thread.
+ */
+class FecDecoder
+{
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    FecDecoder();
+
+    FecDecoder(const FecDecoder&) = delete;
+    FecDecoder& operator=(const FecDecoder&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool initialize(size_t max_sources);
+
+    /**
+     * @brief Store a valid packet; rebuild whatever it makes recoverable
+     *
+     * @param packet    Valid packet (data, or flagged APP_PACKET_FLAG_FEC_PARITY)
+     * @param recovery  Rebuilt packets, count 0 if none
+     */
+    void add(const AppPacketView& packet, FecRecovery& recovery);
+
+    bool isEnabled(void) const;
+    FecDecoderStats getStats(void) const;
+
+    /**
+     * @brief Encode, drop and decode in memory; print MB/s, recovery rate and kernel GB/s
+     *
+     * @return false if a rebuilt packet differed from the one sent
+     */
+    static bool benchmark(std::ostream& out);
+
+private:
+    struct Frame
+    {
+        uint16_t lifesign;
+        uint16_t length;            /**< 0 = empty */
+        uint8_t* data;              /**< FEC_MAX_FRAME_SIZE bytes in m_frame_pool */
+    };
+
+    struct Group
+    {
+        bool used;
+        uint64_t age;               /**< Allocation order, oldest is evicted first */
+        FecHeader header;
+        uint8_t rows;               /**< Bit per parity row received */
+        uint8_t* parity[FEC_MAX_PARITY_PACKETS];
+    };
+
+    struct Source
+    {
+        uint32_t source_id;
+        uint16_t newest;            /**< Highest data lifesign seen */
+        Frame* history;             /**< FEC_HISTORY_SIZE frames, indexed by lifesign */
+        Group* groups;              /**< FEC_PENDING_GROUPS */
+    };
+
+    Source* findSource(uint32_t source_id);
+    void addData(Source& source, const AppPacketView& packet, FecRecovery& recovery);
+    void addParity(Source& source, const AppPacketView& packet, FecRecovery& recovery);
+    Group* allocateGroup(Source& source);
+    size_t countMissing(const Source& source, const FecHeader& header, size_t* missing) const;
+    bool recover(Source& source, Group& group, FecRecovery& recovery);
+    void releaseGroup(Group& group);
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    std::vector<Source> m_sources;
+    std::vector<Frame> m_frames;
+    std::vector<Group> m_groups;
+    std::vector<uint8_t> m_frame_pool;
+    std::vector<uint8_t> m_parity_pool;
+    std::vector<uint8_t> m_scratch;     /**< FEC_MAX_PARITY_PACKETS syndrome rows */
+    size_t m_source_count;
+    uint64_t m_group_age;
+
+    std::atomic<uint64_t> m_data_packets;
+    std::atomic<uint64_t> m_parity_packets;
+    std::atomic<uint64_t> m_recovered;
+    std::atomic<uint64_t> m_unrecoverable;
+    std::atomic<uint64_t> m_rejected;
+    std::atomic<uint64_t> m_decode_ticks;
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_FECDECODER_HPP
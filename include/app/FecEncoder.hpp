@@ -0,0 +1,149 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file FecEncoder.hpp
+ * @ingroup app
+ * @class FecEncoder
+ * @brief Forward error correction: parity packets over groups of sent packets
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_FECENCODER_HPP
+#define AGENT_TEAM_TEST_APP_FECENCODER_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstddef>
+#include <sys/uio.h>
+#include <vector>
+
+#include "app/AppPacket.hpp"
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr size_t FEC_MAX_DATA_PACKETS   = 16U;    /**< Largest group (K) */
+static constexpr size_t FEC_MAX_PARITY_PACKETS = 4U;     /**< Most parity packets per group (M) */
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief FEC header, first bytes of a APP_PACKET_FLAG_FEC_PARITY payload
+ *
+ * A group is data_count consecutive lifesigns of one sender starting at
+ * first_lifesign. Every parity packet repeats the group layout, so any
+ * one of them is enough to rebuild a single lost packet.
+ */
+struct FecHeader
+{
+    uint16_t first_lifesign;                        /**< Lifesign of data packet 0 */
+    uint8_t  data_count;                            /**< K: data packets in the group */
+    uint8_t  parity_count;                          /**< M: parity packets in the group */
+    uint8_t  parity_index;                          /**< Row of this packet, 0..M-1 */
+    uint8_t  reserved;
+    uint16_t parity_length;                         /**< Longest data packet = parity bytes that follow */
+    uint16_t lengths[FEC_MAX_DATA_PACKETS];         /**< Encoded length of each data packet */
+};
+
+static constexpr size_t FEC_MAX_FRAME_SIZE = APP_PACKET_MAX_DATA_SIZE - sizeof(FecHeader);  /**< Largest protected packet */
+
+/**
+ * @brief Encoder counters
+ */
+struct FecEncoderStats
+{
+    uint64_t groups;            /**< Groups whose parity was emitted */
+    uint64_t dataPackets;       /**< Packets added to a group */
+    uint64_t parityPackets;     /**< Parity packets encoded */
+    uint64_t skipped;           /**< Packets empty or too large to protect, or that broke a group */
+    uint64_t encodeNs;          /**< Time spent in add() and encodeParity() */
+};
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Computes M parity packets for every K consecutive data packets
+ *
+ * The code is a systematic Cauchy Reed-Solomon code over GF(2^8) with
+ * every column scaled so that row 0 is all ones: parity 0 is the plain
+ * XOR of the group, so M = 1 costs one XOR per byte, and any K of the
+ * K + M packets rebuild the group. Data packets go out unchanged (the
+ * whole encoded packet, header to CRC, is protected); add() folds each
+ * one into the parity rows as it is sent, so nothing is buffered.
+ *
+ * A group needs consecutive lifesigns: a packet that does not follow the
+ * last one abandons the open group and starts a new one. Encode parity
+ * through an AppPacket of its own (same unique id): parity lifesigns are
+ * then a separate stream and the data lifesigns stay consecutive.
+ *
+ * Not thread-safe: call from the thread that sends the data packets.
+ */
+class FecEncoder
+{
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    FecEncoder();
+
+    FecEncoder(const FecEncoder&) = delete;
+    FecEncoder& operator=(const FecEncoder&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool initialize(size_t data_count, size_t parity_count);
+
+    /**
+     * @brief Fold one encoded data packet into the open group
+     *
+     * @param lifesign  Lifesign the packet was encoded with
+     * @param iov       Packet pieces, e.g. AppPacketGather::iov
+     * @param iovcnt    Number of pieces
+     * @return true if the group is now complete: call encodeParity() until it returns false
+     */
+    bool add(uint16_t lifesign, const struct iovec* iov, size_t iovcnt);
+
+    bool encodeParity(AppPacket& packet, AppPacketGather& gather);
+    bool isEnabled(void) const;
+    size_t getDataCount(void) const;
+    size_t getParityCount(void) const;
+    FecEncoderStats getStats(void) const;
+
+    /**
+     * @brief Coefficient of data packet data_index in parity row parity_index
+     */
+    static uint8_t coefficient(size_t parity_index, size_t data_index);
+
+private:
+    void startGroup(uint16_t lifesign);
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    std::vector<uint8_t> m_parity;      /**< parity_count rows of FEC_MAX_FRAME_SIZE */
+    size_t m_data_count;
+    size_t m_parity_count;
+    size_t m_added;                     /**< Data packets in the open group */
+    size_t m_next_parity;               /**< Next row encodeParity() emits */
+    size_t m_dirty;                     /**< Row bytes that may be non-zero */
+    FecHeader m_header;                 /**< Referenced by the last gather */
+    FecEncoderStats m_stats;
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_FECENCODER_HPP
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Fragmenter.hpp
+ * @ingroup app
+ * @class Fragmenter
+ * @brief Splits large messages into MTU-sized application packets
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_FRAGMENTER_HPP
+#define AGENT_TEAM_TEST_APP_FRAGMENTER_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstddef>
+
+#include "app/AppPacket.hpp"
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Fragment header, first bytes of a APP_PACKET_FLAG_FRAGMENT payload
+ *
+ * Every fragment repeats the message length and count, so a receiver can
+ * start reassembly from whichever fragment arrives first.
+ */
+struct FragmentHeader
+{
+    uint32_t message_id;        /**< Per-sender message counter */
+    uint32_t message_length;    /**< Total message length in bytes */
+    uint32_t offset;            /**< Byte offset of this slice in the message */
+    uint16_t index;             /**< Fragment number, 0..count-1 */
+    uint16_t count;             /**< Fragments in the message */
+};
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr size_t FRAGMENT_MAX_DATA_SIZE    = APP_PACKET_MAX_DATA_SIZE - sizeof(FragmentHeader);  /**< Slice per fragment */
+static constexpr size_t FRAGMENT_MAX_MESSAGE_SIZE = 8U * 1024U * 1024U;  /**< Largest message begin() accepts */
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Encodes one message as a sequence of fragment packets
+ *
+ * Each fragment is an AppPacket flagged APP_PACKET_FLAG_FRAGMENT whose
+ * payload is a FragmentHeader followed by the next FRAGMENT_MAX_DATA_SIZE
+ * bytes of the message. next() emits the fragment as a scatter-gather
+ * AppPacketGather, so the message itself is never copied in user space.
+ *
+ * The fragment header of the current fragment is stored here: send or
+ * push each gather before calling next() again. The message must stay
+ * unchanged until its last fragment is sent.
+ */
+class Fragmenter
+{
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    Fragmenter();
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool begin(const uint8_t* message, size_t length);
+    bool next(AppPacket& packet, AppPacketGather& gather);
+    bool isDone(void) const;
+
+    uint32_t getMessageId(void) const;      /**< Id of the current message */
+    uint16_t getFragmentCount(void) const;  /**< Fragments of the current message */
+
+    static uint16_t fragmentCount(size_t length);
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    const uint8_t* m_message;
+    size_t m_length;
+    uint32_t m_message_id;          /**< Incremented by begin() */
+    uint16_t m_count;
+    uint16_t m_next_index;
+    FragmentHeader m_header;        /**< Referenced by the last gather */
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_FRAGMENTER_HPP
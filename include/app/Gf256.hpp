@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Gf256.hpp
+ * @ingroup app
+ * @class Gf256
+ * @brief GF(2^8) arithmetic and SIMD region multiply for erasure codes
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_GF256_HPP
+#define AGENT_TEAM_TEST_APP_GF256_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <cstdint>
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Region multiply kernel, slowest first
+ */
+enum class GfImpl : uint8_t
+{
+    Table,      /**< Two nibble lookups per byte */
+    Ssse3,      /**< pshufb nibble lookup, 16 bytes per step */
+    Avx2,       /**< vpshufb nibble lookup, 32 bytes per step */
+    Count
+};
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Field with 256 elements (polynomial 0x11D, generator 2)
+ *
+ * Addition is XOR. Single products use compile-time log/exp tables; the
+ * hot operation of an erasure code is dst ^= c * src over a whole packet,
+ * done by mulAdd() with the fastest kernel the CPU has (chosen once from
+ * CPUID, like Crc32). Every kernel splits each source byte into nibbles
+ * and looks both up in the coefficient's two 16-entry product tables
+ * (built at compile time for all 256 coefficients), so the SIMD kernels
+ * do 16 or 32 multiplies per shuffle pair.
+ */
+class Gf256
+{
+public:
+    static uint8_t mul(uint8_t a, uint8_t b);
+    static uint8_t inverse(uint8_t a);          /**< 0 has no inverse: returns 0 */
+
+    /**
+     * @brief dst[i] ^= coefficient * src[i] for length bytes
+     *
+     * Coefficient 1 is a plain XOR and 0 leaves dst unchanged.
+     */
+    static void mulAdd(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length);
+
+    /**
+     * @brief mulAdd() with a given kernel (benchmark and cross-checks)
+     *
+     * Falls back to the dispatched kernel when impl is not supported.
+     */
+    static void mulAddWith(GfImpl impl, uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length);
+
+    /**
+     * @brief Invert a size x size row-major matrix in place (Gauss-Jordan)
+     *
+     * @return false if the matrix is singular (contents then undefined)
+     */
+    static bool invert(uint8_t* matrix, size_t size);
+
+    static bool isSupported(GfImpl impl);
+    static GfImpl getSelected(void);
+    static const char* implName(GfImpl impl);
+};
+
+#endif  // AGENT_TEAM_TEST_APP_GF256_HPP
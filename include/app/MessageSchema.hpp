@@ -0,0 +1,228 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file MessageSchema.hpp
+ * @ingroup app
+ * @brief Compile-time wire layout and type id of typed messages
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_MESSAGESCHEMA_HPP
+#define AGENT_TEAM_TEST_APP_MESSAGESCHEMA_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr uint16_t MESSAGE_TYPE_NONE = 0U;  /**< Header message_type of untyped payloads */
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Message type id from name and version (FNV-1a folded to 16 bits)
+ *
+ * Never returns MESSAGE_TYPE_NONE. Bumping the version changes the id, so
+ * a peer with an older layout rejects the message instead of misreading it.
+ */
+constexpr uint16_t
+messageTypeId(std::string_view name, uint8_t version)
+{
+    uint32_t hash = 2166136261U;
+
+    for (char c : name)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619U;
+    }
+    hash = (hash ^ version) * 16777619U;
+    hash = (hash >> 16) ^ (hash & 0xFFFFU);
+
+    return (hash == MESSAGE_TYPE_NONE) ? 1U : static_cast<uint16_t>(hash);
+}
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Ordered list of the members that make up a message on the wire
+ *
+ * Members are packed in list order with no padding, in host byte order
+ * like the packet header. Offsets and sizes are constants, so serialize()
+ * and deserialize() compile to one fixed-size memcpy per member.
+ *
+ * @tparam Members  Pointers to data members, e.g. &Telemetry::sequence
+ */
+template <auto... Members>
+struct MessageFields
+{
+private:
+    template <typename Member>
+    struct MemberTraits;
+
+    template <typename Field, typename Message>
+    struct MemberTraits<Field Message::*>
+    {
+        using FieldType = Field;
+    };
+
+    template <auto Member>
+    using FieldType = typename MemberTraits<decltype(Member)>::FieldType;
+
+    static constexpr std::tuple<decltype(Members)...> MEMBERS{Members...};
+
+    static constexpr std::array<size_t, sizeof...(Members)> SIZES{sizeof(FieldType<Members>)...};
+
+
+    template <typename Message, size_t... I>
+    static void serializeFields(const Message& message, uint8_t* out, std::index_sequence<I...>)
+    {
+        (std::memcpy(&out[OFFSETS[I]], &(message.*std::get<I>(MEMBERS)), SIZES[I]), ...);
+    }
+
+    template <typename Message, size_t... I>
+    static void deserializeFields(const uint8_t* in, Message& message, std::index_sequence<I...>)
+    {
+        (std::memcpy(&(message.*std::get<I>(MEMBERS)), &in[OFFSETS[I]], SIZES[I]), ...);
+    }
+
+    static_assert(sizeof...(Members) > 0U, "A message needs at least one field");
+    static_assert((std::is_member_object_pointer_v<decltype(Members)> && ...), "Fields must be data member pointers");
+    static_assert((std::is_trivially_copyable_v<FieldType<Members>> && ...), "Fields must be trivially copyable");
+
+public:
+    static constexpr size_t COUNT = sizeof...(Members);
+    static constexpr size_t WIRE_SIZE = (sizeof(FieldType<Members>) + ...);
+    static constexpr std::array<size_t, sizeof...(Members)> OFFSETS = []()
+    {
+        std::array<size_t, sizeof...(Members)> offsets{};
+        size_t offset = 0U;
+
+        for (size_t i = 0U; i < sizeof...(Members); i++)
+        {
+            offsets[i] = offset;
+            offset += SIZES[i];
+        }
+
+        return offsets;
+    }();
+
+    /**
+     * @brief Write every field at its offset; out must hold WIRE_SIZE bytes
+     */
+    template <typename Message>
+    static void serialize(const Message& message, uint8_t* out)
+    {
+        serializeFields(message, out, std::make_index_sequence<COUNT>{});
+    }
+
+    /**
+     * @brief Read every field from its offset; in must hold WIRE_SIZE bytes
+     */
+    template <typename Message>
+    static void deserialize(const uint8_t* in, Message& message)
+    {
+        deserializeFields(in, message, std::make_index_sequence<COUNT>{});
+    }
+};
+
+/**
+ * @brief A struct that declares its wire layout
+ *
+ * Required members:
+ *   using Fields = MessageFields<&T::a, &T::b, ...>;
+ *   static constexpr std::string_view MESSAGE_NAME = "...";
+ *   static constexpr uint8_t MESSAGE_VERSION = 1U;
+ */
+template <typename Message>
+concept SchemaMessage = requires
+{
+    typename Message::Fields;
+    { Message::MESSAGE_NAME } -> std::convertible_to<std::string_view>;
+    { Message::MESSAGE_VERSION } -> std::convertible_to<uint8_t>;
+} && std::is_default_constructible_v<Message>;
+
+/**
+ * @brief Compile-time facts and codec of one message type
+ *
+ * Example:
+ *   struct Telemetry
+ *   {
+ *       uint32_t sequence;
+ *       int16_t temperature;
+ *       std::array<float, 3> position;
+ *
+ *       using Fields = MessageFields<&Telemetry::sequence, &Telemetry::temperature, &Telemetry::position>;
+ *       static constexpr std::string_view MESSAGE_NAME = "Telemetry";
+ *       static constexpr uint8_t MESSAGE_VERSION = 1U;
+ *   };
+ *
+ * AppPacket::encodeMessage() and AppPacketView::decodeMessage() carry
+ * TYPE_ID in the packet header.
+ */
+template <SchemaMessage Message>
+struct MessageSchema
+{
+    using Fields = typename Message::Fields;
+
+    static constexpr uint16_t TYPE_ID = messageTypeId(Message::MESSAGE_NAME, Message::MESSAGE_VERSION);
+    static constexpr size_t WIRE_SIZE = Fields::WIRE_SIZE;
+
+    static void serialize(const Message& message, uint8_t* out)
+    {
+        Fields::serialize(message, out);
+    }
+
+    static void deserialize(const uint8_t* in, Message& message)
+    {
+        Fields::deserialize(in, message);
+    }
+};
+
+/**
+ * @brief Check at compile time that message types do not share an id
+ *
+ * static_assert(messageTypesUnique<Telemetry, Command>());
+ */
+template <SchemaMessage... Messages>
+constexpr bool
+messageTypesUnique(void)
+{
+    constexpr std::array<uint16_t, sizeof...(Messages)> ids{MessageSchema<Messages>::TYPE_ID...};
+    bool unique = true;
+
+    for (size_t i = 0U; i < ids.size(); i++)
+    {
+        for (size_t j = i + 1U; j < ids.size(); j++)
+        {
+            if (ids[i] == ids[j])
+            {
+                unique = false;
+            }
+        }
+    }
+
+    return unique;
+}
+
+
+#endif  // AGENT_TEAM_TEST_APP_MESSAGESCHEMA_HPP
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file PeerMonitor.hpp
+ * @ingroup app
+ * @class PeerMonitor
+ * @brief Lifesign monitor for many peers, with deadlines on a timer wheel
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_PEERMONITOR_HPP
+#define AGENT_TEAM_TEST_APP_PEERMONITOR_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+#include "app/AppPacket.hpp"
+#include "timer/TimerWheel.hpp"
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr uint32_t PEER_MONITOR_TICK_US = 1000U;        /**< Deadline resolution */
+static constexpr uint32_t PEER_MONITOR_NONE    = UINT32_MAX;   /**< No peer index */
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Communication state of one peer
+ */
+enum class PeerState : uint8_t
+{
+    Unknown,        /**< No packet yet */
+    Up,             /**< Lifesign moving, last interval within tolerance */
+    Unstable,       /**< Last interval out of tolerance, or next packet overdue */
+    Lost            /**< Lifesign frozen for the comm timeout */
+};
+
+static constexpr size_t PEER_STATE_COUNT = 4U;
+
+/**
+ * @brief Snapshot of one peer
+ */
+struct PeerStatus
+{
+    uint32_t unique_id;
+    PeerState state;
+    uint16_t lifesign;              /**< Last received lifesign */
+    uint32_t last_interval_us;      /**< Time between the last two packets */
+    uint16_t unstable_counter;      /**< Consecutive out-of-tolerance intervals */
+    uint32_t since_change_ms;       /**< Time since the lifesign last changed */
+};
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Tracks the lifesign of up to max_peers senders keyed by unique id
+ *
+ * Peers live in a structure-of-arrays table; update() finds a peer through
+ * an open-addressing index and writes a few relaxed atomics, so the per
+ * packet cost does not depend on the number of peers and the caller reads
+ * the clock once for a whole batch.
+ *
+ * Deadlines are not polled per peer. Each peer has one entry on a
+ * TimerWheel, due at its next deadline: the packet being overdue
+ * (expected interval + tolerance, -> Unstable) or the lifesign being
+ * frozen for the comm timeout (-> Lost). update() never touches the
+ * wheel; when an entry expires, poll() checks the peer's timestamps and
+ * either changes its state or re-arms the entry for the new deadline, so
+ * a healthy peer costs one O(1) expiry per packet interval.
+ *
+ * Threads: one writer calls update() (packets in order, e.g. the RX
+ * worker); one thread calls poll() (e.g. an event loop timer); any thread
+ * may read. A state change is made with a compare-and-swap by whichever
+ * of the two threads sees it, which then runs the state callback, so the
+ * callback must be thread-safe and is only called on changes.
+ * Configure and initialize() before the first update().
+ */
+class PeerMonitor
+{
+/***********************************************************
+ * Type
+ **********************************************************/
+public:
+    using StateCallback = std::function<void(uint32_t unique_id, PeerState from, PeerState to)>;
+
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    PeerMonitor();
+
+    PeerMonitor(const PeerMonitor&) = delete;
+    PeerMonitor& operator=(const PeerMonitor&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    /* Configuration */
+    bool initialize(size_t max_peers, uint64_t now_ns);
+    void setCommTimeout(uint32_t timeout_ms);
+    void setExpectedInterval(uint32_t interval_ms, uint32_t tolerance_us);
+    void setStateCallback(StateCallback callback);
+
+    /* Writer: once per valid packet */
+    uint32_t update(uint32_t unique_id, uint16_t lifesign, uint64_t now_ns);
+
+    /* Deadline thread */
+    size_t poll(uint64_t now_ns);
+
+    /* Readers: any thread */
+    size_t getPeerCount(void) const;
+    bool getStatus(uint32_t index, uint64_t now_ns, PeerStatus& status) const;
+    size_t getStateCount(PeerState state) const;
+    uint64_t getUntrackedCount(void) const;       /**< Packets from peers beyond max_peers */
+    uint32_t getCommTimeout(void) const;          /**< ms */
+
+    static const char* stateName(PeerState state);
+
+    /**
+     * @brief Simulate 1k-100k peers; print update/poll cost against per-peer polling
+     *
+     * @return false if a peer ended in the wrong state
+     */
+    static bool benchmark(std::ostream& out);
+
+private:
+    uint32_t findOrAdd(uint32_t unique_id, uint64_t now_ns, bool& added);
+    bool transition(uint32_t index, PeerState from, PeerState to);
+    void evaluate(uint32_t index, uint64_t now_ns);
+    uint64_t toTick(uint64_t now_ns) const;
+    uint64_t toTickCeil(uint64_t deadline_ns) const;
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    /* Configuration */
+    uint64_t m_comm_timeout_ns;
+    uint64_t m_expected_interval_ns;
+    uint64_t m_tolerance_ns;
+    uint64_t m_base_ns;                 /**< Time of tick 0 */
+    StateCallback m_callback;
+
+    /* Peer table (structure of arrays, index = peer) */
+    std::vector<uint32_t> m_ids;                            /**< Set before the peer is published */
+    std::vector<std::atomic<uint64_t>> m_last_rx_ns;
+    std::vector<std::atomic<uint64_t>> m_last_change_ns;
+    std::vector<std::atomic<uint32_t>> m_interval_us;
+    std::vector<std::atomic<uint16_t>> m_lifesign;
+    std::vector<std::atomic<uint16_t>> m_unstable_counter;
+    std::vector<std::atomic<PeerState>> m_state;
+    std::atomic<size_t> m_count;                            /**< Published peers */
+
+    /* Writer-only */
+    std::vector<uint32_t> m_index;      /**< Open addressing: unique id hash -> peer index + 1 */
+    uint32_t m_index_shift;             /**< 32 - log2(index size) */
+
+    /* Deadline thread only */
+    TimerWheel m_wheel;
+    size_t m_armed;                     /**< Peers already on the wheel */
+
+    std::array<std::atomic<size_t>, PEER_STATE_COUNT> m_state_counts;
+    std::atomic<uint64_t> m_untracked;
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_PEERMONITOR_HPP
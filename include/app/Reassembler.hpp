@@ -0,0 +1,163 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Reassembler.hpp
+ * @ingroup app
+ * @class Reassembler
+ * @brief Rebuilds fragmented messages in a preallocated buffer pool
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_REASSEMBLER_HPP
+#define AGENT_TEAM_TEST_APP_REASSEMBLER_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <vector>
+
+#include "app/Fragmenter.hpp"
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief A message completed by Reassembler::addFragment()
+ */
+struct ReassembledMessage
+{
+    uint32_t source_id;         /**< Sender (AppPacket unique id) */
+    uint32_t message_id;
+    const uint8_t* data;        /**< Inside the pool: valid until the next addFragment()/expire() */
+    size_t length;
+    uint64_t latency_ns;        /**< First fragment received -> last fragment received */
+};
+
+/**
+ * @brief Reassembly counters
+ */
+struct ReassemblerStats
+{
+    uint64_t fragments;         /**< Fragments accepted */
+    uint64_t completed;         /**< Messages delivered */
+    uint64_t duplicates;        /**< Fragments already received */
+    uint64_t rejected;          /**< Malformed or oversize fragments */
+    uint64_t timedOut;          /**< Partial messages dropped by expire() */
+    uint64_t evicted;           /**< Partial messages dropped to free a slot */
+};
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Collects fragments per (sender, message id) until a message is whole
+ *
+ * All memory is allocated and touched in initialize(): a fixed number of
+ * slots, each with a max_message_size buffer and a received-fragment
+ * bitmap, so addFragment() never allocates. Fragments may arrive in any
+ * order and more than once; each slice is copied once, to its offset.
+ *
+ * A partial message is dropped when it sees no new fragment for the
+ * timeout (expire()), or when a new message needs a slot and none is free
+ * (the least recently active one is evicted). A duplicate that arrives
+ * after its message completed starts a new partial message that times out.
+ *
+ * Not thread-safe: call from one thread, e.g. the RX worker.
+ */
+class Reassembler
+{
+/***********************************************************
+ * Enum
+ **********************************************************/
+public:
+    enum class Result
+    {
+        Pending,        /**< Stored, message still incomplete */
+        Complete,       /**< This fragment completed the message */
+        Duplicate,      /**< Fragment already received, ignored */
+        Rejected        /**< Malformed or does not fit the pool, ignored */
+    };
+
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    Reassembler();
+
+    Reassembler(const Reassembler&) = delete;
+    Reassembler& operator=(const Reassembler&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool initialize(size_t slot_count, size_t max_message_size, uint32_t timeout_ms);
+
+    /**
+     * @brief Add the payload of a valid APP_PACKET_FLAG_FRAGMENT packet
+     *
+     * @param source_id  Sender, e.g. AppPacketView::getUniqueId()
+     * @param payload    FragmentHeader + slice, e.g. AppPacketView::getPayload()
+     * @param now_ns     Monotonic time (steady_clock ns)
+     * @param message    Filled when the result is Complete
+     */
+    Result addFragment(uint32_t source_id, std::span<const uint8_t> payload, uint64_t now_ns,
+                       ReassembledMessage& message);
+
+    size_t expire(uint64_t now_ns);
+    size_t getPendingCount(void) const;
+    ReassemblerStats getStats(void) const;
+
+    /**
+     * @brief Fragment, drop, reorder and reassemble in memory; print MB/s and latency
+     *
+     * @return false if a delivered message differed from what was sent
+     */
+    static bool benchmark(std::ostream& out);
+
+private:
+    struct Slot
+    {
+        bool used;
+        bool delivered;         /**< Completed and handed out: free on the next call */
+        uint32_t source_id;
+        uint32_t message_id;
+        uint32_t length;
+        uint16_t count;
+        uint16_t received;
+        uint64_t first_ns;
+        uint64_t last_ns;
+        uint8_t* data;          /**< max_message_size bytes in m_pool */
+        uint64_t* bitmap;       /**< One bit per fragment in m_bitmaps */
+    };
+
+    Slot* findSlot(uint32_t source_id, uint32_t message_id);
+    Slot* allocateSlot(void);
+    void releaseDelivered(void);
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    std::vector<Slot> m_slots;
+    std::vector<uint8_t> m_pool;
+    std::vector<uint64_t> m_bitmaps;
+    size_t m_max_message_size;
+    size_t m_bitmap_words;          /**< Bitmap words per slot */
+    uint64_t m_timeout_ns;
+    ReassemblerStats m_stats;
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_REASSEMBLER_HPP
@@ -0,0 +1,178 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file SequenceTracker.hpp
+ * @ingroup app
+ * @class SequenceTracker
+ * @brief Per-sender loss, duplicate and reordering analytics from the lifesign
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_APP_SEQUENCETRACKER_HPP
+#define AGENT_TEAM_TEST_APP_SEQUENCETRACKER_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "thread/SeqLock.hpp"
+
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+static constexpr size_t   SEQUENCE_WINDOW_SIZE     = 256U;   /**< Lifesigns remembered below the highest */
+static constexpr size_t   SEQUENCE_MAX_STREAMS     = 8U;     /**< Senders tracked at once */
+static constexpr size_t   SEQUENCE_REORDER_BUCKETS = 8U;     /**< Distance 1, 2, 3-4, 5-8, ... 65+ */
+static constexpr uint16_t SEQUENCE_RESYNC_DISTANCE = 4096U;  /**< Larger jumps restart the stream */
+
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Snapshot of one sender's sequence analytics
+ *
+ * lost is expected - received: a gap counts at once and is taken back if
+ * the missing packet still arrives (reordered). The rolling loss covers
+ * only the last window_span lifesigns, so it recovers after a burst.
+ */
+struct SequenceStats
+{
+    uint32_t source_id;         /**< AppPacket unique id */
+    uint16_t highest;           /**< Highest lifesign seen */
+    uint64_t expected;          /**< Lifesigns from the first to the highest */
+    uint64_t received;          /**< Distinct lifesigns received */
+    uint64_t lost;              /**< expected - received */
+    uint64_t duplicates;        /**< Lifesign already received */
+    uint64_t reordered;         /**< Arrived after a higher lifesign, inside the window */
+    uint64_t late;              /**< Older than the window: loss already counted */
+    uint64_t resyncs;           /**< Jumps over SEQUENCE_RESYNC_DISTANCE (e.g. sender restart) */
+    uint32_t window_span;       /**< Lifesigns the rolling loss covers */
+    uint32_t window_missing;    /**< Of those, not received */
+    uint16_t max_reorder;       /**< Largest reorder distance */
+    std::array<uint64_t, SEQUENCE_REORDER_BUCKETS> reorder_histogram;  /**< Count per distance bucket */
+
+    /**
+     * @brief Loss over the last window_span lifesigns, 0..1
+     */
+    double rollingLoss(void) const
+    {
+        return (window_span > 0U) ? (static_cast<double>(window_missing) / window_span) : 0.0;
+    }
+};
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Classifies every received lifesign against a sliding window
+ *
+ * Each sender (unique id) gets a bitmap of the SEQUENCE_WINDOW_SIZE
+ * lifesigns below its highest one. A lifesign above the highest slides the
+ * window and leaves the skipped ones as gaps; one below it fills its gap
+ * (reordered), finds its bit already set (duplicate) or falls outside the
+ * window (late). 16-bit wrap-around is handled with serial arithmetic.
+ *
+ * One writer (the thread that decodes packets) calls update(); any thread
+ * may call getStats(), which copies a stream's counters under a SeqLock so
+ * they are consistent with each other.
+ */
+class SequenceTracker
+{
+/***********************************************************
+ * Enum
+ **********************************************************/
+public:
+    enum class Event
+    {
+        First,          /**< First lifesign of a stream */
+        InOrder,        /**< Next lifesign */
+        Gap,            /**< Lifesigns skipped before this one */
+        Reordered,      /**< Filled an earlier gap */
+        Duplicate,      /**< Already received */
+        Late,           /**< Older than the window */
+        Resync,         /**< Jump too large: stream restarted */
+        Untracked       /**< Stream table full */
+    };
+
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    SequenceTracker();
+
+    SequenceTracker(const SequenceTracker&) = delete;
+    SequenceTracker& operator=(const SequenceTracker&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    /* Writer: once per valid packet, in arrival order */
+    Event update(uint32_t source_id, uint16_t lifesign);
+    uint16_t getLastGap(void) const;            /**< Lifesigns skipped by the last Gap (writer) */
+
+    /* Readers: any thread */
+    size_t getStreamCount(void) const;
+    bool getStats(size_t stream, SequenceStats& stats) const;
+
+    static size_t reorderBucket(uint16_t distance);
+    static const char* reorderBucketName(size_t bucket);
+
+private:
+    static constexpr size_t WINDOW_WORDS = SEQUENCE_WINDOW_SIZE / 64U;
+
+    /**
+     * @brief One sender: writer-private window, counters published under a SeqLock
+     */
+    struct Stream
+    {
+        /* Writer-only */
+        uint32_t source_id;
+        uint16_t highest;
+        uint64_t first_extended;    /**< Extended (wrap-counted) first lifesign */
+        uint64_t highest_extended;
+        uint64_t window[WINDOW_WORDS];  /**< Bit i: lifesign highest - i received */
+
+        /* Published */
+        SeqLock sequence;
+        std::atomic<uint16_t> pub_highest;
+        std::atomic<uint64_t> received;
+        std::atomic<uint64_t> duplicates;
+        std::atomic<uint64_t> reordered;
+        std::atomic<uint64_t> late;
+        std::atomic<uint64_t> resyncs;
+        std::atomic<uint64_t> expected;
+        std::atomic<uint32_t> window_span;
+        std::atomic<uint32_t> window_missing;
+        std::atomic<uint16_t> max_reorder;
+        std::array<std::atomic<uint64_t>, SEQUENCE_REORDER_BUCKETS> reorder_histogram;
+    };
+
+    Stream* findStream(uint32_t source_id);
+    void restart(Stream& stream, uint16_t lifesign);
+    void slideWindow(Stream& stream, uint16_t distance);
+    uint32_t countMissing(const Stream& stream, uint32_t span) const;
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    std::array<Stream, SEQUENCE_MAX_STREAMS> m_streams;
+    std::atomic<size_t> m_stream_count;     /**< Published after a stream is set up */
+    uint16_t m_last_gap;
+};
+
+
+#endif  // AGENT_TEAM_TEST_APP_SEQUENCETRACKER_HPP
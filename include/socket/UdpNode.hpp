@@ -18,7 +18,9 @@
  * Includes
  ******************************************************************************/
 #include <string_view>
+#include <string>
 #include <cstdint>
+#include <sys/uio.h>
 
 
 /*******************************************************************************
@@ -66,8 +68,10 @@ public:
     void initialize(uint32_t src_addr, uint16_t src_port,
                     uint32_t dst_addr, uint16_t dst_port);
     ssize_t send(const uint8_t* data, size_t length);
+    ssize_t sendv(const struct iovec* iov, size_t iovcnt);
     ssize_t receive(uint8_t* buffer, size_t length);
     int getFd(void) const;
+    std::string getInterfaceName(void) const;
 
     void close(void);
     UdpNode::UdpNodeError getError(void) const;
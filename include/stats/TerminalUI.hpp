@@ -34,6 +34,7 @@
 #include <cstdint>
 
 #include "stats/LatencyStats.hpp"
+#include "thread/ThreadTelemetry.hpp"
 
 
 /*******************************************************************************
@@ -46,7 +47,64 @@ class TerminalUI
  **********************************************************/
 public:
     /** Number of lines reserved for the pinned header area */
-    static constexpr int HEADER_LINES = 7;
+    static constexpr int HEADER_LINES = 24;
+
+    /** Width of the queue high-water-mark bar */
+    static constexpr size_t GAUGE_WIDTH = 8U;
+
+/***********************************************************
+ * Type
+ **********************************************************/
+public:
+    /**
+     * @brief Everything shown in the pinned dashboard
+     */
+    struct Dashboard
+    {
+        LatencyStats<>::Result txSend;      /**< TX send latency */
+        LatencyStats<>::Result rxProc;      /**< RX processing latency */
+        LatencyStats<>::Result rxInterval;  /**< RX inter-packet interval */
+        LatencyStats<>::Result txShaping;   /**< TX shaper hold time */
+        LatencyStats<>::Result txDirect;    /**< Direct send, queueTxPacket → sendto done */
+        LatencyStats<>::Result txQueued;    /**< Queued send, queueTxPacket → sendto done */
+        LatencyStats<>::Result txControlQueue;  /**< TX control lane residence time */
+        LatencyStats<>::Result txBulkQueue;     /**< TX bulk lane residence time */
+        LatencyStats<>::Result rxQueue;     /**< RX queue residence time */
+        LatencyStats<>::Result txCoalesceHold;  /**< Coalesced packet hold time */
+        size_t txControlHighWater;          /**< Peak TX control lane occupancy */
+        size_t txBulkHighWater;             /**< Peak TX bulk lane occupancy */
+        size_t rxQueueHighWater;            /**< Peak RX queue occupancy */
+        size_t queueCapacity;               /**< Usable slots per queue */
+        uint64_t coalescedDatagrams;        /**< TX datagrams built by coalescing */
+        uint64_t coalescedPackets;          /**< TX packets carried by them */
+        uint64_t coalesceFlushes[4];        /**< Those datagrams by reason: size, count, deadline, urgent */
+        uint64_t rxDatagrams;               /**< RX datagrams received */
+        uint64_t rxFrames;                  /**< RX frames after unpacking */
+        uint64_t rxBatches;                 /**< decodeBatch() calls on the RX worker */
+        uint64_t rxBatchFrames;             /**< Frames in those batches */
+        uint64_t rxBatchInterleaved;        /**< Frames whose CRC ran in an interleaved group */
+        size_t rxBatchLargest;              /**< Most frames in one batch */
+        uint64_t seqReceived;               /**< Distinct lifesigns received, all senders */
+        uint64_t seqLost;                   /**< Expected but not received */
+        uint32_t seqWindowSpan;             /**< Recent lifesigns the rolling loss covers */
+        uint32_t seqWindowMissing;          /**< Of those, not received */
+        uint64_t seqDuplicates;             /**< Lifesigns received more than once */
+        uint64_t seqReordered;              /**< Lifesigns that filled an earlier gap */
+        uint64_t seqLate;                   /**< Lifesigns older than the window */
+        uint16_t seqMaxReorder;             /**< Largest reorder distance */
+        uint64_t seqReorderHistogram[8];    /**< Reorders by distance: 1, 2, 3-4, 5-8, ..., 65+ */
+        uint8_t fecData;                    /**< FEC group size K (0 = FEC off) */
+        uint8_t fecParity;                  /**< FEC parity packets per group M */
+        uint64_t fecParitySent;             /**< Parity packets encoded */
+        double fecEncodeNs;                 /**< Encode cost per data packet sent */
+        uint64_t fecParityReceived;         /**< Parity packets received */
+        uint64_t fecRecovered;              /**< Lost packets rebuilt from parity */
+        uint64_t fecUnrecoverable;          /**< Lost packets parity could not rebuild */
+        double fecDecodeNs;                 /**< Decode cost per packet received */
+        ThreadTelemetry::Sample rxThread;   /**< RX thread scheduling/fault counters */
+        ThreadTelemetry::Sample txThread;   /**< TX thread scheduling/fault counters */
+        ThreadTelemetry::Sample rxWorker;   /**< RX worker 0 scheduling/fault counters */
+    };
 
 /***********************************************************
  * Constructor/Destructor
@@ -94,8 +152,8 @@ public:
         std::cout << "\033[2J\033[H";
 
         /* Draw initial empty dashboard */
-        LatencyStats<>::Result empty{};
-        drawDashboard(empty, empty, empty);
+        Dashboard empty{};
+        drawDashboard(empty);
 
         /* Set scroll region: lines [HEADER_LINES+1, m_rows] */
         std::cout << "\033[" << (HEADER_LINES + 1) << ";" << m_rows << "r";
@@ -113,13 +171,9 @@ public:
      * Saves cursor position, redraws the dashboard in the fixed
      * upper area, then restores cursor to the scroll region.
      *
-     * @param[in] tx        TX send latency statistics
-     * @param[in] rx        RX processing latency statistics
-     * @param[in] interval  RX inter-packet interval statistics
+     * @param[in] dashboard  Latency, residence and queue occupancy figures
      */
-    void updateStats(const LatencyStats<>::Result& tx,
-                     const LatencyStats<>::Result& rx,
-                     const LatencyStats<>::Result& interval)
+    void updateStats(const Dashboard& dashboard)
     {
         if (m_initialized == false) { return; }
 
@@ -129,7 +183,7 @@ public:
         std::cout << "\033[s";
 
         /* Redraw dashboard */
-        drawDashboard(tx, rx, interval);
+        drawDashboard(dashboard);
 
         /* Restore cursor to previous position in scroll region */
         std::cout << "\033[u" << std::flush;
@@ -182,18 +236,33 @@ private:
     /**
      * @brief Draw the complete dashboard in the upper fixed area
      *
-     * Layout (7 lines):
+     * Layout (23 lines):
      *   Line 1: Title bar (reverse video)
      *   Line 2: Column headers
      *   Line 3: Separator
      *   Line 4: TX Send data row
      *   Line 5: RX Processing data row
      *   Line 6: RX Interval data row
-     *   Line 7: Separator with "Packet Log" label
+     *   Line 7: TX shaping delay data row
+     *   Line 8: TX direct-send end-to-end data row
+     *   Line 9: TX queued end-to-end data row
+     *   Line 10: TX control lane residence data row
+     *   Line 11: TX bulk lane residence data row
+     *   Line 12: RX queue residence data row
+     *   Line 13: TX coalescing hold time data row
+     *   Line 14: Queue high-water-mark gauges
+     *   Line 15: Coalescing: packets per datagram, flush reasons
+     *   Line 16: RX batches: frames per decodeBatch(), CRCs interleaved
+     *   Line 17: Lifesign sequence: loss, rolling loss, duplicates, reordering
+     *   Line 18: Reorder distance histogram
+     *   Line 19: FEC: parity sent/received, rebuilt packets, encode/decode cost
+     *   Line 20: Thread telemetry column headers
+     *   Line 21: RX thread telemetry row
+     *   Line 22: TX thread telemetry row
+     *   Line 23: RX worker telemetry row
+     *   Line 24: Separator with "Packet Log" label
      */
-    void drawDashboard(const LatencyStats<>::Result& tx,
-                       const LatencyStats<>::Result& rx,
-                       const LatencyStats<>::Result& interval)
+    void drawDashboard(const Dashboard& d)
     {
         /* Move cursor to top-left */
         std::cout << "\033[H";
@@ -222,12 +291,91 @@ private:
                   << std::string(static_cast<size_t>(sepLen), '-')
                   << "\033[0m\033[K\n";
 
-        /* Lines 4-6: Data rows */
-        drawDataRow("TX Send", tx);
-        drawDataRow("RX Proc", rx);
-        drawDataRow("RX Intv", interval);
+        /* Lines 4-13: Data rows */
+        drawDataRow("TX Send", d.txSend);
+        drawDataRow("RX Proc", d.rxProc);
+        drawDataRow("RX Intv", d.rxInterval);
+        drawDataRow("TX Shape", d.txShaping);
+        drawDataRow("E2E Dir", d.txDirect);
+        drawDataRow("E2E Que", d.txQueued);
+        drawDataRow("TXQ Ctl", d.txControlQueue);
+        drawDataRow("TXQ Blk", d.txBulkQueue);
+        drawDataRow("RXQ Res", d.rxQueue);
+        drawDataRow("TX Hold", d.txCoalesceHold);
+
+        /* Line 14: Queue high-water marks (of queueCapacity) */
+        std::cout << std::format(" {:<8}Ctl {:>4} {}  Blk {:>4} {}  RX {:>4} {}  /{}",
+                                 "Q HWM",
+                                 d.txControlHighWater, gauge(d.txControlHighWater, d.queueCapacity),
+                                 d.txBulkHighWater, gauge(d.txBulkHighWater, d.queueCapacity),
+                                 d.rxQueueHighWater, gauge(d.rxQueueHighWater, d.queueCapacity),
+                                 d.queueCapacity)
+                  << "\033[K\n";
+
+        /* Line 15: Coalescing gain (packets per datagram) and what sent each datagram */
+        std::cout << std::format(" {:<8} TX {:>5.2f} pkt/dgram  flush size {} count {} deadline {} urgent {}  RX {:>5.2f}",
+                                 "Coalesce",
+                                 ratio(d.coalescedPackets, d.coalescedDatagrams),
+                                 d.coalesceFlushes[0], d.coalesceFlushes[1],
+                                 d.coalesceFlushes[2], d.coalesceFlushes[3],
+                                 ratio(d.rxFrames, d.rxDatagrams))
+                  << "\033[K\n";
+
+        /* Line 16: RX worker batches and the share of CRCs run 4 lanes at a time */
+        std::cout << std::format(" {:<8} {} batches  {:.2f} frames/batch  largest {}  CRC interleaved {:.1f}%",
+                                 "RX batch",
+                                 d.rxBatches,
+                                 ratio(d.rxBatchFrames, d.rxBatches),
+                                 d.rxBatchLargest,
+                                 100.0 * ratio(d.rxBatchInterleaved, d.rxBatchFrames))
+                  << "\033[K\n";
+
+        /* Line 17: Lifesign sequence analytics (loss % of expected, rolling over the window) */
+        std::cout << std::format(" {:<8} rx {} lost {} ({:.2f}%)  roll {:.2f}%  dup {}  reord {}  late {}",
+                                 "Sequence",
+                                 d.seqReceived, d.seqLost,
+                                 100.0 * ratio(d.seqLost, d.seqReceived + d.seqLost),
+                                 100.0 * ratio(d.seqWindowMissing, d.seqWindowSpan),
+                                 d.seqDuplicates, d.seqReordered, d.seqLate)
+                  << "\033[K\n";
+
+        /* Line 18: Reorder distance histogram (in lifesigns) */
+        std::cout << std::format(" {:<8} 1:{} 2:{} 3-4:{} 5-8:{} 9-16:{} 17-32:{} 33-64:{} 65+:{}  max {}",
+                                 "Reorder",
+                                 d.seqReorderHistogram[0], d.seqReorderHistogram[1],
+                                 d.seqReorderHistogram[2], d.seqReorderHistogram[3],
+                                 d.seqReorderHistogram[4], d.seqReorderHistogram[5],
+                                 d.seqReorderHistogram[6], d.seqReorderHistogram[7],
+                                 d.seqMaxReorder)
+                  << "\033[K\n";
+
+        /* Line 19: Forward error correction (costs are averages since start) */
+        if (d.fecData > 0U)
+        {
+            std::cout << std::format(" {:<8} {}+{}  tx parity {} enc {:.0f} ns/pkt  rx parity {} rebuilt {} unrecov {} dec {:.0f} ns/pkt",
+                                     "FEC", d.fecData, d.fecParity,
+                                     d.fecParitySent, d.fecEncodeNs,
+                                     d.fecParityReceived, d.fecRecovered, d.fecUnrecoverable, d.fecDecodeNs)
+                      << "\033[K\n";
+        }
+        else
+        {
+            std::cout << std::format(" {:<8} off", "FEC") << "\033[K\n";
+        }
+
+        /* Line 20: Thread telemetry headers (cumulative since thread start) */
+        std::cout << "\033[2m"     /* Dim */
+                  << std::format(" {:<8}{:>9} {:>9} {:>8} {:>8} {:>10} {:>9} {:>4}",
+                                 "Thread", "csw vol", "csw inv", "flt min", "flt maj",
+                                 "rqwait ms", "cpu ms", "cpu")
+                  << "\033[0m\033[K\n";
+
+        /* Lines 21-23: Thread telemetry rows */
+        drawThreadRow("RX", d.rxThread);
+        drawThreadRow("TX", d.txThread);
+        drawThreadRow("RX Wkr", d.rxWorker);
 
-        /* Line 7: Separator with Packet Log label */
+        /* Line 24: Separator with Packet Log label */
         int leftDash = 20;
         int rightDash = m_cols - leftDash - 14 - 2;  /* 14 = " Packet Log  " */
         if (rightDash < 4)  { rightDash = 4; }
@@ -265,6 +413,58 @@ private:
         }
     }
 
+    /**
+     * @brief Draw a single thread telemetry row in the dashboard
+     *
+     * @param[in] label  Row label (max 8 chars)
+     * @param[in] s      Telemetry sample
+     */
+    void drawThreadRow(const char* label, const ThreadTelemetry::Sample& s)
+    {
+        if (s.valid == false)
+        {
+            std::cout << std::format(" {:<8}{:>9} {:>9} {:>8} {:>8} {:>10} {:>9} {:>4}",
+                                     label, "-", "-", "-", "-", "-", "-", "-")
+                      << "\033[K\n";
+        }
+        else
+        {
+            std::cout << std::format(" {:<8}{:>9} {:>9} {:>8} {:>8} {:>10.3f} {:>9.1f} {:>4}",
+                                     label, s.voluntarySwitches, s.involuntarySwitches,
+                                     s.minorFaults, s.majorFaults,
+                                     static_cast<double>(s.runQueueWaitNs) / 1e6,
+                                     static_cast<double>(s.cpuTimeNs) / 1e6, s.lastCpu)
+                      << "\033[K\n";
+        }
+    }
+
+    /**
+     * @brief Average per unit, 0 before the first unit
+     */
+    static double ratio(uint64_t total, uint64_t units)
+    {
+        return (units > 0U) ? (static_cast<double>(total) / static_cast<double>(units)) : 0.0;
+    }
+
+    /**
+     * @brief Render a fill level as a fixed-width bar, e.g. [###.........]
+     *
+     * @param[in] value     Current level
+     * @param[in] capacity  Full-scale level (0 draws an empty bar)
+     */
+    static std::string gauge(size_t value, size_t capacity)
+    {
+        size_t filled = 0U;
+
+        if (capacity > 0U)
+        {
+            filled = ((value * GAUGE_WIDTH) + capacity - 1U) / capacity;
+            if (filled > GAUGE_WIDTH) { filled = GAUGE_WIDTH; }
+        }
+
+        return "[" + std::string(filled, '#') + std::string(GAUGE_WIDTH - filled, '.') + "]";
+    }
+
 /***********************************************************
  * Data
  **********************************************************/
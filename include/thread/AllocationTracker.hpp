@@ -0,0 +1,87 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AllocationTracker.hpp
+ * @ingroup thread
+ * @brief Heap allocation detector for RT threads (instrumentation build)
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_ALLOCATIONTRACKER_HPP
+#define AGENT_TEAM_TEST_THREAD_ALLOCATIONTRACKER_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Counts heap allocations made by registered threads
+ *
+ * Built with -DENABLE_ALLOC_TRACKING=ON, malloc/calloc/realloc and the
+ * global operator new are replaced by wrappers that forward to glibc and,
+ * on a registered thread, count the call and record its caller address.
+ * Allocations after the thread's warm-up are recorded per call site and
+ * can abort the process on the spot (stack trace in the core dump).
+ *
+ * Without the option every method is a no-op and isCompiledIn() is false,
+ * so callers need no #ifdefs. The bookkeeping itself never allocates:
+ * fixed slot and site tables, written only by the owning thread.
+ */
+class AllocationTracker
+{
+public:
+    /** Registered threads tracked at the same time */
+    static constexpr size_t MAX_THREADS = 16U;
+
+    /** Distinct call sites recorded per thread */
+    static constexpr size_t MAX_SITES = 64U;
+
+public:
+    /**
+     * @brief Whether the allocator wrappers are linked in
+     */
+    static bool isCompiledIn();
+
+    /**
+     * @brief Start tracking the calling thread
+     *
+     * Re-registering a name (thread restarted) reuses and clears its slot.
+     *
+     * @param name Thread name used in reports (copied)
+     * @param warmupMs Allocations before this are counted only
+     * @param abortAfterWarmup Abort on the first allocation after warm-up
+     * @return true if the thread is tracked
+     */
+    static bool registerThread(const char* name, uint32_t warmupMs, bool abortAfterWarmup);
+
+    /**
+     * @brief Stop tracking the calling thread (counts are kept for report())
+     */
+    static void unregisterThread();
+
+    /**
+     * @brief Allocations after warm-up of all registered threads
+     */
+    static uint64_t getAllocationsAfterWarmup();
+
+    /**
+     * @brief Print per-thread counts and the busiest post-warm-up call sites
+     *
+     * Resolves sites with dladdr(); link with ENABLE_EXPORTS (-rdynamic) for
+     * symbol names, or pass the printed offsets to addr2line -f -C -e <binary>.
+     */
+    static void report(std::ostream& out);
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_ALLOCATIONTRACKER_HPP
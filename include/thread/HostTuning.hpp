@@ -0,0 +1,108 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file HostTuning.hpp
+ * @ingroup thread
+ * @brief CPU power-state control and host tuning checks for RT cores
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_HOSTTUNING_HPP
+#define AGENT_TEAM_TEST_THREAD_HOSTTUNING_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Holds a PM QoS CPU latency request and audits the RT cores
+ *
+ * The kernel honours a /dev/cpu_dma_latency request only while the file
+ * stays open, so the descriptor is kept until releaseDmaLatency() or
+ * destruction. checkCores() reads sysfs/procfs only and never changes
+ * host settings; each finding is printed as a warning.
+ */
+class HostTuning
+{
+public:
+    HostTuning();
+    ~HostTuning();
+
+    HostTuning(const HostTuning&) = delete;
+    HostTuning& operator=(const HostTuning&) = delete;
+
+    /**
+     * @brief Request a maximum C-state exit latency for all CPUs
+     *
+     * @param latencyUs Allowed wake-up latency (0 = stay in C0/C1)
+     * @return true if the request is held. Needs write access to /dev/cpu_dma_latency.
+     */
+    bool holdDmaLatency(int32_t latencyUs);
+
+    /**
+     * @brief Drop the latency request (deep C-states allowed again)
+     */
+    void releaseDmaLatency();
+
+    /**
+     * @brief Whether a latency request is currently held
+     */
+    bool isDmaLatencyHeld() const { return m_dmaLatencyFd >= 0; }
+
+    /**
+     * @brief Latency currently requested (valid while held)
+     */
+    int32_t getDmaLatencyUs() const { return m_dmaLatencyUs; }
+
+    /**
+     * @brief Check governor, isolation and IRQ affinity of the given cores
+     *
+     * Per core: cpufreq governor is "performance", the core is in isolcpus
+     * and nohz_full, and no IRQ of the NIC (nor, when known, any other IRQ)
+     * is allowed to run on it.
+     *
+     * @param cores Pinned cores (negative entries are skipped)
+     * @param ifname NIC whose IRQs are checked (empty = none)
+     * @return Number of findings (0 = host tuned as expected)
+     */
+    size_t checkCores(const std::vector<int>& cores, const std::string& ifname) const;
+
+    /**
+     * @brief Read the cpufreq scaling governor of a CPU
+     *
+     * @return Governor name, empty if cpufreq is not available (e.g. VMs)
+     */
+    static std::string readGovernor(int cpu);
+
+private:
+    /**
+     * @brief One line of /proc/interrupts
+     */
+    struct IrqInfo
+    {
+        int irq;                /**< IRQ number */
+        std::string name;       /**< Trailing chip/device description */
+        std::vector<int> cpus;  /**< Effective (or configured) affinity */
+    };
+
+    static bool readCpuListFile(const std::string& path, std::vector<int>& cpus);
+    static std::vector<IrqInfo> readIrqs();
+
+private:
+    int m_dmaLatencyFd;     /**< Open /dev/cpu_dma_latency, or -1 */
+    int32_t m_dmaLatencyUs; /**< Value written to m_dmaLatencyFd */
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_HOSTTUNING_HPP
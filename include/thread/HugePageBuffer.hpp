@@ -0,0 +1,185 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file HugePageBuffer.hpp
+ * @ingroup thread
+ * @brief Huge-page backed, prefaulted and mlock'd memory for RT data structures
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_HUGEPAGEBUFFER_HPP
+#define AGENT_TEAM_TEST_THREAD_HUGEPAGEBUFFER_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Anonymous memory mapping placed on 2 MiB huge pages when possible
+ *
+ * Allocation tries, in order:
+ *   1. Explicit huge pages (MAP_HUGETLB, needs vm.nr_hugepages)
+ *   2. Transparent huge pages (2 MiB aligned mapping + MADV_HUGEPAGE)
+ *   3. Standard 4 KiB pages
+ *
+ * The mapping is prefaulted on allocation so the first access from an RT
+ * thread never takes a page fault, and can be mlock'd to keep it resident.
+ * When a NUMA node is given, pages are bound to it before the first touch.
+ */
+class HugePageBuffer
+{
+public:
+    enum class Backing
+    {
+        None,
+        HugeTlb,                /**< MAP_HUGETLB explicit huge pages */
+        TransparentHugePage,    /**< THP via madvise(MADV_HUGEPAGE) */
+        StandardPage            /**< Regular 4 KiB pages */
+    };
+
+    static constexpr size_t HUGE_PAGE_SIZE = 2U * 1024U * 1024U;
+
+public:
+    HugePageBuffer();
+    ~HugePageBuffer();
+
+    /* Non-copyable */
+    HugePageBuffer(const HugePageBuffer&) = delete;
+    HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+    /**
+     * @brief Map and prefault memory for the given size
+     *
+     * @param size Requested size in bytes
+     * @param useHugePages Try huge pages first (falls back to 4 KiB pages)
+     * @param numaNode Preferred NUMA node for the pages (-1 = first-touch default)
+     * @return true if a mapping was obtained (with any backing)
+     */
+    bool allocate(size_t size, bool useHugePages, int numaNode = -1);
+
+    /**
+     * @brief Touch every page so all page faults happen now
+     */
+    void prefault();
+
+    /**
+     * @brief Lock the mapping into RAM (mlock)
+     *
+     * @return true if locked. Needs CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK.
+     */
+    bool lock();
+
+    /**
+     * @brief Unlock and unmap the memory
+     */
+    void release();
+
+    void* data() const { return m_base; }
+    size_t size() const { return m_size; }
+    size_t mappedSize() const { return m_mappedSize; }
+    Backing getBacking() const { return m_backing; }
+    bool isLocked() const { return m_locked; }
+    int getNumaNode() const { return m_numaNode; }
+
+    /**
+     * @brief Human-readable name of a backing type
+     */
+    static const char* backingName(Backing backing);
+
+private:
+    bool mapHugeTlb(size_t size);
+    bool mapTransparent(size_t size);
+    bool mapStandard(size_t size);
+
+private:
+    void* m_base;           /**< Start of usable (aligned) region */
+    size_t m_size;          /**< Requested size */
+    size_t m_mappedSize;    /**< Size actually mapped (page rounded) */
+    Backing m_backing;
+    bool m_locked;
+    int m_numaNode;         /**< Node pages were bound to (-1 = none) */
+};
+
+/**
+ * @brief Object of type T constructed in place inside a HugePageBuffer
+ *
+ * Owns both the mapping and the object lifetime. Intended for large,
+ * long-lived structures touched by RT threads (ring buffers, statistics).
+ */
+template<typename T>
+class HugePageObject
+{
+public:
+    HugePageObject() : m_object(nullptr) {}
+    ~HugePageObject() { destroy(); }
+
+    /* Non-copyable */
+    HugePageObject(const HugePageObject&) = delete;
+    HugePageObject& operator=(const HugePageObject&) = delete;
+
+    /**
+     * @brief Allocate, prefault and construct the object
+     *
+     * @param useHugePages Try huge pages first
+     * @param numaNode Preferred NUMA node (-1 = no binding)
+     * @param args Constructor arguments for T
+     * @return true if the object was constructed
+     */
+    template<typename... Args>
+    bool create(bool useHugePages, int numaNode, Args&&... args)
+    {
+        bool result = false;
+
+        destroy();
+
+        if (m_buffer.allocate(sizeof(T), useHugePages, numaNode) == true)
+        {
+            m_object = new (m_buffer.data()) T(std::forward<Args>(args)...);
+            result = true;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Destroy the object and release the mapping
+     */
+    void destroy()
+    {
+        if (m_object != nullptr)
+        {
+            m_object->~T();
+            m_object = nullptr;
+        }
+        m_buffer.release();
+    }
+
+    bool lock() { return m_buffer.lock(); }
+    bool isValid() const { return m_object != nullptr; }
+    const HugePageBuffer& buffer() const { return m_buffer; }
+
+    T* get() const { return m_object; }
+
+    /* Dereferencing before a successful create() is a caller bug: check isValid() or use get() */
+    T* operator->() const { assert(m_object != nullptr); return m_object; }
+    T& operator*() const { assert(m_object != nullptr); return *m_object; }
+
+private:
+    HugePageBuffer m_buffer;
+    T* m_object;
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_HUGEPAGEBUFFER_HPP
@@ -17,10 +17,48 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
 #include <atomic>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <thread>
+#include <sys/uio.h>
+
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief What push() does when the ring is full
+ */
+enum class RingOverflowPolicy
+{
+    DropNewest,     /**< Reject the new packet (default) */
+    DropOldest,     /**< Discard the oldest queued packet to make room (state traffic) */
+    Block           /**< Wait for space up to a timeout, then reject (command traffic) */
+};
+
+/**
+ * @brief Per-outcome overflow counters (producer side)
+ */
+struct RingOverflowStats
+{
+    uint64_t droppedNewest;   /**< Packets rejected (DropNewest, or oversize) */
+    uint64_t droppedOldest;   /**< Queued packets discarded to make room */
+    uint64_t blocked;         /**< Pushes that had to wait for space */
+    uint64_t blockTimeouts;   /**< Waits that timed out (packet rejected) */
+};
+
+/**
+ * @brief Producer-side metadata stored alongside each packet
+ */
+struct RingSlotMetadata
+{
+    uint64_t enqueueTicks;    /**< TscClock ticks at push (0 = not stamped) */
+    uint64_t sequence;        /**< Push order, assigned by the ring */
+};
 
 /*******************************************************************************
  * Template Class Declaration
@@ -32,6 +70,18 @@
  * Single Producer Single Consumer (SPSC) ring buffer optimized for
  * low-latency inter-thread communication. Cache-line aligned to prevent
  * false sharing between producer and consumer.
+ *
+ * Overflow handling is selected with setOverflowPolicy() before the ring is
+ * used. With DropOldest the producer advances the read index itself, so the
+ * consumer copies a slot first and then claims it with a CAS; if the
+ * producer discarded the slot meanwhile, the copy is thrown away. The
+ * producer may be rewriting that slot while it is copied, so under
+ * DropOldest both sides access slots with relaxed 8-byte atomics (a torn
+ * copy is harmless, a data race would not be).
+ *
+ * Each slot also carries RingSlotMetadata so the consumer can measure how
+ * long a packet sat in the queue, and the producer tracks the peak
+ * occupancy (high-water mark) without any extra shared-cache-line traffic.
  */
 template<size_t MaxPacketSize = 2048, size_t Capacity = 1024>
 class LockFreeRingBuffer
@@ -40,49 +90,218 @@ public:
     struct Packet
     {
         uint16_t length;
-        uint8_t data[MaxPacketSize];
+        RingSlotMetadata meta;
+        alignas(8) uint8_t data[MaxPacketSize];    /**< Whole words for the DropOldest copies */
     };
 
+    static_assert((MaxPacketSize % sizeof(uint64_t)) == 0U, "Slot data is copied in 8-byte words");
+
+    /** Most packets handed to one consumeBatch() handler call */
+    static constexpr size_t BATCH_MAX = 64U;
+
 private:
     std::array<Packet, Capacity> m_buffer;
     
     // Cache line alignment to prevent false sharing
     alignas(64) std::atomic<size_t> m_writeIdx;
+    RingOverflowPolicy m_policy;
+    std::chrono::nanoseconds m_blockTimeout;
+    std::atomic<uint64_t> m_droppedNewest;     /**< Producer-owned counters */
+    std::atomic<uint64_t> m_droppedOldest;
+    std::atomic<uint64_t> m_blocked;
+    std::atomic<uint64_t> m_blockTimeouts;
+    std::atomic<size_t> m_highWaterMark;       /**< Peak occupancy seen by push() */
+    uint64_t m_nextSequence;
+    size_t m_reservedOccupancy;                /**< Occupancy once the reserved slot commits */
     alignas(64) std::atomic<size_t> m_readIdx;
     
 public:
-    LockFreeRingBuffer() : m_writeIdx(0), m_readIdx(0) {}
+    LockFreeRingBuffer()
+        : m_writeIdx(0)
+        , m_policy(RingOverflowPolicy::DropNewest)
+        , m_blockTimeout(0)
+        , m_droppedNewest(0)
+        , m_droppedOldest(0)
+        , m_blocked(0)
+        , m_blockTimeouts(0)
+        , m_highWaterMark(0)
+        , m_nextSequence(0)
+        , m_reservedOccupancy(0)
+        , m_readIdx(0)
+    {
+    }
+    
+    /**
+     * @brief Select overflow behaviour (call before producer/consumer start)
+     * 
+     * @param policy Overflow policy
+     * @param blockTimeout Maximum wait for the Block policy
+     */
+    void setOverflowPolicy(RingOverflowPolicy policy, std::chrono::nanoseconds blockTimeout)
+    {
+        m_policy = policy;
+        m_blockTimeout = blockTimeout;
+    }
+    
+    RingOverflowPolicy getOverflowPolicy() const { return m_policy; }
+    
+    /**
+     * @brief Snapshot of the per-outcome overflow counters
+     */
+    RingOverflowStats getOverflowStats() const
+    {
+        return RingOverflowStats{
+            m_droppedNewest.load(std::memory_order_relaxed),
+            m_droppedOldest.load(std::memory_order_relaxed),
+            m_blocked.load(std::memory_order_relaxed),
+            m_blockTimeouts.load(std::memory_order_relaxed)};
+    }
+    
+    /**
+     * @brief Peak number of queued packets since construction
+     */
+    size_t getHighWaterMark() const
+    {
+        return m_highWaterMark.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Usable slots (one slot is kept free to tell full from empty)
+     */
+    static constexpr size_t capacity() { return Capacity - 1U; }
     
     /**
      * @brief Push packet to ring buffer (Producer)
      * 
      * @param data Pointer to packet data
      * @param length Length of packet data
+     * @param enqueueTicks Timestamp stored in the slot metadata (0 = none)
      * @return true if successful, false if buffer is full
      */
-    bool push(const uint8_t* data, size_t length)
+    bool push(const uint8_t* data, size_t length, uint64_t enqueueTicks = 0U)
     {
-        if (length > MaxPacketSize)
+        uint8_t* slot = reserve(length);
+        
+        if (slot == nullptr)
         {
             return false;
         }
         
+        copyIn(slot, data, length);
+        commit(length, enqueueTicks);
+        return true;
+    }
+    
+    /**
+     * @brief Push one packet gathered from several buffers (Producer)
+     * 
+     * The pieces are copied straight into the slot, e.g. an encoded header
+     * and footer around a payload that stays where the application keeps it.
+     * 
+     * @param iov Buffers in packet order
+     * @param iovcnt Number of buffers
+     * @param enqueueTicks Timestamp stored in the slot metadata (0 = none)
+     * @return true if successful, false if buffer is full or packet too large
+     */
+    bool pushv(const struct iovec* iov, size_t iovcnt, uint64_t enqueueTicks = 0U)
+    {
+        size_t length = 0U;
+        
+        for (size_t i = 0U; i < iovcnt; i++)
+        {
+            length += iov[i].iov_len;
+        }
+        
+        uint8_t* slot = reserve(length);
+        
+        if (slot == nullptr)
+        {
+            return false;
+        }
+        
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            // Gather first: the slot itself is only written in atomic words
+            alignas(8) uint8_t staging[MaxPacketSize];
+            gather(staging, iov, iovcnt);
+            copyIn(slot, staging, length);
+        }
+        else
+        {
+            gather(slot, iov, iovcnt);
+        }
+        commit(length, enqueueTicks);
+        return true;
+    }
+    
+    /**
+     * @brief Claim the next slot for writing in place (Producer)
+     * 
+     * Applies the overflow policy like push(). The slot stays invisible to
+     * the consumer until commit(); a reservation that is never committed is
+     * simply reused by the next reserve(). Under DropOldest the consumer may
+     * still be copying the slot, so write it through push() / pushv() only.
+     * 
+     * @param length Bytes that will be written (at most MaxPacketSize)
+     * @return Slot data area, nullptr if the packet is too large or no room
+     */
+    uint8_t* reserve(size_t length)
+    {
+        if (length > MaxPacketSize)
+        {
+            m_droppedNewest.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        
         size_t currentWrite = m_writeIdx.load(std::memory_order_relaxed);
         size_t nextWrite = (currentWrite + 1) % Capacity;
+        size_t currentRead = m_readIdx.load(std::memory_order_acquire);
+        m_reservedOccupancy = ((nextWrite + Capacity) - currentRead) % Capacity;
         
         // Check if buffer is full
-        if (nextWrite == m_readIdx.load(std::memory_order_acquire))
+        if (nextWrite == currentRead)
         {
-            return false;
+            if (makeRoom(nextWrite) == false)
+            {
+                return nullptr;
+            }
+            m_reservedOccupancy = Capacity - 1U;
         }
         
-        // Write data
-        m_buffer[currentWrite].length = static_cast<uint16_t>(length);
-        std::memcpy(m_buffer[currentWrite].data, data, length);
+        return m_buffer[currentWrite].data;
+    }
+    
+    /**
+     * @brief Publish the slot returned by the last reserve() (Producer)
+     * 
+     * @param length Bytes written to the slot (at most the reserved length)
+     * @param enqueueTicks Timestamp stored in the slot metadata (0 = none)
+     */
+    void commit(size_t length, uint64_t enqueueTicks = 0U)
+    {
+        size_t currentWrite = m_writeIdx.load(std::memory_order_relaxed);
+        Packet& slot = m_buffer[currentWrite];
+        
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            std::atomic_ref<uint16_t>(slot.length).store(static_cast<uint16_t>(length), std::memory_order_relaxed);
+            std::atomic_ref<uint64_t>(slot.meta.enqueueTicks).store(enqueueTicks, std::memory_order_relaxed);
+            std::atomic_ref<uint64_t>(slot.meta.sequence).store(m_nextSequence++, std::memory_order_relaxed);
+        }
+        else
+        {
+            slot.length = static_cast<uint16_t>(length);
+            slot.meta.enqueueTicks = enqueueTicks;
+            slot.meta.sequence = m_nextSequence++;
+        }
         
         // Publish write
-        m_writeIdx.store(nextWrite, std::memory_order_release);
-        return true;
+        m_writeIdx.store((currentWrite + 1) % Capacity, std::memory_order_release);
+        
+        if (m_reservedOccupancy > m_highWaterMark.load(std::memory_order_relaxed))
+        {
+            m_highWaterMark.store(m_reservedOccupancy, std::memory_order_relaxed);
+        }
     }
     
     /**
@@ -91,30 +310,147 @@ public:
      * @param data Pointer to output buffer
      * @param maxLength Maximum length of output buffer
      * @param actualLength Actual length of packet read
+     * @param meta Optional output for the slot metadata
      * @return true if successful, false if buffer is empty
      */
-    bool pop(uint8_t* data, size_t maxLength, size_t& actualLength)
+    bool pop(uint8_t* data, size_t maxLength, size_t& actualLength,
+             RingSlotMetadata* meta = nullptr)
     {
-        size_t currentRead = m_readIdx.load(std::memory_order_relaxed);
+        bool result = false;
+        bool retry = false;
         
-        // Check if buffer is empty
-        if (currentRead == m_writeIdx.load(std::memory_order_acquire))
+        do
         {
-            return false;
+            size_t currentRead = m_readIdx.load(std::memory_order_acquire);
+            retry = false;
+            
+            // Check if buffer is empty
+            if (currentRead != m_writeIdx.load(std::memory_order_acquire))
+            {
+                // Read data
+                Packet& slot = m_buffer[currentRead];
+                actualLength = loadLength(slot);
+                if (actualLength <= maxLength)
+                {
+                    copyOut(data, slot, actualLength);
+                    if (meta != nullptr)
+                    {
+                        *meta = loadMeta(slot);
+                    }
+                    
+                    // Publish read (claim the slot; lost only to a DropOldest producer)
+                    result = claim(currentRead);
+                    retry = (result == false);
+                }
+            }
         }
+        while (retry == true);
+        
+        return result;
+    }
+    
+    /**
+     * @brief Consume up to maxCount packets in place (Consumer)
+     *
+     * Zero-copy batch pop: the handler sees each packet directly in its
+     * slot, and the read index is published once for the whole batch.
+     * Under DropOldest each packet is copied and claimed individually.
+     *
+     * @param handler Callable as
+     *        handler(const uint8_t* data, size_t length, const RingSlotMetadata& meta)
+     * @param maxCount Maximum number of packets to consume
+     * @return Number of packets consumed (0 if buffer is empty)
+     */
+    template<typename Handler>
+    size_t consume(Handler&& handler, size_t maxCount)
+    {
+        size_t count = 0U;
         
-        // Read data
-        actualLength = m_buffer[currentRead].length;
-        if (actualLength > maxLength)
+        if (m_policy == RingOverflowPolicy::DropOldest)
         {
-            return false;
+            // Producer may reclaim slots: copy out and claim one packet at a time
+            uint8_t copy[MaxPacketSize];
+            size_t length = 0U;
+            RingSlotMetadata meta{};
+            
+            while ((count < maxCount) && (pop(copy, sizeof(copy), length, &meta) == true))
+            {
+                handler(static_cast<const uint8_t*>(copy), length,
+                        static_cast<const RingSlotMetadata&>(meta));
+                count++;
+            }
         }
+        else
+        {
+            size_t currentRead = m_readIdx.load(std::memory_order_relaxed);
+            size_t available = ((m_writeIdx.load(std::memory_order_acquire) + Capacity) - currentRead) % Capacity;
+            count = (available < maxCount) ? available : maxCount;
+            
+            for (size_t i = 0U; i < count; i++)
+            {
+                const Packet& packet = m_buffer[(currentRead + i) % Capacity];
+                handler(packet.data, static_cast<size_t>(packet.length), packet.meta);
+            }
+            
+            if (count > 0U)
+            {
+                // Publish read for the whole batch
+                m_readIdx.store((currentRead + count) % Capacity, std::memory_order_release);
+            }
+        }
+        return count;
+    }
+    
+    /**
+     * @brief Consume up to maxCount packets as one batch (Consumer)
+     *
+     * Like consume(), but the handler sees every packet of the batch in a
+     * single call (e.g. to check their CRCs together) before the read index
+     * moves. Under DropOldest each packet is copied and is a batch of one.
+     *
+     * @param handler Callable as
+     *        handler(const struct iovec* frames, const RingSlotMetadata* const* meta, size_t count)
+     * @param maxCount Maximum number of packets (at most BATCH_MAX are taken)
+     * @return Number of packets consumed (0 if buffer is empty)
+     */
+    template<typename Handler>
+    size_t consumeBatch(Handler&& handler, size_t maxCount)
+    {
+        size_t count = 0U;
         
-        std::memcpy(data, m_buffer[currentRead].data, actualLength);
-        
-        // Publish read
-        m_readIdx.store((currentRead + 1) % Capacity, std::memory_order_release);
-        return true;
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            count = consume([&handler](const uint8_t* data, size_t length, const RingSlotMetadata& meta) {
+                struct iovec frame = {const_cast<uint8_t*>(data), length};
+                const RingSlotMetadata* slotMeta = &meta;
+                handler(static_cast<const struct iovec*>(&frame), &slotMeta, static_cast<size_t>(1U));
+            }, maxCount);
+        }
+        else
+        {
+            struct iovec frames[BATCH_MAX];
+            const RingSlotMetadata* meta[BATCH_MAX];
+            size_t currentRead = m_readIdx.load(std::memory_order_relaxed);
+            size_t available = ((m_writeIdx.load(std::memory_order_acquire) + Capacity) - currentRead) % Capacity;
+            count = std::min({available, maxCount, BATCH_MAX});
+            
+            for (size_t i = 0U; i < count; i++)
+            {
+                Packet& packet = m_buffer[(currentRead + i) % Capacity];
+                frames[i] = {packet.data, static_cast<size_t>(packet.length)};
+                meta[i] = &packet.meta;
+            }
+            
+            if (count > 0U)
+            {
+                handler(static_cast<const struct iovec*>(frames), static_cast<const RingSlotMetadata* const*>(meta),
+                        count);
+                
+                // Publish read for the whole batch
+                m_readIdx.store((currentRead + count) % Capacity, std::memory_order_release);
+            }
+        }
+        return count;
     }
     
     /**
@@ -127,6 +463,31 @@ public:
         return (w >= r) ? (w - r) : (Capacity - r + w);
     }
     
+    /**
+     * @brief Length of the packet at the head without removing it (Consumer)
+     *
+     * Lets the consumer decide (e.g. rate shaping) before committing to pop().
+     * Under DropOldest the producer may discard the head meanwhile, so the
+     * next pop() can return a different packet.
+     *
+     * @param length Length of the head packet
+     * @return true if a packet is queued
+     */
+    bool peekLength(size_t& length) const
+    {
+        bool result = false;
+        size_t currentRead = m_readIdx.load(std::memory_order_acquire);
+        
+        if (currentRead != m_writeIdx.load(std::memory_order_acquire))
+        {
+            // atomic_ref of a const object is C++26: the load does not write
+            length = loadLength(const_cast<Packet&>(m_buffer[currentRead]));
+            result = true;
+        }
+        
+        return result;
+    }
+    
     /**
      * @brief Check if buffer is empty
      */
@@ -145,6 +506,161 @@ public:
         size_t nextWrite = (currentWrite + 1) % Capacity;
         return nextWrite == m_readIdx.load(std::memory_order_acquire);
     }
+
+private:
+    /**
+     * @brief Copy iovec pieces back to back into dst
+     */
+    static void gather(uint8_t* dst, const struct iovec* iov, size_t iovcnt)
+    {
+        for (size_t i = 0U, offset = 0U; i < iovcnt; offset += iov[i].iov_len, i++)
+        {
+            if (iov[i].iov_len > 0U)
+            {
+                std::memcpy(&dst[offset], iov[i].iov_base, iov[i].iov_len);
+            }
+        }
+    }
+    
+    /**
+     * @brief Write packet bytes into a reserved slot (Producer)
+     */
+    void copyIn(uint8_t* slot, const uint8_t* data, size_t length)
+    {
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            for (size_t offset = 0U; offset < length; offset += sizeof(uint64_t))
+            {
+                uint64_t word = 0U;
+                
+                std::memcpy(&word, &data[offset], std::min(sizeof(uint64_t), length - offset));
+                std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(&slot[offset]))
+                    .store(word, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            std::memcpy(slot, data, length);
+        }
+    }
+    
+    /**
+     * @brief Read packet bytes out of a slot before claiming it (Consumer)
+     */
+    void copyOut(uint8_t* data, Packet& slot, size_t length) const
+    {
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            for (size_t offset = 0U; offset < length; offset += sizeof(uint64_t))
+            {
+                uint64_t word = std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(&slot.data[offset]))
+                                    .load(std::memory_order_relaxed);
+                
+                std::memcpy(&data[offset], &word, std::min(sizeof(uint64_t), length - offset));
+            }
+        }
+        else
+        {
+            std::memcpy(data, slot.data, length);
+        }
+    }
+    
+    size_t loadLength(Packet& slot) const
+    {
+        return (m_policy == RingOverflowPolicy::DropOldest) ?
+               std::atomic_ref<uint16_t>(slot.length).load(std::memory_order_relaxed) : slot.length;
+    }
+    
+    RingSlotMetadata loadMeta(Packet& slot) const
+    {
+        RingSlotMetadata meta{};
+        
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            meta.enqueueTicks = std::atomic_ref<uint64_t>(slot.meta.enqueueTicks).load(std::memory_order_relaxed);
+            meta.sequence = std::atomic_ref<uint64_t>(slot.meta.sequence).load(std::memory_order_relaxed);
+        }
+        else
+        {
+            meta = slot.meta;
+        }
+        
+        return meta;
+    }
+    
+    /**
+     * @brief Apply the overflow policy when the ring is full (Producer)
+     * 
+     * @param nextWrite Write index after the pending push
+     * @return true if a slot is now free for the pending push
+     */
+    bool makeRoom(size_t nextWrite)
+    {
+        bool result = false;
+        
+        switch (m_policy)
+        {
+            case RingOverflowPolicy::DropOldest:
+            {
+                size_t oldest = nextWrite;
+                
+                // Lost CAS means the consumer just freed that slot itself
+                if (m_readIdx.compare_exchange_strong(oldest, (oldest + 1) % Capacity,
+                                                      std::memory_order_acq_rel) == true)
+                {
+                    m_droppedOldest.fetch_add(1, std::memory_order_relaxed);
+                }
+                result = true;
+                break;
+            }
+            case RingOverflowPolicy::Block:
+            {
+                auto deadline = std::chrono::steady_clock::now() + m_blockTimeout;
+                
+                m_blocked.fetch_add(1, std::memory_order_relaxed);
+                do
+                {
+                    std::this_thread::yield();
+                    result = (nextWrite != m_readIdx.load(std::memory_order_acquire));
+                }
+                while ((result == false) && (std::chrono::steady_clock::now() < deadline));
+                
+                if (result == false)
+                {
+                    m_blockTimeouts.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            }
+            default:
+                m_droppedNewest.fetch_add(1, std::memory_order_relaxed);
+                break;
+        }
+        
+        return result;
+    }
+    
+    /**
+     * @brief Advance the read index past a consumed slot (Consumer)
+     * 
+     * @return false if a DropOldest producer discarded the slot first
+     */
+    bool claim(size_t currentRead)
+    {
+        bool result = true;
+        size_t nextRead = (currentRead + 1) % Capacity;
+        
+        if (m_policy == RingOverflowPolicy::DropOldest)
+        {
+            result = m_readIdx.compare_exchange_strong(currentRead, nextRead,
+                                                       std::memory_order_acq_rel);
+        }
+        else
+        {
+            m_readIdx.store(nextRead, std::memory_order_release);
+        }
+        
+        return result;
+    }
 };
 
 #endif  // AGENT_TEAM_TEST_THREAD_LOCKFREERINGBUFFER_HPP
@@ -0,0 +1,95 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file NumaTopology.hpp
+ * @ingroup thread
+ * @brief NUMA topology discovery from sysfs and node-local memory binding
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_NUMATOPOLOGY_HPP
+#define AGENT_TEAM_TEST_THREAD_NUMATOPOLOGY_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief CPU-to-node map read from /sys/devices/system/node
+ *
+ * No libnuma dependency: topology comes from sysfs and memory placement
+ * uses the raw mbind() system call. On hosts without NUMA support every
+ * query returns -1 ("unknown node") and binding becomes a no-op.
+ */
+class NumaTopology
+{
+public:
+    /** Highest node count supported by the mbind() node mask */
+    static constexpr int MAX_NODES = 64;
+
+public:
+    NumaTopology();
+
+    /**
+     * @brief Read node/CPU layout from sysfs
+     *
+     * @return true if at least one node was found
+     */
+    bool initialize();
+
+    /**
+     * @brief Number of online NUMA nodes (0 if unknown)
+     */
+    int getNodeCount() const { return m_nodeCount; }
+
+    /**
+     * @brief Get the NUMA node owning a CPU
+     *
+     * @param cpu CPU index (negative = unpinned)
+     * @return Node index, or -1 if unknown
+     */
+    int getNodeOfCpu(int cpu) const;
+
+    /**
+     * @brief Get the NUMA node a network interface is attached to
+     *
+     * @param ifname Interface name (e.g. "eth0")
+     * @return Node index, or -1 for virtual devices / unknown
+     */
+    static int getNodeOfNetDevice(const std::string& ifname);
+
+    /**
+     * @brief Parse a sysfs CPU list such as "0-3,8,10-11"
+     *
+     * @param list CPU list text
+     * @param cpus Parsed CPU indexes (appended)
+     * @return true if the whole list parsed
+     */
+    static bool parseCpuList(const std::string& list, std::vector<int>& cpus);
+
+    /**
+     * @brief Prefer allocating the pages of a (not yet faulted) range on a node
+     *
+     * Uses MPOL_PREFERRED so allocation still succeeds when the node is full.
+     *
+     * @return true if the policy was applied
+     */
+    static bool bindMemory(void* addr, size_t length, int node);
+
+private:
+    std::vector<int> m_cpuToNode;   /**< Index: CPU, value: node */
+    int m_nodeCount;
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_NUMATOPOLOGY_HPP
@@ -0,0 +1,156 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file RealtimeProfile.hpp
+ * @ingroup thread
+ * @brief Process-wide low-latency hardening and per-thread page-fault checks
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_REALTIMEPROFILE_HPP
+#define AGENT_TEAM_TEST_THREAD_REALTIMEPROFILE_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <pthread.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "thread/HugePageBuffer.hpp"
+#include "timer/TscClock.hpp"
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Steps that keep RT threads from taking page faults once running
+ *
+ *   - lockAllMemory(): mlockall(MCL_CURRENT | MCL_FUTURE)
+ *   - disableMallocTrim(): glibc never returns heap to the kernel, and large
+ *     blocks come from the (locked) heap instead of fresh mmap()s
+ *   - reserveHeap(): touch a heap block once so later allocations reuse
+ *     already-faulted pages
+ *   - allocateStack(): preallocated, prefaulted, node-local thread stacks
+ *     with a guard page, for pthread_attr_setstack()
+ */
+class RealtimeProfile
+{
+public:
+    /**
+     * @brief Page-fault counters of one thread (getrusage RUSAGE_THREAD)
+     */
+    struct FaultCounters
+    {
+        uint64_t minor;     /**< Faults served without I/O */
+        uint64_t major;     /**< Faults that needed I/O */
+    };
+
+    /** Default stack size for RT threads */
+    static constexpr size_t DEFAULT_STACK_SIZE = 512U * 1024U;
+
+public:
+    /**
+     * @brief Lock current and future mappings into RAM
+     *
+     * @return true on success. Needs CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK.
+     */
+    static bool lockAllMemory();
+
+    /**
+     * @brief Stop glibc from trimming the heap or serving blocks with mmap()
+     */
+    static bool disableMallocTrim();
+
+    /**
+     * @brief Fault in a block of heap, then free it back to malloc
+     *
+     * @param size Bytes to reserve (0 = none)
+     */
+    static void reserveHeap(size_t size);
+
+    /**
+     * @brief Map and prefault a thread stack, with a PROT_NONE guard page at the bottom
+     *
+     * @param stack Buffer receiving the mapping
+     * @param size Usable stack size (rounded up to PTHREAD_STACK_MIN)
+     * @param numaNode Preferred NUMA node (-1 = no binding)
+     * @return true if the stack is ready
+     */
+    static bool allocateStack(HugePageBuffer& stack, size_t size, int numaNode);
+
+    /**
+     * @brief Point thread attributes at a stack from allocateStack()
+     */
+    static bool setStack(pthread_attr_t& attr, const HugePageBuffer& stack);
+
+    /**
+     * @brief Page faults taken so far by the calling thread
+     */
+    static FaultCounters getThreadFaults();
+};
+
+/**
+ * @brief Counts the page faults a thread takes after its warm-up period
+ *
+ * Owned and driven by the monitored thread itself (getrusage only reports
+ * on the calling thread): begin() at thread start, poll() from the main
+ * loop, finish() before the thread exits. Read the results after join.
+ */
+class FaultMonitor
+{
+public:
+    FaultMonitor();
+
+    /**
+     * @brief Start the warm-up period
+     *
+     * @param warmupMs Time during which faults are expected (first touches)
+     */
+    void begin(uint32_t warmupMs);
+
+    /**
+     * @brief Take the post-warm-up baseline once the warm-up has elapsed
+     *
+     * One TscClock read per call; getrusage() is called only once.
+     */
+    void poll()
+    {
+        if ((m_armed == false) && (m_enabled == true) && (TscClock::now() >= m_warmupEndTicks))
+        {
+            arm();
+        }
+    }
+
+    /**
+     * @brief Compute faults taken since the baseline
+     */
+    void finish();
+
+    /**
+     * @brief Whether the baseline was taken (thread outlived its warm-up)
+     */
+    bool isArmed() const { return m_armed; }
+
+    /**
+     * @brief Faults since warm-up (valid after finish())
+     */
+    const RealtimeProfile::FaultCounters& getFaults() const { return m_faults; }
+
+private:
+    void arm();
+
+private:
+    bool m_enabled;
+    bool m_armed;
+    uint64_t m_warmupEndTicks;
+    RealtimeProfile::FaultCounters m_baseline;
+    RealtimeProfile::FaultCounters m_faults;
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_REALTIMEPROFILE_HPP
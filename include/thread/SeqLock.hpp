@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file SeqLock.hpp
+ * @ingroup thread
+ * @brief Sequence lock for single-writer counter blocks
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_SEQLOCK_HPP
+#define AGENT_TEAM_TEST_THREAD_SEQLOCK_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <cstdint>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Lets readers copy a group of fields without ever stalling the writer
+ *
+ * The writer bumps the sequence to odd, updates, and bumps it back to even;
+ * a reader retries if the sequence was odd or changed during its copy. The
+ * writer does two plain stores per update and never waits, so it suits
+ * counters owned by one RT thread and read occasionally by another.
+ *
+ * Fields must be std::atomic accessed with relaxed ordering (no data race
+ * on a torn read that is then discarded). One writer at a time: either a
+ * single thread, or writers serialized by an external lock.
+ */
+class SeqLock
+{
+public:
+    SeqLock()
+        : m_sequence(0U)
+    {
+    }
+
+    /**
+     * @brief Apply an update so readers see all of it or none of it
+     */
+    template <typename Update>
+    void write(Update&& update)
+    {
+        uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+        m_sequence.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        update();
+        m_sequence.store(sequence + 2U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Run a copy until it observed no concurrent update
+     */
+    template <typename Copy>
+    void read(Copy&& copy) const
+    {
+        uint64_t before = 0U;
+        uint64_t after = 0U;
+
+        do
+        {
+            before = m_sequence.load(std::memory_order_acquire);
+            copy();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_sequence.load(std::memory_order_relaxed);
+        }
+        while (((before & 1U) != 0U) || (before != after));
+    }
+
+    /**
+     * @brief Single-writer increment: load + store, no locked RMW
+     */
+    static void add(std::atomic<uint64_t>& counter, uint64_t delta = 1U)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> m_sequence;
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_SEQLOCK_HPP
@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ThreadScheduler.hpp
+ * @ingroup thread
+ * @brief CPU affinity and scheduling policy helpers for running threads
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_THREADSCHEDULER_HPP
+#define AGENT_TEAM_TEST_THREAD_THREADSCHEDULER_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <pthread.h>
+#include <sys/types.h>
+#include <cstdint>
+#include <string>
+
+/*******************************************************************************
+ * Type Definition
+ ******************************************************************************/
+
+/**
+ * @brief Linux scheduling class of an RT thread
+ *
+ * Fifo is first so a zero-initialised config keeps the historic SCHED_FIFO.
+ */
+enum class SchedPolicy
+{
+    Fifo,       /**< SCHED_FIFO: runs until it blocks or a higher priority preempts */
+    RoundRobin, /**< SCHED_RR: SCHED_FIFO with a time slice among equal priorities */
+    Deadline,   /**< SCHED_DEADLINE: runtime budget every period (EDF + CBS) */
+    Other       /**< SCHED_OTHER: back to the fair scheduler */
+};
+
+/**
+ * @brief Policy and its parameters
+ *
+ * priority applies to Fifo/RoundRobin (1-99); the remaining fields apply to
+ * Deadline only, whose times must satisfy runtime <= deadline <= period.
+ */
+struct SchedSettings
+{
+    SchedPolicy policy;
+    int priority;
+    uint64_t runtimeNs;
+    uint64_t deadlineNs;
+    uint64_t periodNs;
+    bool overrunSignal;     /**< SCHED_FLAG_DL_OVERRUN: SIGXCPU when a job exceeds its runtime */
+};
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Applies affinity and scheduling to a thread, at creation or later
+ *
+ * All calls act on an already running thread, so they double as the
+ * runtime re-pinning path. SCHED_DEADLINE has no pthread API and is set
+ * with sched_setattr() on the kernel thread id.
+ */
+class ThreadScheduler
+{
+public:
+    /**
+     * @brief Pin a thread to one CPU
+     *
+     * @param thread Target thread
+     * @param cpuCore CPU index (must be >= 0)
+     * @return true on success
+     */
+    static bool setAffinity(pthread_t thread, int cpuCore);
+
+    /**
+     * @brief Change the scheduling class and its parameters
+     *
+     * @param thread Target thread (Fifo, RoundRobin, Other)
+     * @param tid Kernel thread id of the same thread (Deadline)
+     * @param settings Policy and parameters
+     * @return true on success; errno holds the reason on failure
+     */
+    static bool setScheduling(pthread_t thread, pid_t tid, const SchedSettings& settings);
+
+    /**
+     * @brief Count SIGXCPU deadline overrun signals (idempotent)
+     *
+     * Must be installed before any thread sets overrunSignal: the default
+     * SIGXCPU action terminates the process. The signal is process-directed
+     * but the kernel prefers the overrunning thread unless it blocks SIGXCPU.
+     */
+    static bool installOverrunHandler();
+
+    /**
+     * @brief SIGXCPU overrun signals received since the process started
+     */
+    static uint64_t getOverrunCount();
+
+    /**
+     * @brief Current policy and priority of a thread, e.g. "SCHED_FIFO/80"
+     *
+     * Asks the kernel by TID: pthread_getschedparam() returns glibc's cached
+     * values, which miss a policy set with sched_setattr().
+     */
+    static std::string describe(pid_t tid);
+
+    /**
+     * @brief Parse "fifo", "rr", "deadline" or "other"
+     */
+    static bool parsePolicy(const std::string& name, SchedPolicy& policy);
+
+    /**
+     * @brief Kernel name of a policy, e.g. "SCHED_FIFO"
+     */
+    static const char* policyName(SchedPolicy policy);
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_THREADSCHEDULER_HPP
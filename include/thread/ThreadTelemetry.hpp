@@ -0,0 +1,76 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ThreadTelemetry.hpp
+ * @ingroup thread
+ * @brief Per-thread OS scheduling and fault counters read from procfs
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_THREADTELEMETRY_HPP
+#define AGENT_TEAM_TEST_THREAD_THREADTELEMETRY_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <sys/types.h>
+#include <cstdint>
+#include <string>
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Reads what the kernel knows about one thread's scheduling
+ *
+ * getrusage(RUSAGE_THREAD) only reports on the calling thread, so the same
+ * task counters are read from /proc/self/task/<tid>/{stat,status,schedstat}
+ * instead; any thread (the dashboard, stop()) can sample any other thread.
+ * Not for the hot path: each sample opens three procfs files.
+ */
+class ThreadTelemetry
+{
+public:
+    /**
+     * @brief Cumulative counters since the thread started
+     */
+    struct Sample
+    {
+        bool valid;                     /**< false if the thread was not found */
+        uint64_t voluntarySwitches;     /**< Blocked/yielded (recv timeout, usleep) */
+        uint64_t involuntarySwitches;   /**< Preempted by another task */
+        uint64_t minorFaults;           /**< Page faults served without I/O */
+        uint64_t majorFaults;           /**< Page faults that needed I/O */
+        uint64_t cpuTimeNs;             /**< Time on CPU */
+        uint64_t runQueueWaitNs;        /**< Time runnable but waiting for a CPU */
+        uint64_t timeslices;            /**< Times scheduled onto a CPU */
+        int lastCpu;                    /**< CPU the thread last ran on */
+
+        /**
+         * @brief Format as one row under header()
+         */
+        std::string toString(const std::string& name) const;
+
+        /**
+         * @brief Column headers matching toString()
+         */
+        static std::string header();
+    };
+
+public:
+    /**
+     * @brief Sample a thread of this process
+     *
+     * @param tid Kernel thread ID (gettid())
+     * @param[out] sample Counters; sample.valid is false on failure
+     * @return true if the thread's stat file was read
+     */
+    static bool sample(pid_t tid, Sample& sample);
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_THREADTELEMETRY_HPP
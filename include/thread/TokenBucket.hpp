@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file TokenBucket.hpp
+ * @ingroup thread
+ * @brief Packet- and byte-rate token bucket driven by TscClock ticks
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_THREAD_TOKENBUCKET_HPP
+#define AGENT_TEAM_TEST_THREAD_TOKENBUCKET_HPP
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "timer/TscClock.hpp"
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Dual token bucket (packets/s and bytes/s) with burst allowance
+ *
+ * Credit is kept in TscClock ticks (Q16 fixed point) rather than tokens:
+ * refilling is a subtraction of two tick counts, and each packet or byte
+ * costs a precomputed number of ticks, so the hot path has no division and
+ * no clock_gettime call. A bucket with rate 0 is unlimited.
+ *
+ * Not thread-safe: owned by the thread that sends (the TX thread).
+ * TscClock::calibrate() must have run before configure().
+ */
+class TokenBucket
+{
+public:
+    TokenBucket()
+        : m_packets{}
+        , m_bytes{}
+        , m_lastTicks(0U)
+    {
+    }
+
+    /**
+     * @brief Set rates and burst sizes; the buckets start full
+     *
+     * @param packetsPerSecond Packet rate (0 = unlimited)
+     * @param bytesPerSecond Byte rate (0 = unlimited)
+     * @param burstPackets Packets that may be sent back-to-back (min 1)
+     * @param burstBytes Bytes that may be sent back-to-back (must cover the largest packet)
+     */
+    void configure(uint64_t packetsPerSecond, uint64_t bytesPerSecond,
+                   uint32_t burstPackets, uint32_t burstBytes)
+    {
+        setBucket(m_packets, packetsPerSecond, std::max(burstPackets, 1U));
+        setBucket(m_bytes, bytesPerSecond, std::max(burstBytes, 1U));
+        m_lastTicks = TscClock::now();
+    }
+
+    /**
+     * @brief Whether any limit is configured
+     */
+    bool isEnabled() const { return (m_packets.costQ16 != 0U) || (m_bytes.costQ16 != 0U); }
+
+    /**
+     * @brief Take credit for one packet of the given size if available
+     *
+     * @param bytes Packet size
+     * @param nowTicks Current TscClock::now()
+     * @return true if the packet may be sent now
+     */
+    bool tryConsume(size_t bytes, uint64_t nowTicks)
+    {
+        bool result = false;
+        uint64_t byteCost = m_bytes.costQ16 * bytes;
+
+        refill(nowTicks);
+
+        if ((m_packets.creditQ16 >= m_packets.costQ16) && (m_bytes.creditQ16 >= byteCost))
+        {
+            m_packets.creditQ16 -= m_packets.costQ16;
+            m_bytes.creditQ16 -= byteCost;
+            result = true;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Ticks until tryConsume() for this size can succeed
+     *
+     * @param bytes Packet size
+     * @return 0 if enough credit is available already
+     */
+    uint64_t ticksUntilAvailable(size_t bytes) const
+    {
+        uint64_t byteCost = m_bytes.costQ16 * bytes;
+        uint64_t packetWait = (m_packets.creditQ16 < m_packets.costQ16) ?
+                              (m_packets.costQ16 - m_packets.creditQ16) : 0U;
+        uint64_t byteWait = (m_bytes.creditQ16 < byteCost) ? (byteCost - m_bytes.creditQ16) : 0U;
+
+        return std::max(packetWait, byteWait) >> Q_SHIFT;
+    }
+
+private:
+    static constexpr unsigned int Q_SHIFT = 16U;
+
+    /**
+     * @brief One rate limit expressed as tick credit
+     */
+    struct Bucket
+    {
+        uint64_t costQ16;       /**< Ticks per unit, Q16 (0 = unlimited) */
+        uint64_t capacityQ16;   /**< Burst size in ticks, Q16 */
+        uint64_t creditQ16;     /**< Accumulated ticks, Q16 (<= capacity) */
+    };
+
+    static void setBucket(Bucket& bucket, uint64_t unitsPerSecond, uint32_t burst)
+    {
+        bucket = Bucket{};
+
+        if (unitsPerSecond > 0U)
+        {
+            bucket.costQ16 = std::max<uint64_t>(
+                (TscClock::getFrequencyHz() << Q_SHIFT) / unitsPerSecond, 1U);
+            bucket.capacityQ16 = bucket.costQ16 * burst;
+            bucket.creditQ16 = bucket.capacityQ16;
+        }
+    }
+
+    static void addCredit(Bucket& bucket, uint64_t elapsedTicks)
+    {
+        if (bucket.costQ16 != 0U)
+        {
+            /* Clamp before shifting so long idle periods cannot overflow */
+            uint64_t room = bucket.capacityQ16 - bucket.creditQ16;
+            bucket.creditQ16 = (elapsedTicks >= (room >> Q_SHIFT)) ?
+                               bucket.capacityQ16 : (bucket.creditQ16 + (elapsedTicks << Q_SHIFT));
+        }
+    }
+
+    void refill(uint64_t nowTicks)
+    {
+        if (nowTicks > m_lastTicks)
+        {
+            uint64_t elapsed = nowTicks - m_lastTicks;
+            addCredit(m_packets, elapsed);
+            addCredit(m_bytes, elapsed);
+            m_lastTicks = nowTicks;
+        }
+    }
+
+private:
+    Bucket m_packets;
+    Bucket m_bytes;
+    uint64_t m_lastTicks;
+};
+
+#endif  // AGENT_TEAM_TEST_THREAD_TOKENBUCKET_HPP
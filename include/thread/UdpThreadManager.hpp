@@ -18,13 +18,25 @@
  * Includes
  ******************************************************************************/
 #include <pthread.h>
+#include <array>
 #include <atomic>
 #include <functional>
 #include <cstdint>
+#include <string>
 
 #include "thread/LockFreeRingBuffer.hpp"
+#include "thread/HugePageBuffer.hpp"
+#include "thread/NumaTopology.hpp"
+#include "thread/RealtimeProfile.hpp"
+#include "thread/HostTuning.hpp"
+#include "thread/ThreadTelemetry.hpp"
+#include "thread/AllocationTracker.hpp"
+#include "thread/SeqLock.hpp"
+#include "thread/ThreadScheduler.hpp"
+#include "thread/TokenBucket.hpp"
 #include "socket/UdpNode.hpp"
 #include "stats/LatencyStats.hpp"
+#include "timer/TscClock.hpp"
 
 /*******************************************************************************
  * Class Declaration
@@ -34,6 +46,112 @@ class UdpThreadManager
 {
 public:
     using RxCallback = std::function<void(const uint8_t*, size_t)>;
+    using RxBatchCallback = std::function<void(const struct iovec* frames, size_t count)>;
+    
+    /**
+     * @brief Length of the first frame at the start of a datagram
+     *
+     * Used to unpack coalesced datagrams before the RX callback. Returns 0
+     * when no complete frame starts there; the rest of the datagram is then
+     * delivered as one frame, so the callback still sees (and reports) it.
+     */
+    using RxFrameSplitter = size_t (*)(const uint8_t* data, size_t length);
+    
+    /** Largest datagram handled by the rings and RX/TX threads */
+    static constexpr size_t PACKET_MAX_SIZE = 2048U;
+    
+    using PacketQueue = LockFreeRingBuffer<PACKET_MAX_SIZE, 1024>;
+    
+    /** Maximum number of RX worker threads */
+    static constexpr size_t RX_WORKER_MAX = 4U;
+    
+    /** Alignment of per-thread hot state: two 64-byte lines, since the adjacent-line prefetcher pulls pairs */
+    static constexpr size_t CACHE_LINE_SIZE = 128U;
+    
+    /**
+     * @brief TX priority lane, one queue each (index = priority, 0 highest)
+     */
+    enum class TxLane : size_t
+    {
+        Control = 0U,   /**< Lifesign/heartbeat and other small, latency-critical packets */
+        Bulk = 1U       /**< Everything else (default) */
+    };
+    
+    /** Number of TX lanes */
+    static constexpr size_t TX_LANE_COUNT = 2U;
+    
+    /** Most packets the TX thread packs into one coalesced datagram */
+    static constexpr size_t TX_COALESCE_MAX_PACKETS = 64U;
+    
+    /**
+     * @brief Why the TX thread sent a coalesced datagram
+     */
+    enum class CoalesceFlush : size_t
+    {
+        Size = 0U,      /**< Next packet did not fit txCoalesceMtu */
+        Count = 1U,     /**< txCoalesceMaxPackets reached */
+        Deadline = 2U,  /**< Oldest packet held for txCoalesceDeadlineUs (or TX thread exit) */
+        Urgent = 3U     /**< A Control lane packet joined the datagram */
+    };
+    
+    /** Number of coalesce flush reasons */
+    static constexpr size_t COALESCE_FLUSH_REASON_COUNT = 4U;
+    
+    /**
+     * @brief How the TX thread chooses between lanes
+     */
+    enum class TxScheduling
+    {
+        StrictPriority, /**< Always drain Control before Bulk */
+        Weighted        /**< Round-robin, txLaneWeights[lane] packets per turn */
+    };
+    
+    /**
+     * @brief Snapshot of the RX thread's counters
+     */
+    struct RxCounters
+    {
+        uint64_t packets;   /**< Datagrams received */
+        uint64_t frames;    /**< Frames delivered after unpacking (= packets without rxFrameSplitter) */
+        uint64_t drops;     /**< Receive errors and worker queue overflows */
+    };
+    
+    /**
+     * @brief Snapshot of the TX counters
+     */
+    struct TxCounters
+    {
+        uint64_t packets;                           /**< Datagrams sent */
+        uint64_t drops;                             /**< Queue full or send failure */
+        uint64_t lanePackets[TX_LANE_COUNT];        /**< Sent, per lane */
+        uint64_t laneDrops[TX_LANE_COUNT];          /**< Dropped, per lane */
+        uint64_t shaped;                            /**< Delayed by the shaper */
+        uint64_t direct;                            /**< Sent inline by queueTxPacket() */
+        uint64_t directFallback;                    /**< Direct send attempts that were queued */
+        uint64_t deadlineJobs;                      /**< SCHED_DEADLINE periods the TX thread ran */
+        uint64_t deadlineOverruns;                  /**< Jobs that exceeded their runtime (SIGXCPU) */
+        uint64_t coalescedDatagrams;                /**< Datagrams built by coalescing (also in packets) */
+        uint64_t coalescedPackets;                  /**< Queued packets carried by those datagrams */
+        uint64_t coalesceFlushes[COALESCE_FLUSH_REASON_COUNT];  /**< Coalesced datagrams, per reason */
+    };
+    
+    /**
+     * @brief How received datagrams reach the RX callback
+     */
+    enum class RxDeliveryMode
+    {
+        Inline,     /**< RX thread invokes the callback directly */
+        WorkerPool  /**< RX thread enqueues, pinned workers invoke the callback */
+    };
+    
+    /**
+     * @brief Which side of a ring decides its NUMA node
+     */
+    enum class RingPlacement
+    {
+        Writer,     /**< Node of the producing thread (default) */
+        Reader      /**< Node of the consuming thread */
+    };
     
     struct Config
     {
@@ -41,9 +159,57 @@ public:
         int txCpuCore;          /**< CPU core for TX thread (-1 = no affinity) */
         int rxPriority;         /**< Real-time priority for RX thread (1-99) */
         int txPriority;         /**< Real-time priority for TX thread (1-99) */
-        bool useRealtimeScheduling;  /**< Enable SCHED_FIFO */
+        bool useRealtimeScheduling;  /**< Enable real-time scheduling (rtPolicy) */
         size_t rxBufferSize;    /**< SO_RCVBUF size in bytes */
         size_t txBufferSize;    /**< SO_SNDBUF size in bytes */
+        bool useHugePages;      /**< Back rings/stats with 2 MiB huge pages (falls back to 4 KiB) */
+        bool lockMemory;        /**< mlock rings/stats at start() */
+        bool numaAware;         /**< Place rings/stats on the node of their pinned thread */
+        RingPlacement ringPlacement;  /**< Writer or reader side decides ring node */
+        RxDeliveryMode rxDeliveryMode;  /**< Inline callback or worker pool dispatch */
+        size_t rxWorkerCount;   /**< Worker threads in WorkerPool mode (1..RX_WORKER_MAX) */
+        int rxWorkerCpuCores[RX_WORKER_MAX];  /**< CPU core per worker (-1 = no affinity) */
+        int rxWorkerPriority;   /**< Real-time priority for workers (1-99) */
+        size_t rxWorkerBatchSize;  /**< Max packets a worker pops per batch */
+        RingOverflowPolicy rxOverflowPolicy;  /**< RX worker queues when full */
+        RingOverflowPolicy txOverflowPolicy[TX_LANE_COUNT];  /**< Per TX lane queue when full */
+        uint32_t overflowBlockTimeoutUs;      /**< Max wait for the Block policy */
+        bool queueTimestamps;   /**< Stamp ring slots and record queue residence time */
+        TxScheduling txScheduling;  /**< Lane selection in the TX thread */
+        uint32_t txLaneWeights[TX_LANE_COUNT];  /**< Packets per turn in Weighted mode (0 = 1) */
+        size_t txBatchSize;     /**< Max packets the TX thread sends per wake-up */
+        uint64_t txRatePps;     /**< Shaper packet rate (0 = unlimited) */
+        uint64_t txRateBytesPerSec;  /**< Shaper byte rate (0 = unlimited) */
+        uint32_t txBurstPackets;     /**< Shaper burst in packets */
+        uint32_t txBurstBytes;       /**< Shaper burst in bytes (at least PACKET_MAX_SIZE) */
+        bool txDirectSend;      /**< Send from the caller of queueTxPacket() when the TX path is idle */
+        bool lowLatencyProfile; /**< mlockall, no malloc trim, prefaulted stacks, fault check */
+        size_t threadStackSize; /**< Preallocated stack per RT thread (0 = default) */
+        size_t heapReserveSize; /**< Heap bytes prefaulted at start() */
+        uint32_t faultWarmupMs; /**< Faults before this are expected; after it they are reported */
+        bool holdCpuDmaLatency; /**< Hold /dev/cpu_dma_latency while running */
+        int32_t cpuDmaLatencyUs;    /**< Requested C-state exit latency (0 = shallowest) */
+        bool checkHostTuning;   /**< Report governor/isolation/IRQ findings for the RT cores */
+        uint32_t allocationWarmupMs;    /**< ENABLE_ALLOC_TRACKING: RT thread allocations before this are expected */
+        bool abortOnRtAllocation;       /**< ENABLE_ALLOC_TRACKING: abort on an RT thread allocation after warm-up */
+        SchedPolicy rtPolicy;   /**< Fifo or RoundRobin at start() (Deadline via setThreadScheduling()) */
+        uint64_t txDeadlineRuntimeNs;   /**< TX as SCHED_DEADLINE: CPU budget per period (0 = off) */
+        uint64_t txDeadlineNs;          /**< TX job must finish this long after its period starts */
+        uint64_t txDeadlinePeriodNs;    /**< TX job period: bounds the queued-packet wait */
+        size_t txCoalesceMtu;           /**< Pack queued packets into datagrams of up to this size (0 = off) */
+        size_t txCoalesceMaxPackets;    /**< Send once a datagram holds this many (1..TX_COALESCE_MAX_PACKETS) */
+        uint32_t txCoalesceDeadlineUs;  /**< Send once the oldest packet in it waited this long */
+        RxFrameSplitter rxFrameSplitter;  /**< Unpack datagrams before the RX callback (nullptr = off) */
+    };
+    
+    /**
+     * @brief Thread addressed by the runtime control calls
+     */
+    enum class ManagedThread
+    {
+        Rx,         /**< RX socket thread */
+        Tx,         /**< TX socket thread */
+        RxWorker    /**< One RX worker, selected by index */
     };
     
     enum class Error
@@ -52,7 +218,8 @@ public:
         ThreadCreateFail,
         SetAffinityFail,
         SetSchedulerFail,
-        SetSocketBufferFail
+        SetSocketBufferFail,
+        AllocateFail
     };
 
 public:
@@ -75,57 +242,294 @@ public:
     
     /**
      * @brief Set RX callback for received packets
+     *
+     * In WorkerPool mode the callback runs on the worker threads; with more
+     * than one worker it is invoked concurrently and packets are distributed
+     * round-robin, so per-stream ordering only holds with a single worker.
      */
     void setRxCallback(RxCallback callback);
     
+    /**
+     * @brief Set RX callback that receives packets in batches (replaces setRxCallback())
+     *
+     * A worker hands over every packet it pops in one go (up to
+     * Config::rxWorkerBatchSize, at most PacketQueue::BATCH_MAX), so the
+     * callback can process them together. The frames stay valid only during
+     * the call. Inline delivery and DropOldest worker queues pass one frame
+     * per call.
+     */
+    void setRxBatchCallback(RxBatchCallback callback);
+    
     /**
      * @brief Queue packet for transmission
      * 
+     * Each lane is its own SPSC queue, so packets are ordered within a lane
+     * only, and each lane must have a single producer thread.
+     * 
+     * With Config::txDirectSend the packet is sent from the calling thread
+     * when every lane is empty, no send is in flight and the shaper has
+     * credit; otherwise it is queued as usual. Either way the packet leaves
+     * after everything queued before it on its lane.
+     * 
      * @param data Pointer to packet data
      * @param length Length of packet
+     * @param lane TX priority lane
      * @return true if successfully queued
      */
-    bool queueTxPacket(const uint8_t* data, size_t length);
+    bool queueTxPacket(const uint8_t* data, size_t length, TxLane lane = TxLane::Bulk);
     
     /**
-     * @brief Get RX queue statistics
+     * @brief Queue a packet gathered from several buffers for transmission
+     * 
+     * Same lanes, ordering and direct-send rules as queueTxPacket(). A
+     * direct send hands the pieces to sendmsg() without joining them; a
+     * queued packet is copied piece by piece straight into its ring slot.
+     * 
+     * @param iov Buffers in packet order (e.g. AppPacketGather::iov)
+     * @param iovcnt Number of buffers
+     * @param lane TX priority lane
+     * @return true if successfully queued or sent
      */
-    size_t getRxQueueSize() const { return m_rxQueue.size(); }
+    bool queueTxPacketv(const struct iovec* iov, size_t iovcnt, TxLane lane = TxLane::Bulk);
     
     /**
-     * @brief Get TX queue statistics
+     * @brief Get RX queue statistics (sum over worker queues)
      */
-    size_t getTxQueueSize() const { return m_txQueue.size(); }
+    size_t getRxQueueSize() const;
+    
+    /**
+     * @brief Get TX queue statistics (sum over lanes)
+     */
+    size_t getTxQueueSize() const;
+    
+    /**
+     * @brief Get RX queue overflow outcomes (sum over worker queues)
+     */
+    RingOverflowStats getRxOverflowStats() const;
+    
+    /**
+     * @brief Get TX queue overflow outcomes (sum over lanes)
+     */
+    RingOverflowStats getTxOverflowStats() const;
+    
+    /**
+     * @brief Get TX queue overflow outcomes of one lane
+     */
+    RingOverflowStats getTxOverflowStats(TxLane lane) const;
+    
+    /**
+     * @brief Peak RX queue occupancy (highest over worker queues)
+     */
+    size_t getRxQueueHighWaterMark() const;
+    
+    /**
+     * @brief Peak TX queue occupancy of one lane
+     */
+    size_t getTxQueueHighWaterMark(TxLane lane) const;
+    
+    /**
+     * @brief Usable slots per queue
+     */
+    static constexpr size_t getQueueCapacity() { return PacketQueue::capacity(); }
     
     /**
      * @brief Get last error
      */
     Error getError() const { return m_error; }
     
+    /**
+     * @brief Consistent copy of the RX thread's counters
+     */
+    RxCounters getRxCounters() const;
+
+    /**
+     * @brief Consistent copy of the TX counters
+     *
+     * Sender-side and application-side counters are each copied consistently;
+     * they have different writers, so the two halves may be a packet apart.
+     */
+    TxCounters getTxCounters() const;
+
     /**
      * @brief Get RX packet counter
      */
-    uint64_t getRxPacketCount() const { return m_rxPacketCount.load(std::memory_order_relaxed); }
+    uint64_t getRxPacketCount() const { return getRxCounters().packets; }
     
     /**
      * @brief Get TX packet counter
      */
-    uint64_t getTxPacketCount() const { return m_txPacketCount.load(std::memory_order_relaxed); }
+    uint64_t getTxPacketCount() const { return getTxCounters().packets; }
+    
+    /**
+     * @brief Get packets sent from one TX lane
+     */
+    uint64_t getTxLanePacketCount(TxLane lane) const
+    {
+        return getTxCounters().lanePackets[static_cast<size_t>(lane)];
+    }
+    
+    /**
+     * @brief Get packets dropped on one TX lane (queue full or send failure)
+     */
+    uint64_t getTxLaneDropCount(TxLane lane) const
+    {
+        return getTxCounters().laneDrops[static_cast<size_t>(lane)];
+    }
 
     /**
      * @brief Get RX latency statistics (recvfrom → callback completion)
+     *
+     * Statistics buffers are allocated by the first successful start() and
+     * kept until destruction. Precondition for this and every statistics
+     * getter below: start() has succeeded once (asserted in debug builds).
      */
-    LatencyStats<>& getRxLatencyStats() { return m_rxLatencyStats; }
+    LatencyStats<>& getRxLatencyStats() { return *m_rxLatencyStats; }
 
     /**
      * @brief Get TX latency statistics (queue pop → sendto completion)
      */
-    LatencyStats<>& getTxLatencyStats() { return m_txLatencyStats; }
+    LatencyStats<>& getTxLatencyStats() { return *m_txLatencyStats; }
 
     /**
      * @brief Get RX interval jitter statistics (time between consecutive packets)
      */
-    LatencyStats<>& getRxIntervalStats() { return m_rxIntervalStats; }
+    LatencyStats<>& getRxIntervalStats() { return *m_rxIntervalStats; }
+
+    /**
+     * @brief Get TX shaping delay statistics (head packet held by the token bucket)
+     *
+     * Only packets that actually had to wait are recorded.
+     */
+    LatencyStats<>& getTxShapingStats() { return *m_txShapingStats; }
+
+    /**
+     * @brief Get end-to-end latency of directly sent packets (queueTxPacket → sendto done)
+     */
+    LatencyStats<>& getTxDirectLatencyStats() { return *m_txDirectLatencyStats; }
+
+    /**
+     * @brief Get end-to-end latency of queued packets (queueTxPacket → sendto done)
+     *
+     * Recorded when Config::txDirectSend or Config::queueTimestamps is set.
+     */
+    LatencyStats<>& getTxQueuedLatencyStats() { return *m_txQueuedLatencyStats; }
+
+    /**
+     * @brief Get number of packets sent inline by queueTxPacket()
+     */
+    uint64_t getTxDirectCount() const { return getTxCounters().direct; }
+
+    /**
+     * @brief Get number of direct-send attempts that fell back to the queue
+     */
+    uint64_t getTxDirectFallbackCount() const { return getTxCounters().directFallback; }
+
+    /**
+     * @brief Get CPU time of each TX job (SCHED_DEADLINE only)
+     *
+     * Compare against Config::txDeadlineRuntimeNs: jobs near the budget are
+     * close to an overrun.
+     */
+    LatencyStats<>& getTxDeadlineJobStats() { return *m_txDeadlineJobStats; }
+
+    /**
+     * @brief Get number of packets delayed by the TX shaper
+     */
+    uint64_t getTxShapedCount() const { return getTxCounters().shaped; }
+
+    /**
+     * @brief Get coalescing hold time (TX thread pop → its datagram sent)
+     *
+     * The latency each queued packet paid for sharing a datagram. Only
+     * recorded when Config::txCoalesceMtu is set.
+     */
+    LatencyStats<>& getTxCoalesceHoldStats() { return *m_txCoalesceHoldStats; }
+
+    /**
+     * @brief Get TX queue residence statistics of one lane (queueTxPacket → TX thread pop)
+     *
+     * Only recorded when Config::queueTimestamps is set.
+     */
+    LatencyStats<>& getTxResidenceStats(TxLane lane)
+    {
+        return *m_txResidenceStats[static_cast<size_t>(lane)];
+    }
+
+    /**
+     * @brief Get RX queue residence statistics of one worker (RX push → worker pop)
+     *
+     * Each worker records into its own buffer (LatencyStats is single-producer).
+     * Only valid for workers started in WorkerPool mode.
+     */
+    LatencyStats<>& getRxResidenceStats(size_t worker = 0U) { return *m_rxResidenceStats[worker]; }
+
+    /**
+     * @brief Sample OS scheduling/fault counters of the RX thread
+     *
+     * Live while the thread runs; afterwards the values it had on exit.
+     */
+    ThreadTelemetry::Sample getRxThreadTelemetry() const { return sampleThread(m_rxTid, m_rxExitTelemetry); }
+
+    /**
+     * @brief Sample OS scheduling/fault counters of the TX thread
+     */
+    ThreadTelemetry::Sample getTxThreadTelemetry() const { return sampleThread(m_txTid, m_txExitTelemetry); }
+
+    /**
+     * @brief Sample OS scheduling/fault counters of one RX worker
+     */
+    ThreadTelemetry::Sample getRxWorkerTelemetry(size_t worker = 0U) const
+    {
+        return sampleThread(m_rxWorkers[worker].tid, m_rxWorkers[worker].exitTelemetry);
+    }
+
+    /**
+     * @brief Move a running thread to another CPU
+     *
+     * Takes effect at the thread's next scheduling point; the rings and
+     * statistics stay on the node chosen at start(), so a warning is printed
+     * when the new core is on another NUMA node. The core is remembered for
+     * the next start(). Call from the thread that calls start()/stop().
+     *
+     * @param thread Thread to move
+     * @param worker Worker index (RxWorker only)
+     * @param cpuCore Target CPU
+     * @return true on success
+     */
+    bool setThreadAffinity(ManagedThread thread, size_t worker, int cpuCore);
+
+    /**
+     * @brief Change the scheduling policy and priority of a running thread
+     *
+     * Fifo/RoundRobin priorities are remembered for the next start(). The
+     * kernel rejects Deadline for a thread whose affinity is narrower than
+     * its root domain, so pin such a thread with cpusets, not affinity.
+     * For the TX thread the new policy also switches the loop's pacing:
+     * one job per period under Deadline, idle sleeps otherwise.
+     *
+     * @param thread Thread to change
+     * @param worker Worker index (RxWorker only)
+     * @param settings Policy and parameters
+     * @return true on success
+     */
+    bool setThreadScheduling(ManagedThread thread, size_t worker, const SchedSettings& settings);
+
+    /**
+     * @brief Resize SO_RCVBUF/SO_SNDBUF of the running socket
+     *
+     * Queued datagrams are kept; the kernel doubles the value and caps it
+     * at net.core.rmem_max/wmem_max (see the SO_*BUF set to ... lines).
+     *
+     * @param rxBufferSize New SO_RCVBUF request (0 = unchanged)
+     * @param txBufferSize New SO_SNDBUF request (0 = unchanged)
+     * @return true on success
+     */
+    bool setSocketBufferSizes(size_t rxBufferSize, size_t txBufferSize);
+
+    /**
+     * @brief One line per thread: core, policy, kernel TID; plus socket buffers
+     */
+    std::string describeThreads() const;
 
 private:
     /**
@@ -138,51 +542,312 @@ private:
      */
     static void* txThreadEntry(void* arg);
     
+    /**
+     * @brief RX worker thread entry point
+     */
+    static void* rxWorkerEntry(void* arg);
+    
     /**
      * @brief RX thread main loop
      */
     void rxThreadLoop();
     
+    /**
+     * @brief Hand one frame to a worker queue or the inline callback (RX thread only)
+     */
+    void dispatchRxFrame(const uint8_t* data, size_t length, uint64_t rxTicks);
+    
+    /**
+     * @brief RX worker main loop: pop batches from its queue and run the callback
+     */
+    void rxWorkerLoop(size_t index);
+    
     /**
      * @brief TX thread main loop
      */
     void txThreadLoop();
     
+    /**
+     * @brief Start RX worker threads (WorkerPool mode)
+     */
+    bool startRxWorkers();
+    
+    /**
+     * @brief Join RX worker threads
+     */
+    void stopRxWorkers();
+    
+    /**
+     * @brief Create a thread, on a preallocated stack when one is given
+     */
+    bool createThread(pthread_t& thread, void* (*entry)(void*), void* arg, const HugePageBuffer& stack);
+
+    /**
+     * @brief Apply the process-wide part of the low-latency profile
+     */
+    void applyLowLatencyProfile();
+
+    /**
+     * @brief Check host tuning of the RT cores and take the CPU latency request
+     */
+    void applyHostTuning();
+
+    /**
+     * @brief Live sample while tid is set, else the sample taken at thread exit
+     */
+    static ThreadTelemetry::Sample sampleThread(const std::atomic<pid_t>& tid,
+                                                const ThreadTelemetry::Sample& exitSample);
+
+    /**
+     * @brief Print page faults taken by RT threads after warm-up
+     */
+    void reportFaults(size_t workerCount) const;
+
     /**
      * @brief Configure thread with CPU affinity and real-time scheduling
      */
-    bool configureThread(pthread_t thread, int cpuCore, int priority, bool useRealtime);
+    bool configureThread(pthread_t thread, pid_t tid, int cpuCore, const SchedSettings& settings, bool useRealtime);
+
+    /**
+     * @brief Make the calling TX thread a SCHED_DEADLINE task (TX thread only)
+     *
+     * Falls back to the TX core and priority of the config on failure.
+     *
+     * @return true if the thread runs under SCHED_DEADLINE
+     */
+    bool applyTxDeadline();
+
+    /**
+     * @brief Resolve a control target to its pthread, TID and config fields
+     *
+     * @return false if the thread is not running
+     */
+    bool findManagedThread(ManagedThread thread, size_t worker, pthread_t& handle, pid_t& tid,
+                           int*& cpuCore, int*& priority);
     
     /**
      * @brief Configure socket buffer sizes
      */
     bool configureSocketBuffers();
 
+    /**
+     * @brief Allocate (and optionally mlock) rings and statistics buffers
+     */
+    bool allocateBuffers();
+
+    /**
+     * @brief Choose the NUMA node of a ring from its writer and reader nodes
+     *
+     * Falls back to the other side when the configured side is not pinned.
+     */
+    int selectRingNode(int writerNode, int readerNode) const;
+
+    /**
+     * @brief Warn when RX/TX cores are not on the NIC's NUMA node
+     */
+    void checkNicLocality() const;
+
+    /**
+     * @brief Pick the TX lane to pop next (TX thread only)
+     *
+     * In Weighted mode the turn's credit is spent by the caller once the
+     * packet is actually popped, so a shaped packet does not use up a turn.
+     *
+     * @return Lane index, or TX_LANE_COUNT if every lane is empty
+     */
+    size_t selectTxLane();
+
+    /**
+     * @brief Ask the shaper whether the head packet of a lane may go now (TX thread only)
+     *
+     * @param lane Lane whose head packet is next
+     * @param shapeStartTicks When the link was first held back (0 = not held), updated
+     * @param waitTicks Set to the remaining wait when the packet is held
+     * @return true if the packet may be sent
+     */
+    bool admitTxPacket(size_t lane, uint64_t& shapeStartTicks, uint64_t& waitTicks);
+
+    /**
+     * @brief Send from the caller's thread if the TX path is idle (direct-send mode)
+     *
+     * @param iov Packet pieces
+     * @param iovcnt Number of pieces
+     * @param length Total packet length (for the shaper)
+     * @param lane Lane the packet would be queued on
+     * @param startTicks TscClock ticks at queueTxPacket() entry
+     * @return true if the packet was handed to the socket, false to queue it
+     */
+    bool trySendDirect(const struct iovec* iov, size_t iovcnt, size_t length, size_t lane, uint64_t startTicks);
+
+    /**
+     * @brief Pop the head packet of a lane into the coalesced datagram (TX thread only)
+     *
+     * Sends the datagram first if the packet would not fit, and afterwards
+     * if it reached the packet limit or the packet came from the Control lane.
+     *
+     * @param lane Lane to pop from
+     * @return true if a packet was popped
+     */
+    bool coalesceTxPacket(size_t lane);
+
+    /**
+     * @brief Send the coalesced datagram, if any (TX thread, holding the send lock)
+     */
+    void flushTxCoalesced(CoalesceFlush reason);
+
+    /**
+     * @brief Whether every TX lane queue is empty
+     */
+    bool txLanesEmpty() const;
+
+    /**
+     * @brief Claim the right to call send() (direct-send mode)
+     *
+     * Serialises the TX thread and direct senders, so a packet popped by the
+     * TX thread is on the wire before a later packet can bypass the queue.
+     * Also guards the shaper and the send statistics shared by both paths.
+     */
+    bool tryLockTxSend()
+    {
+        bool expected = false;
+        return m_txHot.sendInFlight.compare_exchange_strong(expected, true, std::memory_order_acquire);
+    }
+
+    void unlockTxSend() { m_txHot.sendInFlight.store(false, std::memory_order_release); }
+
+    /**
+     * @brief Record how long a packet sat in a queue, from its slot timestamp
+     */
+    static void recordResidence(LatencyStats<>& stats, const RingSlotMetadata& meta);
+
 private:
+    /**
+     * @brief State written per packet by the RX thread only
+     *
+     * One cache line (or more) of its own, so RX updates never invalidate
+     * a line the TX side is writing.
+     */
+    struct alignas(CACHE_LINE_SIZE) RxHotState
+    {
+        SeqLock sequence;                   /**< Guards the counters for getRxCounters() */
+        std::atomic<uint64_t> packets;
+        std::atomic<uint64_t> drops;        /**< Receive errors, worker queue full */
+        std::atomic<uint64_t> frames;       /**< Frames after unpacking */
+        /* RX thread private, never read by other threads */
+        std::chrono::steady_clock::time_point lastRxTime;  /**< For interval measurement */
+        bool firstRxPacket;                 /**< Skip interval on first packet */
+        size_t nextWorker;                  /**< Round-robin cursor */
+    };
+
+    /**
+     * @brief State written per packet by the sender (TX thread or send lock holder)
+     */
+    struct alignas(CACHE_LINE_SIZE) TxHotState
+    {
+        SeqLock sequence;                   /**< Guards the counters for getTxCounters() */
+        std::atomic<bool> sendInFlight;     /**< Send lock in direct-send mode */
+        std::atomic<uint64_t> packets;
+        std::atomic<uint64_t> sendErrors;
+        std::array<std::atomic<uint64_t>, TX_LANE_COUNT> lanePackets;
+        std::array<std::atomic<uint64_t>, TX_LANE_COUNT> laneSendErrors;
+        std::atomic<uint64_t> shaped;       /**< Packets delayed by the shaper */
+        std::atomic<uint64_t> direct;       /**< Packets sent inline by queueTxPacket() */
+        std::atomic<uint64_t> deadlineJobs; /**< SCHED_DEADLINE periods run */
+        std::atomic<uint64_t> coalescedDatagrams;
+        std::atomic<uint64_t> coalescedPackets;
+        std::array<std::atomic<uint64_t>, COALESCE_FLUSH_REASON_COUNT> coalesceFlushes;
+        std::atomic<bool> coalescePending;  /**< Packets held for a datagram: no direct send may pass them */
+        /* Sender private */
+        size_t laneCursor;                  /**< Weighted mode: lane being served */
+        uint32_t laneCredit;                /**< Weighted mode: packets left in this turn */
+        TokenBucket shaper;                 /**< TX rate limiter */
+    };
+
+    /**
+     * @brief Datagram the TX thread is filling with queued packets (TX thread private)
+     */
+    struct TxCoalesceState
+    {
+        uint8_t buffer[PACKET_MAX_SIZE];
+        size_t length;                                  /**< Bytes used in buffer */
+        size_t packets;                                 /**< Packets in buffer */
+        size_t lanePackets[TX_LANE_COUNT];              /**< Packets in buffer, per lane */
+        uint64_t popTicks[TX_COALESCE_MAX_PACKETS];     /**< When each packet left its lane */
+        uint64_t enqueueTicks[TX_COALESCE_MAX_PACKETS]; /**< Slot timestamp of each packet (0 = none) */
+        size_t mtu;                                     /**< Config values, clamped at thread start */
+        size_t maxPackets;
+    };
+
+    /**
+     * @brief State written by the application thread in queueTxPacket()
+     */
+    struct alignas(CACHE_LINE_SIZE) TxProducerState
+    {
+        SeqLock sequence;
+        std::array<std::atomic<uint64_t>, TX_LANE_COUNT> laneQueueDrops;   /**< Lane queue full */
+        std::atomic<uint64_t> directFallbacks;  /**< Direct send not possible, packet queued */
+    };
+
+    /**
+     * @brief Per-worker thread context (entry point argument)
+     */
+    struct RxWorker
+    {
+        UdpThreadManager* manager;
+        size_t index;
+        pthread_t thread;
+        HugePageBuffer stack;   /**< Preallocated stack (low-latency profile) */
+        FaultMonitor faults;    /**< Written by the worker, read after join */
+        std::atomic<pid_t> tid; /**< Kernel TID while running, 0 otherwise */
+        ThreadTelemetry::Sample exitTelemetry;  /**< Written by the worker before tid is cleared */
+    };
+    
     pthread_t m_rxThread;
     pthread_t m_txThread;
+    HugePageBuffer m_rxStack;   /**< Preallocated stacks (low-latency profile) */
+    HugePageBuffer m_txStack;
+    FaultMonitor m_rxFaults;    /**< Written by the RX thread, read after join */
+    FaultMonitor m_txFaults;    /**< Written by the TX thread, read after join */
+    bool m_allMemoryLocked;     /**< mlockall() succeeded (low-latency profile) */
+    std::atomic<pid_t> m_rxTid; /**< Kernel TIDs while running, 0 otherwise */
+    std::atomic<pid_t> m_txTid;
+    std::atomic<bool> m_txDeadlinePacing;   /**< TX runs under SCHED_DEADLINE: yield per period, else sleep when idle */
+    ThreadTelemetry::Sample m_rxExitTelemetry;  /**< Written by the thread before its TID is cleared */
+    ThreadTelemetry::Sample m_txExitTelemetry;
+    HostTuning m_hostTuning;    /**< Holds the CPU latency request while running */
+    size_t m_hostTuningFindings;    /**< Findings of the last start() check */
+    std::array<RxWorker, RX_WORKER_MAX> m_rxWorkers;
+    size_t m_rxWorkerCount;     /**< Workers started (0 in Inline mode) */
     std::atomic<bool> m_running;
     
     UdpNode* m_udpNode;
     Config m_config;
+    NumaTopology m_numa;
     
-    LockFreeRingBuffer<2048, 1024> m_rxQueue;  // RX: socket -> application
-    LockFreeRingBuffer<2048, 1024> m_txQueue;  // TX: application -> socket
+    std::array<HugePageObject<PacketQueue>, RX_WORKER_MAX> m_rxQueues;  // RX: socket -> workers
+    std::array<HugePageObject<PacketQueue>, TX_LANE_COUNT> m_txQueues;  // TX: application -> socket, per lane
     
     RxCallback m_rxCallback;
+    RxBatchCallback m_rxBatchCallback;
     Error m_error;
     
-    std::atomic<uint64_t> m_rxPacketCount;
-    std::atomic<uint64_t> m_txPacketCount;
-    std::atomic<uint64_t> m_rxDropCount;
-    std::atomic<uint64_t> m_txDropCount;
+    /* Per-writer hot state, each on its own cache lines */
+    RxHotState m_rxHot;
+    TxHotState m_txHot;
+    TxProducerState m_txProducer;
+    TxCoalesceState m_txCoalesce;
 
     /* Latency statistics */
-    LatencyStats<> m_rxLatencyStats;     /**< RX processing latency */
-    LatencyStats<> m_txLatencyStats;     /**< TX send latency */
-    LatencyStats<> m_rxIntervalStats;    /**< RX inter-packet interval jitter */
-    std::chrono::steady_clock::time_point m_lastRxTime;  /**< For interval measurement */
-    bool m_firstRxPacket;                /**< Skip interval on first packet */
+    HugePageObject<LatencyStats<>> m_rxLatencyStats;   /**< RX processing latency */
+    HugePageObject<LatencyStats<>> m_txLatencyStats;   /**< TX send latency */
+    HugePageObject<LatencyStats<>> m_rxIntervalStats;  /**< RX inter-packet interval jitter */
+    std::array<HugePageObject<LatencyStats<>>, TX_LANE_COUNT> m_txResidenceStats;  /**< Per-lane TX queue residence */
+    HugePageObject<LatencyStats<>> m_txShapingStats;   /**< TX shaper hold time */
+    HugePageObject<LatencyStats<>> m_txDirectLatencyStats;  /**< Direct send end-to-end */
+    HugePageObject<LatencyStats<>> m_txQueuedLatencyStats;  /**< Queued send end-to-end */
+    HugePageObject<LatencyStats<>> m_txDeadlineJobStats;    /**< CPU time per SCHED_DEADLINE TX job */
+    HugePageObject<LatencyStats<>> m_txCoalesceHoldStats;   /**< Hold time of coalesced packets */
+    std::array<HugePageObject<LatencyStats<>>, RX_WORKER_MAX> m_rxResidenceStats;  /**< Per-worker RX queue residence */
 };
 
 #endif  // AGENT_TEAM_TEST_THREAD_UDPTHREADMANAGER_HPP
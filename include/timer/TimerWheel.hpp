@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file TimerWheel.hpp
+ * @ingroup timer
+ * @class TimerWheel
+ * @brief Hierarchical timer wheel for many deadlines with O(1) schedule/expire
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_TIMER_TIMERWHEEL_HPP
+#define AGENT_TEAM_TEST_TIMER_TIMERWHEEL_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Deadlines for a fixed set of ids, in ticks
+ *
+ * Four levels of 64 slots cover 64^4 ticks (about 4.6 hours at 1 ms). A
+ * deadline goes to the level of the highest 6-bit group in which it
+ * differs from the current tick, and each slot is an intrusive doubly
+ * linked list of ids, so schedule() and cancel() are O(1). When a lower
+ * level wraps, the matching slot of the level above is moved down
+ * (cascade); each id is moved at most once per level. Deadlines further
+ * out than the wheel wait in the top level and are placed again when
+ * their slot comes round.
+ *
+ * Ids are indices below the capacity given to initialize(); all memory
+ * is allocated there. Not thread-safe: call from one thread.
+ */
+class TimerWheel
+{
+/***********************************************************
+ * Constant
+ **********************************************************/
+public:
+    static constexpr size_t   LEVELS    = 4U;
+    static constexpr size_t   SLOT_BITS = 6U;
+    static constexpr size_t   SLOTS     = 1U << SLOT_BITS;     /**< Slots per level */
+    static constexpr uint32_t NONE      = UINT32_MAX;          /**< No id / not scheduled */
+
+/***********************************************************
+ * Constructor/Destructor
+ **********************************************************/
+public:
+    TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    bool initialize(size_t capacity, uint64_t start_tick);
+
+    bool schedule(uint32_t id, uint64_t expiry_tick);
+    bool cancel(uint32_t id);
+    bool isScheduled(uint32_t id) const;
+
+    /**
+     * @brief Move time forward and call expire(id) for every deadline reached
+     *
+     * An id is unscheduled before its callback runs, so the callback may
+     * schedule it (or any other id) again.
+     *
+     * @param now_tick  Current tick; earlier values are ignored
+     * @param expire    Callable taking (uint32_t id)
+     * @return Number of ids that expired
+     */
+    template <typename Expire>
+    size_t advance(uint64_t now_tick, Expire&& expire);
+
+    uint64_t getCurrentTick(void) const;
+    size_t getScheduledCount(void) const;
+    size_t getCapacity(void) const;
+
+private:
+    static constexpr uint16_t NO_SLOT = UINT16_MAX;
+
+    void place(uint32_t id);
+    void link(uint32_t id, size_t slot);
+    void unlink(uint32_t id);
+    void cascade(size_t level);
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    std::vector<uint32_t> m_next;           /**< Per id: next in its slot list */
+    std::vector<uint32_t> m_prev;           /**< Per id: previous in its slot list */
+    std::vector<uint64_t> m_expiry;         /**< Per id: deadline tick */
+    std::vector<uint16_t> m_slot;           /**< Per id: level * SLOTS + slot, NO_SLOT if idle */
+    std::array<uint32_t, LEVELS * SLOTS> m_heads;
+    uint64_t m_now;
+    size_t m_scheduled;
+};
+
+
+/*******************************************************************************
+ * Template Definition
+ ******************************************************************************/
+template <typename Expire>
+size_t
+TimerWheel::advance(uint64_t now_tick, Expire&& expire)
+{
+    size_t expired = 0U;
+
+    while (m_now < now_tick)
+    {
+        /* Nothing pending: jump straight to the target tick */
+        if (m_scheduled == 0U)
+        {
+            m_now = now_tick;
+            break;
+        }
+
+        m_now++;
+
+        /* Bring down the slots whose range starts now, highest level first */
+        for (size_t level = LEVELS - 1U; level > 0U; level--)
+        {
+            if ((m_now & ((1ULL << (level * SLOT_BITS)) - 1U)) == 0U)
+            {
+                cascade(level);
+            }
+        }
+
+        size_t slot = static_cast<size_t>(m_now & (SLOTS - 1U));
+
+        while (m_heads[slot] != NONE)
+        {
+            uint32_t id = m_heads[slot];
+
+            unlink(id);
+            expired++;
+            expire(id);
+        }
+    }
+
+    return expired;
+}
+
+
+#endif  // AGENT_TEAM_TEST_TIMER_TIMERWHEEL_HPP
@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file TscClock.hpp
+ * @ingroup timer
+ * @class TscClock
+ * @brief Cheap hot-path timestamps from the CPU time-stamp counter
+ *
+ ******************************************************************************/
+#ifndef AGENT_TEAM_TEST_TIMER_TSCCLOCK_HPP
+#define AGENT_TEAM_TEST_TIMER_TSCCLOCK_HPP
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+/*******************************************************************************
+ * Class Declaration
+ ******************************************************************************/
+
+/**
+ * @brief Time-stamp counter clock calibrated against steady_clock
+ *
+ * now() is a single rdtsc (~20 cycles) instead of a clock_gettime call,
+ * which matters when timestamping every packet. Ticks are only meaningful
+ * as differences; convert them with toNanoseconds().
+ *
+ * Without an invariant TSC (or on non-x86), ticks fall back to
+ * steady_clock nanoseconds, so callers never need to special-case it.
+ */
+class TscClock
+{
+/***********************************************************
+ * Method
+ **********************************************************/
+public:
+    /**
+     * @brief Measure the TSC frequency (blocks ~10 ms on first call)
+     *
+     * Thread-safe and idempotent; call once before RT threads start.
+     *
+     * @return true if the TSC is used, false if steady_clock fallback is active
+     */
+    static bool calibrate(void);
+
+    /**
+     * @brief Current tick count
+     */
+    static uint64_t now(void)
+    {
+        uint64_t ticks = 0U;
+
+#if defined(__x86_64__) || defined(__i386__)
+        if (s_useTsc == true)
+        {
+            ticks = __rdtsc();
+        }
+        else
+#endif
+        {
+            ticks = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        return ticks;
+    }
+
+    /**
+     * @brief Convert a tick difference to nanoseconds
+     */
+    static uint64_t toNanoseconds(uint64_t ticks)
+    {
+        return static_cast<uint64_t>(
+            (static_cast<unsigned __int128>(ticks) * s_nsPerTickQ32) >> 32U);
+    }
+
+    /**
+     * @brief Convert nanoseconds to a tick difference
+     */
+    static uint64_t fromNanoseconds(uint64_t ns)
+    {
+        return static_cast<uint64_t>(
+            (static_cast<unsigned __int128>(ns) * s_ticksPerNsQ32) >> 32U);
+    }
+
+    /**
+     * @brief Whether ticks come from the TSC
+     */
+    static bool isTscActive(void) { return s_useTsc; }
+
+    /**
+     * @brief Calibrated TSC frequency in Hz (1e9 in fallback mode)
+     */
+    static uint64_t getFrequencyHz(void) { return s_frequencyHz; }
+
+/***********************************************************
+ * Data
+ **********************************************************/
+private:
+    static bool     s_useTsc;           /**< rdtsc in use */
+    static uint64_t s_frequencyHz;      /**< Ticks per second */
+    static uint64_t s_nsPerTickQ32;     /**< ns per tick, 32.32 fixed point */
+    static uint64_t s_ticksPerNsQ32;    /**< Ticks per ns, 32.32 fixed point */
+};
+
+
+#endif  // AGENT_TEAM_TEST_TIMER_TSCCLOCK_HPP
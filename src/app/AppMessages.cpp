@@ -0,0 +1,240 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AppMessages.cpp
+ * @ingroup app
+ * @class AppMessages
+ * @brief Typed messages of the application and the schema benchmark
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cstring>
+#include <format>
+
+#include "app/AppMessages.hpp"
+#include "app/AppPacket.hpp"
+#include "app/AppPacketView.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t   BENCH_ITERATIONS        = 1000000U;
+static constexpr size_t   TELEMETRY_PACKET_SIZE   = sizeof(AppPacketMessageBuffer<Telemetry>);
+
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Telemetry sample number idx (deterministic, every field varies)
+ */
+static Telemetry
+makeTelemetry(size_t idx)
+{
+    Telemetry message = {};
+
+    message.sequence = static_cast<uint32_t>(idx);
+    message.temperature = static_cast<int16_t>(2000 + (idx % 1000U));
+    message.position = {static_cast<float>(idx) * 0.5F, -1.25F, static_cast<float>(idx & 0xFFU)};
+    message.timestamp_ns = 1000000000ULL + (idx * 100000ULL);
+
+    return message;
+}
+
+/**
+ * @brief Hand-written sender: pack each field, then setDataPointer() + encode()
+ */
+static size_t
+encodeTelemetryManual(AppPacket& packet, const Telemetry& message, uint8_t* buffer, size_t buffer_size)
+{
+    uint8_t payload[26];
+
+    std::memcpy(&payload[0], &message.sequence, sizeof(message.sequence));
+    std::memcpy(&payload[4], &message.temperature, sizeof(message.temperature));
+    std::memcpy(&payload[6], message.position.data(), sizeof(message.position));
+    std::memcpy(&payload[18], &message.timestamp_ns, sizeof(message.timestamp_ns));
+
+    packet.setDataPointer(payload, sizeof(payload));
+
+    return packet.encode(buffer, buffer_size);
+}
+
+/**
+ * @brief Hand-written receiver: bounds check before every field
+ */
+static bool
+decodeTelemetryManual(const AppPacketView& view, Telemetry& message)
+{
+    bool result = false;
+    std::span<const uint8_t> payload;
+
+    if (view.isValid() == false)
+    {
+        goto decodeTelemetryManual_exit;
+    }
+
+    payload = view.getPayload();
+
+    if (payload.size() < 4U)
+    {
+        goto decodeTelemetryManual_exit;
+    }
+    std::memcpy(&message.sequence, &payload[0], sizeof(message.sequence));
+
+    if (payload.size() < 6U)
+    {
+        goto decodeTelemetryManual_exit;
+    }
+    std::memcpy(&message.temperature, &payload[4], sizeof(message.temperature));
+
+    if (payload.size() < 18U)
+    {
+        goto decodeTelemetryManual_exit;
+    }
+    std::memcpy(message.position.data(), &payload[6], sizeof(message.position));
+
+    if (payload.size() < 26U)
+    {
+        goto decodeTelemetryManual_exit;
+    }
+    std::memcpy(&message.timestamp_ns, &payload[18], sizeof(message.timestamp_ns));
+
+    result = true;
+
+decodeTelemetryManual_exit:
+    return result;
+}
+
+static bool
+sameTelemetry(const Telemetry& lhs, const Telemetry& rhs)
+{
+    return (lhs.sequence == rhs.sequence) && (lhs.temperature == rhs.temperature) &&
+           (lhs.position == rhs.position) && (lhs.timestamp_ns == rhs.timestamp_ns);
+}
+
+static double
+nsPerMessage(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / static_cast<double>(BENCH_ITERATIONS);
+}
+
+
+/*******************************************************************************
+ * Public Method
+ ******************************************************************************/
+
+/**
+ * @brief Typed encode/decode against hand-packed fields (--schema-bench)
+ *
+ * Encodes and decodes BENCH_ITERATIONS Telemetry messages both ways,
+ * with each CRC algorithm, and checks every decoded message against the
+ * one sent. Both decoders verify the CRC.
+ *
+ * @param[in,out] out  Report stream
+ * @return true if every message survived both round trips
+ */
+bool
+AppMessages::benchmark(std::ostream& out)
+{
+    bool result = true;
+    AppPacket packet;
+    AppPacketMessageBuffer<Telemetry> typed_buffer = {};
+    uint8_t manual_buffer[TELEMETRY_PACKET_SIZE] = {};
+    uint64_t sink = 0U;
+
+    packet.setUniqueId(0x12345678U);
+
+    out << std::format("Message schema benchmark (ns per message, Telemetry {} bytes, type id 0x{:04X})\n",
+                       MessageSchema<Telemetry>::WIRE_SIZE, MessageSchema<Telemetry>::TYPE_ID);
+    out << std::format("{:<9} {:>12} {:>12} {:>12} {:>12}\n",
+                       "CRC", "typed enc", "manual enc", "typed dec", "manual dec");
+
+    for (CrcAlgorithm algorithm : {CrcAlgorithm::Ieee, CrcAlgorithm::Castagnoli})
+    {
+        bool correct = true;
+        double typed_encode_ns = 0.0;
+        double manual_encode_ns = 0.0;
+        double typed_decode_ns = 0.0;
+        double manual_decode_ns = 0.0;
+        auto start = std::chrono::steady_clock::now();
+
+        packet.setCrcAlgorithm(algorithm);
+
+        /* Encode: the last packet of each path is kept for the decode runs */
+        start = std::chrono::steady_clock::now();
+        for (size_t idx = 0U; idx < BENCH_ITERATIONS; idx++)
+        {
+            sink += packet.encodeMessage(makeTelemetry(idx), typed_buffer);
+        }
+        typed_encode_ns = nsPerMessage(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t idx = 0U; idx < BENCH_ITERATIONS; idx++)
+        {
+            sink += encodeTelemetryManual(packet, makeTelemetry(idx), manual_buffer, sizeof(manual_buffer));
+        }
+        manual_encode_ns = nsPerMessage(start);
+
+        /* Decode: same packet every time, as a receiver in steady state sees */
+        start = std::chrono::steady_clock::now();
+        for (size_t idx = 0U; idx < BENCH_ITERATIONS; idx++)
+        {
+            Telemetry message = {};
+
+            correct = (AppPacketView(typed_buffer.data(), typed_buffer.size()).decodeMessage(message) == true) &&
+                      (correct == true);
+            sink += message.sequence;
+        }
+        typed_decode_ns = nsPerMessage(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t idx = 0U; idx < BENCH_ITERATIONS; idx++)
+        {
+            Telemetry message = {};
+
+            correct = (decodeTelemetryManual(AppPacketView(manual_buffer, sizeof(manual_buffer)), message) == true) &&
+                      (correct == true);
+            sink += message.sequence;
+        }
+        manual_decode_ns = nsPerMessage(start);
+
+        /* Cross-check: both paths carry the same fields, only typed packets carry the type id */
+        for (size_t idx = 0U; (idx < 1000U) && (correct == true); idx++)
+        {
+            const Telemetry sent = makeTelemetry(idx * 7919U);
+            Telemetry typed = {};
+            Telemetry manual = {};
+
+            packet.encodeMessage(sent, typed_buffer);
+            encodeTelemetryManual(packet, sent, manual_buffer, sizeof(manual_buffer));
+
+            correct = (AppPacketView(typed_buffer.data(), typed_buffer.size()).decodeMessage(typed) == true) &&
+                      (decodeTelemetryManual(AppPacketView(manual_buffer, sizeof(manual_buffer)), manual) == true) &&
+                      (AppPacketView(manual_buffer, sizeof(manual_buffer)).decodeMessage(manual) == false) &&
+                      (sameTelemetry(sent, typed) == true) && (sameTelemetry(sent, manual) == true);
+        }
+
+        out << std::format("{:<9} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f}{}\n",
+                           (algorithm == CrcAlgorithm::Ieee) ? "CRC-32" : "CRC-32C",
+                           typed_encode_ns, manual_encode_ns, typed_decode_ns, manual_decode_ns,
+                           (correct == true) ? "" : "  MISMATCH");
+        result = (result == true) && (correct == true);
+    }
+
+    out << std::format("(checksum {:016x})\n", sink);
+
+    return result;
+}
@@ -16,12 +16,15 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <cstring>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <iostream>
 #include <format>
+#include <vector>
 
 #include "app/AppPacket.hpp"
+#include "app/AppPacketView.hpp"
 
 
 /*******************************************************************************
@@ -29,9 +32,10 @@
  ******************************************************************************/
 static constexpr size_t HEADER_SIZE = sizeof(AppPacketHeader);
 static constexpr size_t FOOTER_SIZE = sizeof(AppPacketFooter);
-
-/* CRC32 polynomial (IEEE 802.3) */
-static constexpr uint32_t CRC32_POLYNOMIAL = 0xEDB88320U;
+static constexpr size_t BENCH_BATCH = 32U;                          /* RX_WORKER_BATCH_SIZE of main */
+static constexpr size_t BENCH_PAYLOAD_SIZES[] = {64U, 256U, APP_PACKET_MAX_DATA_SIZE};
+static constexpr double BENCH_SECONDS_PER_CASE = 0.02;
+static constexpr size_t BENCH_SLOT_SIZE = HEADER_SIZE + APP_PACKET_MAX_DATA_SIZE + FOOTER_SIZE;
 
 
 /*******************************************************************************
@@ -45,20 +49,9 @@ AppPacket::AppPacket()
     m_data_ptr    = nullptr;
     m_data_length = 0U;
     m_crc32       = 0U;
-
-    /* RX lifesign monitoring */
-    m_rx_lifesign      = 0U;
-    m_rx_lifesign_prev = 0U;
-    m_last_change_time = std::chrono::steady_clock::now();
-    m_last_recv_time   = std::chrono::steady_clock::now();
-    m_comm_timeout_ms  = APP_PACKET_COMM_TIMEOUT_MS;
-
-    /* Stability monitoring */
-    m_expected_interval_ms = APP_PACKET_EXPECTED_INTERVAL_MS;
-    m_tolerance_us         = APP_PACKET_INTERVAL_TOLERANCE_US;
-    m_last_interval_us     = 0U;
-    m_unstable_counter     = 0U;
-    m_comm_unstable        = false;
+    m_crc_algorithm = CrcAlgorithm::Ieee;
+    m_rx_flags    = 0U;
+    m_rx_lifesign = 0U;
 
     m_error = AppPacketError::None;
 }
@@ -113,13 +106,54 @@ AppPacket::setDataPointer(const uint8_t* data, size_t length)
     }
 }
 
+/**
+ * @brief Select the footer CRC of encoded packets
+ *
+ * Only choose CrcAlgorithm::Castagnoli once the peer advertised
+ * APP_PACKET_FLAG_CRC32C_CAPABLE (see isPeerCrc32cCapable()).
+ *
+ * @param[in] algorithm  CRC-32 (default) or CRC-32C
+ */
+void
+AppPacket::setCrcAlgorithm(CrcAlgorithm algorithm)
+{
+    m_crc_algorithm = algorithm;
+}
+
+/**
+ * @brief Build the header of the next TX packet
+ *
+ * @param[in] data_length   Payload length in bytes
+ * @param[in] flags         Extra APP_PACKET_FLAG_* bits
+ * @param[in] message_type  MessageSchema<T>::TYPE_ID or MESSAGE_TYPE_NONE
+ * @return Header with the current lifesign and CRC flags
+ */
+AppPacketHeader
+AppPacket::buildHeader(size_t data_length, uint8_t flags, uint16_t message_type) const
+{
+    AppPacketHeader header = {0};
+
+    header.unique_id    = m_unique_id;
+    header.lifesign     = m_lifesign;
+    header.data_length  = static_cast<uint16_t>(data_length);
+    header.version      = APP_PACKET_VERSION;
+    header.flags        = static_cast<uint8_t>(flags | APP_PACKET_FLAG_CRC32C_CAPABLE);
+    header.message_type = message_type;
+    if (m_crc_algorithm == CrcAlgorithm::Castagnoli)
+    {
+        header.flags |= APP_PACKET_FLAG_CRC32C;
+    }
+
+    return header;
+}
+
 /**
  * @brief Encode the packet into a byte buffer for transmission
  *
  * Packet format:
- *   [Header: unique_id(4) + lifesign(2) + data_length(2)]
+ *   [Header: unique_id(4) + lifesign(2) + data_length(2) + version(1) + flags(1) + message_type(2)]
  *   [Payload: data(N)]
- *   [Footer: crc32(4)]
+ *   [Footer: crc32(4), CRC-32 or CRC-32C as flagged]
  *
  * @param[out] buffer       Output buffer to write encoded packet
  * @param[in]  buffer_size  Size of output buffer in bytes
@@ -150,9 +184,7 @@ AppPacket::encode(uint8_t* buffer, size_t buffer_size)
     }
 
     /* Build header */
-    header.unique_id   = m_unique_id;
-    header.lifesign    = m_lifesign;
-    header.data_length = static_cast<uint16_t>(m_data_length);
+    header = buildHeader(m_data_length, 0U, MESSAGE_TYPE_NONE);
 
     /* Copy header to buffer */
     std::memmove(&buffer[offset], &header, HEADER_SIZE);
@@ -165,8 +197,8 @@ AppPacket::encode(uint8_t* buffer, size_t buffer_size)
         offset += m_data_length;
     }
 
-    /* Calculate CRC32 over header + payload */
-    m_crc32 = calculateCrc32(buffer, offset);
+    /* Calculate CRC over header + payload */
+    m_crc32 = Crc32::compute(m_crc_algorithm, buffer, offset);
     footer.crc32 = m_crc32;
 
     /* Copy footer to buffer */
@@ -184,404 +216,501 @@ AppPacket_encode_exit:
 }
 
 /**
- * @brief Decode a received byte buffer into the packet fields
+ * @brief Encode the packet as header / payload / footer pieces, no copy
  *
- * @param[in] buffer       Input buffer containing received packet
- * @param[in] buffer_size  Size of input buffer in bytes
- * @return true on success, false on error
+ * The payload is the one set with setDataPointer(), which must stay
+ * unchanged until the packet is sent or pushed. Hand gather.iov to
+ * UdpThreadManager::queueTxPacketv() (sendmsg or one copy into the ring
+ * slot) or UdpNode::sendv().
+ *
+ * @param[out] gather  Header, footer and iovec of the encoded packet
+ * @return Packet length in bytes, or 0 on error
  */
-bool
-AppPacket::decode(const uint8_t* buffer, size_t buffer_size)
+size_t
+AppPacket::encodeGather(AppPacketGather& gather)
 {
-    bool result = false;
-    size_t offset = 0U;
-    AppPacketHeader header = {0};
-    AppPacketFooter footer = {0};
-    uint32_t computed_crc = 0U;
-    size_t expected_size = 0U;
+    size_t total_size = 0U;
+    struct iovec payload = {const_cast<uint8_t*>(m_data_ptr), m_data_length};
 
-    if (buffer == nullptr)
+    if ((m_error == AppPacketError::InvalidDataPointer) || (m_error == AppPacketError::DataTooLarge))
     {
-        m_error = AppPacketError::InvalidDataPointer;
-        goto AppPacket_decode_exit;
+        /* setDataPointer() rejected the payload */
+        goto AppPacket_encodeGather_exit;
     }
 
-    if (buffer_size < (HEADER_SIZE + FOOTER_SIZE))
+    total_size = encodeGather(gather, &payload, (m_data_length > 0U) ? 1U : 0U);
+
+AppPacket_encodeGather_exit:
+    return total_size;
+}
+
+/**
+ * @brief Encode a payload made of several pieces, e.g. a prefix and data
+ *
+ * The CRC runs incrementally over the header and then each piece where it
+ * lies, so the packet never needs to be contiguous. The pieces must stay
+ * unchanged until the packet is sent or pushed.
+ *
+ * @param[out] gather  Header, footer and iovec of the encoded packet
+ * @param[in]  payload Payload pieces in order
+ * @param[in]  pieces  Number of pieces (at most APP_PACKET_MAX_PAYLOAD_PIECES)
+ * @param[in]  flags   Extra APP_PACKET_FLAG_* bits (e.g. APP_PACKET_FLAG_FRAGMENT)
+ * @return Packet length in bytes, or 0 on error
+ */
+size_t
+AppPacket::encodeGather(AppPacketGather& gather, const struct iovec* payload, size_t pieces, uint8_t flags)
+{
+    size_t total_size = 0U;
+    size_t data_length = 0U;
+    uint32_t state = Crc32::INIT_STATE;
+
+    if ((pieces > APP_PACKET_MAX_PAYLOAD_PIECES) || ((pieces > 0U) && (payload == nullptr)))
     {
-        m_error = AppPacketError::InvalidPacket;
-        goto AppPacket_decode_exit;
+        m_error = AppPacketError::InvalidDataPointer;
+        goto AppPacket_encodeGather_pieces_exit;
     }
 
-    /* Extract header */
-    std::memmove(&header, &buffer[offset], HEADER_SIZE);
-    offset += HEADER_SIZE;
-
-    /* Validate packet size */
-    expected_size = HEADER_SIZE + header.data_length + FOOTER_SIZE;
-    if (buffer_size < expected_size)
+    for (size_t piece = 0U; piece < pieces; piece++)
     {
-        m_error = AppPacketError::InvalidPacket;
-        goto AppPacket_decode_exit;
+        data_length += payload[piece].iov_len;
     }
 
-    if (header.data_length > APP_PACKET_MAX_DATA_SIZE)
+    if (data_length > APP_PACKET_MAX_DATA_SIZE)
     {
         m_error = AppPacketError::DataTooLarge;
-        goto AppPacket_decode_exit;
+        goto AppPacket_encodeGather_pieces_exit;
     }
 
-    /* Store header fields */
-    m_unique_id   = header.unique_id;
-    m_data_length = header.data_length;
+    gather.header = buildHeader(data_length, flags, MESSAGE_TYPE_NONE);
 
-    /* Update received lifesign monitoring */
-    updateReceivedLifesign(header.lifesign);
+    /* CRC over header, then each payload piece where it lies */
+    state = Crc32::update(m_crc_algorithm, state, reinterpret_cast<const uint8_t*>(&gather.header), HEADER_SIZE);
+    gather.iov[0] = {&gather.header, HEADER_SIZE};
+    gather.iovcnt = 1U;
 
-    /* Point to payload in buffer (not copied) */
-    if (m_data_length > 0U)
+    for (size_t piece = 0U; piece < pieces; piece++)
     {
-        m_data_ptr = &buffer[offset];
-    }
-    else
-    {
-        m_data_ptr = nullptr;
+        if (payload[piece].iov_len > 0U)
+        {
+            state = Crc32::update(m_crc_algorithm, state, static_cast<const uint8_t*>(payload[piece].iov_base),
+                                  payload[piece].iov_len);
+            gather.iov[gather.iovcnt] = payload[piece];
+            gather.iovcnt++;
+        }
     }
-    offset += m_data_length;
 
-    /* Extract footer */
-    std::memmove(&footer, &buffer[offset], FOOTER_SIZE);
-    m_crc32 = footer.crc32;
-
-    /* Verify CRC32 */
-    computed_crc = calculateCrc32(buffer, HEADER_SIZE + m_data_length);
-    if (computed_crc != m_crc32)
-    {
-        m_error = AppPacketError::CrcMismatch;
-        goto AppPacket_decode_exit;
-    }
+    m_crc32 = state ^ Crc32::INIT_STATE;
+    gather.footer.crc32 = m_crc32;
+    gather.iov[gather.iovcnt] = {&gather.footer, FOOTER_SIZE};
+    gather.iovcnt++;
+    gather.length = HEADER_SIZE + data_length + FOOTER_SIZE;
 
     m_error = AppPacketError::None;
-    result = true;
+    total_size = gather.length;
 
-AppPacket_decode_exit:
-    return result;
-}
-
-/**
- * @brief Get the unique packet identifier
- */
-uint32_t
-AppPacket::getUniqueId(void) const
-{
-    return m_unique_id;
-}
-
-/**
- * @brief Get the lifesign counter value
- */
-uint16_t
-AppPacket::getLifesign(void) const
-{
-    return m_lifesign;
-}
-
-/**
- * @brief Get the last received lifesign value
- */
-uint16_t
-AppPacket::getReceivedLifesign(void) const
-{
-    return m_rx_lifesign;
-}
+    /* Auto-increment TX lifesign for next packet */
+    m_lifesign++;
 
-/**
- * @brief Get the pointer to payload data
- */
-const uint8_t*
-AppPacket::getData(void) const
-{
-    return m_data_ptr;
+AppPacket_encodeGather_pieces_exit:
+    return total_size;
 }
 
 /**
- * @brief Get the payload data length
+ * @brief Encode several payloads into consecutive packets
+ *
+ * Same wire format and lifesign sequence as calling setDataPointer() and
+ * encode() per payload, but all footers are computed in one
+ * Crc32::computeMulti() pass. Stops at the first payload that cannot be
+ * encoded (getError() tells why), so the encoded lifesigns stay contiguous.
+ *
+ * @param[in]     payloads  Payloads, at most APP_PACKET_MAX_BATCH are used
+ * @param[in,out] slots     Output buffer per payload; length is set on success
+ * @return Number of packets encoded (prefix of payloads)
  */
 size_t
-AppPacket::getDataLength(void) const
+AppPacket::encodeBatch(std::span<const AppPacketFrame> payloads, std::span<AppPacketSlot> slots)
 {
-    return m_data_length;
-}
+    size_t count = std::min({payloads.size(), slots.size(), APP_PACKET_MAX_BATCH});
+    size_t encoded = 0U;
+    const uint8_t* crc_data[APP_PACKET_MAX_BATCH] = {};
+    size_t crc_length[APP_PACKET_MAX_BATCH] = {};
+    uint32_t crc[APP_PACKET_MAX_BATCH];
+    AppPacketHeader header = {0};
 
-/**
- * @brief Get the CRC32 checksum
- */
-uint32_t
-AppPacket::getCrc32(void) const
-{
-    return m_crc32;
-}
+    m_error = AppPacketError::None;
 
-/**
- * @brief Get the current error state
- */
-AppPacket::AppPacketError
-AppPacket::getError(void) const
-{
-    return m_error;
-}
+    header = buildHeader(0U, 0U, MESSAGE_TYPE_NONE);
 
-/**
- * @brief Update received lifesign and assess communication status
- *
- * Call this after decoding a packet to track if the remote peer's
- * lifesign is incrementing (alive) or frozen (loss of communication),
- * and to assess timing stability.
- *
- * @param[in] lifesign  Lifesign value from received packet
- */
-void
-AppPacket::updateReceivedLifesign(uint16_t lifesign)
-{
-    auto now = std::chrono::steady_clock::now();
-    uint32_t expected_us = m_expected_interval_ms * 1000U;
-    uint32_t lower_bound = 0U;
-    uint32_t upper_bound = 0U;
-
-    /* Calculate interval since last receive */
-    m_last_interval_us = static_cast<uint32_t>(
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            now - m_last_recv_time).count());
-    m_last_recv_time = now;
-
-    /* Check interval stability */
-    if (expected_us > m_tolerance_us)
+    /* Pass 1: headers and payloads */
+    for (; encoded < count; encoded++)
     {
-        lower_bound = expected_us - m_tolerance_us;
-    }
-    upper_bound = expected_us + m_tolerance_us;
+        const AppPacketFrame& payload = payloads[encoded];
+        AppPacketSlot& slot = slots[encoded];
 
-    if ((m_last_interval_us < lower_bound) || (m_last_interval_us > upper_bound))
-    {
-        /* Out of tolerance */
-        if (m_unstable_counter < UINT16_MAX)
+        slot.length = 0U;
+
+        if ((slot.buffer == nullptr) || ((payload.data == nullptr) && (payload.length > 0U)))
         {
-            m_unstable_counter++;
+            m_error = AppPacketError::InvalidDataPointer;
+            break;
         }
-        m_comm_unstable = true;
 
-        if (m_error == AppPacketError::None)
+        if (payload.length > APP_PACKET_MAX_DATA_SIZE)
         {
-            m_error = AppPacketError::UnstableCommunication;
+            m_error = AppPacketError::DataTooLarge;
+            break;
+        }
+
+        if (slot.size < (HEADER_SIZE + payload.length + FOOTER_SIZE))
+        {
+            m_error = AppPacketError::BufferTooSmall;
+            break;
         }
-    }
-    else
-    {
-        /* Within tolerance - communication is stable */
-        m_unstable_counter = 0U;
-        m_comm_unstable = false;
 
-        if (m_error == AppPacketError::UnstableCommunication)
+        header.lifesign    = static_cast<uint16_t>(m_lifesign + encoded);
+        header.data_length = static_cast<uint16_t>(payload.length);
+        std::memmove(slot.buffer, &header, HEADER_SIZE);
+        if (payload.length > 0U)
         {
-            m_error = AppPacketError::None;
+            std::memmove(&slot.buffer[HEADER_SIZE], payload.data, payload.length);
         }
+
+        crc_data[encoded]   = slot.buffer;
+        crc_length[encoded] = HEADER_SIZE + payload.length;
     }
 
-    /* Update lifesign tracking */
-    m_rx_lifesign_prev = m_rx_lifesign;
-    m_rx_lifesign      = lifesign;
+    /* Pass 2: all footers at once */
+    Crc32::computeMulti(m_crc_algorithm, crc_data, crc_length, crc, encoded);
 
-    if (m_rx_lifesign != m_rx_lifesign_prev)
+    for (size_t idx = 0U; idx < encoded; idx++)
     {
-        /* Lifesign changed - peer is alive, update timestamp */
-        m_last_change_time = now;
+        AppPacketFooter footer = {crc[idx]};
 
-        if (m_error == AppPacketError::LossOfCommunication)
-        {
-            m_error = AppPacketError::None;
-        }
+        std::memmove(&slots[idx].buffer[crc_length[idx]], &footer, FOOTER_SIZE);
+        slots[idx].length = crc_length[idx] + FOOTER_SIZE;
+    }
+
+    if (encoded > 0U)
+    {
+        m_crc32 = crc[encoded - 1U];
+        m_data_ptr = nullptr;
+        m_data_length = 0U;
     }
-    /* Note: isCommLost() checks elapsed time to determine loss of communication */
+    m_lifesign = static_cast<uint16_t>(m_lifesign + encoded);
+
+    return encoded;
 }
 
 /**
- * @brief Check if communication is lost (lifesign frozen for too long)
+ * @brief Decode a received byte buffer into the packet fields
  *
- * @return true if time since last lifesign change exceeds timeout, false otherwise
+ * Validation is done by AppPacketView; the fields of a valid packet are
+ * kept for the getters. Feed getReceivedLifesign() to a PeerMonitor
+ * to track the peer.
+ *
+ * @param[in] buffer       Input buffer containing received packet
+ * @param[in] buffer_size  Size of input buffer in bytes
+ * @return true on success, false on error
  */
 bool
-AppPacket::isCommLost(void) const
+AppPacket::decode(const uint8_t* buffer, size_t buffer_size)
 {
-    bool lost = false;
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                          now - m_last_change_time).count();
+    bool result = false;
+    AppPacketView view(buffer, buffer_size);
 
-    if (static_cast<uint32_t>(elapsed_ms) >= m_comm_timeout_ms)
+    m_error = view.getError();
+    if (view.isValid() == false)
     {
-        lost = true;
+        goto AppPacket_decode_exit;
     }
 
-    return lost;
+    /* Store header fields, payload stays in the buffer (not copied) */
+    m_unique_id     = view.getUniqueId();
+    m_rx_lifesign   = view.getLifesign();
+    m_rx_flags      = view.getFlags();
+    m_crc_algorithm = view.getCrcAlgorithm();
+    m_crc32         = view.getCrc32();
+    m_data_length   = view.getDataLength();
+    m_data_ptr      = (m_data_length > 0U) ? view.getPayload().data() : nullptr;
+
+    result = true;
+
+AppPacket_decode_exit:
+    return result;
 }
 
 /**
- * @brief Check if communication timing is unstable
+ * @brief Validate several received packets without touching any AppPacket
  *
- * @return true if last interval was outside expected range ± tolerance
+ * Framing is checked per frame, then the CRCs of all well-formed frames
+ * are computed in one Crc32::computeMulti() pass per algorithm. Lifesign
+ * monitoring is left to the caller: feed the lifesign of each frame whose
+ * status is None to PeerMonitor::update(), in order.
+ *
+ * @param[in]  frames   Received packets, at most APP_PACKET_MAX_BATCH are used
+ * @param[out] summary  Per-frame fields and status
+ * @return Number of valid frames (summary.valid)
  */
-bool
-AppPacket::isCommUnstable(void) const
+size_t
+AppPacket::decodeBatch(std::span<const AppPacketFrame> frames, AppPacket::BatchSummary& summary)
 {
-    return m_comm_unstable;
+    size_t count = std::min(frames.size(), APP_PACKET_MAX_BATCH);
+    size_t pending[2] = {0U, 0U};
+    size_t frame_of[2][APP_PACKET_MAX_BATCH];
+    const uint8_t* crc_data[2][APP_PACKET_MAX_BATCH];
+    size_t crc_length[2][APP_PACKET_MAX_BATCH];
+    uint32_t crc_footer[2][APP_PACKET_MAX_BATCH];
+    uint32_t crc[APP_PACKET_MAX_BATCH];
+
+    summary.count = count;
+    summary.valid = 0U;
+    summary.interleaved = 0U;
+
+    /* Pass 1: framing, sorted into one CRC queue per algorithm */
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        AppPacketView view(frames[idx].data, frames[idx].length, false);
+
+        summary.unique_id[idx]     = view.getUniqueId();
+        summary.lifesign[idx]      = view.getLifesign();
+        summary.data_length[idx]   = view.getDataLength();
+        summary.data[idx]          = nullptr;
+        summary.crc_algorithm[idx] = view.getCrcAlgorithm();
+        summary.flags[idx]         = view.getFlags();
+        summary.status[idx]        = view.getError();
+
+        if (view.isValid() == true)
+        {
+            size_t queue = static_cast<size_t>(view.getCrcAlgorithm());
+
+            frame_of[queue][pending[queue]]   = idx;
+            crc_data[queue][pending[queue]]   = view.getCrcCoverage().data();
+            crc_length[queue][pending[queue]] = view.getCrcCoverage().size();
+            crc_footer[queue][pending[queue]] = view.getCrc32();
+            pending[queue]++;
+        }
+    }
+
+    /* Pass 2: CRCs, interleaved across frames */
+    for (size_t queue = 0U; queue < 2U; queue++)
+    {
+        summary.interleaved += Crc32::computeMulti(static_cast<CrcAlgorithm>(queue), crc_data[queue],
+                                                   crc_length[queue], crc, pending[queue]);
+
+        for (size_t job = 0U; job < pending[queue]; job++)
+        {
+            size_t idx = frame_of[queue][job];
+
+            if (crc_footer[queue][job] != crc[job])
+            {
+                summary.status[idx] = AppPacketError::CrcMismatch;
+            }
+            else
+            {
+                summary.data[idx] = (summary.data_length[idx] > 0U) ? &frames[idx].data[HEADER_SIZE] : nullptr;
+                summary.valid++;
+            }
+        }
+    }
+
+    return summary.valid;
 }
 
 /**
- * @brief Get the last measured receive interval
- *
- * @return Last interval in microseconds
+ * @brief Get the unique packet identifier
  */
 uint32_t
-AppPacket::getLastIntervalUs(void) const
+AppPacket::getUniqueId(void) const
 {
-    return m_last_interval_us;
+    return m_unique_id;
 }
 
 /**
- * @brief Get the expected receive interval
- *
- * @return Expected interval in milliseconds
+ * @brief Get the lifesign counter value
  */
-uint32_t
-AppPacket::getExpectedIntervalMs(void) const
+uint16_t
+AppPacket::getLifesign(void) const
 {
-    return m_expected_interval_ms;
+    return m_lifesign;
 }
 
 /**
- * @brief Get the interval tolerance
- *
- * @return Tolerance in microseconds
+ * @brief Get the last received lifesign value
  */
-uint32_t
-AppPacket::getIntervalToleranceUs(void) const
+uint16_t
+AppPacket::getReceivedLifesign(void) const
 {
-    return m_tolerance_us;
+    return m_rx_lifesign;
 }
 
 /**
- * @brief Get the consecutive unstable interval count
- *
- * @return Number of consecutive out-of-tolerance intervals
+ * @brief Get the pointer to payload data
  */
-uint16_t
-AppPacket::getUnstableCounter(void) const
+const uint8_t*
+AppPacket::getData(void) const
 {
-    return m_unstable_counter;
+    return m_data_ptr;
 }
 
 /**
- * @brief Get time elapsed since last lifesign change
- *
- * @return Elapsed time in milliseconds
+ * @brief Get the payload data length
  */
-uint32_t
-AppPacket::getTimeSinceLastChange(void) const
+size_t
+AppPacket::getDataLength(void) const
 {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                          now - m_last_change_time).count();
-
-    return static_cast<uint32_t>(elapsed_ms);
+    return m_data_length;
 }
 
 /**
- * @brief Get the configured communication timeout
- *
- * @return Timeout in milliseconds
+ * @brief Get the CRC32 checksum
  */
 uint32_t
-AppPacket::getCommTimeout(void) const
+AppPacket::getCrc32(void) const
 {
-    return m_comm_timeout_ms;
+    return m_crc32;
 }
 
 /**
- * @brief Set the communication timeout
- *
- * @param[in] timeout_ms  Timeout in milliseconds to declare loss of communication
+ * @brief Get the footer CRC algorithm
  */
-void
-AppPacket::setCommTimeout(uint32_t timeout_ms)
+CrcAlgorithm
+AppPacket::getCrcAlgorithm(void) const
 {
-    m_comm_timeout_ms = timeout_ms;
+    return m_crc_algorithm;
 }
 
 /**
- * @brief Set the expected receive interval and tolerance
- *
- * @param[in] interval_ms   Expected interval between packets (ms)
- * @param[in] tolerance_us  Allowed deviation from expected interval (us)
+ * @brief Check whether the last received packet advertised CRC-32C support
  */
-void
-AppPacket::setExpectedInterval(uint32_t interval_ms, uint32_t tolerance_us)
+bool
+AppPacket::isPeerCrc32cCapable(void) const
 {
-    m_expected_interval_ms = interval_ms;
-    m_tolerance_us         = tolerance_us;
+    return ((m_rx_flags & APP_PACKET_FLAG_CRC32C_CAPABLE) != 0U);
 }
 
 /**
- * @brief Reset the communication monitor (e.g., on reconnect)
+ * @brief Get the current error state
  */
-void
-AppPacket::resetCommMonitor(void)
+AppPacket::AppPacketError
+AppPacket::getError(void) const
 {
-    auto now = std::chrono::steady_clock::now();
-
-    m_rx_lifesign      = 0U;
-    m_rx_lifesign_prev = 0U;
-    m_last_change_time = now;
-    m_last_recv_time   = now;
-
-    /* Reset stability tracking */
-    m_last_interval_us = 0U;
-    m_unstable_counter = 0U;
-    m_comm_unstable    = false;
-
-    if ((m_error == AppPacketError::LossOfCommunication) ||
-        (m_error == AppPacketError::UnstableCommunication))
-    {
-        m_error = AppPacketError::None;
-    }
+    return m_error;
 }
 
 /**
- * @brief Calculate CRC32 checksum (IEEE 802.3 polynomial)
+ * @brief Per-packet encode()/AppPacketView against encodeBatch()/decodeBatch()
+ *
+ * Runs batches of BENCH_BATCH packets of each payload size through both
+ * paths, for each CRC. The batch encoder must produce the same bytes as
+ * encode() and decodeBatch() must accept every frame.
  *
- * @param[in] data    Pointer to data
- * @param[in] length  Length of data in bytes
- * @return CRC32 checksum value
+ * @param[in,out] out  Report stream
+ * @return false if a batch result differs from the per-packet one
  */
-uint32_t
-AppPacket::calculateCrc32(const uint8_t* data, size_t length)
+bool
+AppPacket::benchmark(std::ostream& out)
 {
-    uint32_t crc = 0xFFFFFFFFU;
-
-    for (size_t idx = 0U; idx < length; idx++)
+    bool result = true;
+    std::vector<uint8_t> payload(APP_PACKET_MAX_DATA_SIZE);
+    std::vector<uint8_t> single(BENCH_BATCH * BENCH_SLOT_SIZE);
+    std::vector<uint8_t> batched(BENCH_BATCH * BENCH_SLOT_SIZE);
+    AppPacketFrame payloads[BENCH_BATCH];
+    AppPacketSlot slots[BENCH_BATCH];
+    AppPacketFrame frames[BENCH_BATCH];
+    BatchSummary summary;
+    uint32_t seed = 0x12345678U;
+    uint64_t sink = 0U;
+
+    for (uint8_t& byte : payload)
     {
-        crc ^= static_cast<uint32_t>(data[idx]);
+        seed = (seed * 1103515245U) + 12345U;
+        byte = static_cast<uint8_t>(seed >> 16U);
+    }
 
-        for (uint32_t bit = 0U; bit < 8U; bit++)
+    out << std::format("\nPacket batch benchmark (ns per packet, batches of {})\n", BENCH_BATCH);
+    out << std::format("{:<9} {:>7} {:>11} {:>11} {:>11} {:>11} {:>12}\n",
+                       "Algorithm", "Payload", "encode", "encodeBatch", "view", "decodeBatch", "interleaved");
+
+    for (CrcAlgorithm algorithm : {CrcAlgorithm::Ieee, CrcAlgorithm::Castagnoli})
+    {
+        for (size_t size : BENCH_PAYLOAD_SIZES)
         {
-            if ((crc & 1U) != 0U)
+            AppPacket one;
+            AppPacket many;
+            double ns[4] = {};
+            bool correct = true;
+
+            one.setCrcAlgorithm(algorithm);
+            many.setCrcAlgorithm(algorithm);
+
+            for (size_t idx = 0U; idx < BENCH_BATCH; idx++)
             {
-                crc = (crc >> 1U) ^ CRC32_POLYNOMIAL;
+                payloads[idx] = {&payload[idx % 16U], size};
+                slots[idx] = {&batched[idx * BENCH_SLOT_SIZE], BENCH_SLOT_SIZE, 0U};
+                frames[idx] = {&batched[idx * BENCH_SLOT_SIZE], HEADER_SIZE + size + FOOTER_SIZE};
             }
-            else
+
+            /* Same lifesigns on both encoders: the bytes must match */
+            for (size_t idx = 0U; idx < BENCH_BATCH; idx++)
             {
-                crc = crc >> 1U;
+                one.setDataPointer(payloads[idx].data, size);
+                one.encode(&single[idx * BENCH_SLOT_SIZE], BENCH_SLOT_SIZE);
             }
+            correct = (many.encodeBatch(payloads, slots) == BENCH_BATCH);
+            for (size_t idx = 0U; (idx < BENCH_BATCH) && (correct == true); idx++)
+            {
+                correct = (std::memcmp(&single[idx * BENCH_SLOT_SIZE], &batched[idx * BENCH_SLOT_SIZE],
+                                       frames[idx].length) == 0);
+            }
+            correct = (correct == true) && (decodeBatch(frames, summary) == BENCH_BATCH);
+
+            for (size_t path = 0U; path < 4U; path++)
+            {
+                uint64_t packets = 0U;
+                auto start = std::chrono::steady_clock::now();
+                std::chrono::duration<double, std::nano> elapsed(0.0);
+
+                do
+                {
+                    switch (path)
+                    {
+                    case 0U:
+                        for (size_t idx = 0U; idx < BENCH_BATCH; idx++)
+                        {
+                            one.setDataPointer(payloads[idx].data, size);
+                            sink += one.encode(&single[idx * BENCH_SLOT_SIZE], BENCH_SLOT_SIZE);
+                        }
+                        break;
+                    case 1U:
+                        sink += many.encodeBatch(payloads, slots);
+                        break;
+                    case 2U:
+                        for (size_t idx = 0U; idx < BENCH_BATCH; idx++)
+                        {
+                            sink += (AppPacketView(frames[idx].data, frames[idx].length).isValid() == true) ? 1U : 0U;
+                        }
+                        break;
+                    default:
+                        sink += decodeBatch(frames, summary);
+                        break;
+                    }
+                    packets += BENCH_BATCH;
+                    elapsed = std::chrono::steady_clock::now() - start;
+                }
+                while (elapsed.count() < (BENCH_SECONDS_PER_CASE * 1e9));
+
+                ns[path] = elapsed.count() / static_cast<double>(packets);
+            }
+
+            out << std::format("{:<9} {:>7} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.0f}%{}\n",
+                               Crc32::algorithmName(algorithm), size, ns[0], ns[1], ns[2], ns[3],
+                               100.0 * static_cast<double>(summary.interleaved) / static_cast<double>(BENCH_BATCH),
+                               (correct == true) ? "" : "  MISMATCH");
+            result = (result == true) && (correct == true);
         }
     }
 
-    return crc ^ 0xFFFFFFFFU;
+    out << std::format("(checksum {:016x})\n", sink);
+
+    return result;
 }
@@ -0,0 +1,292 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AppPacketView.cpp
+ * @ingroup app
+ * @class AppPacketView
+ * @brief Stateless, zero-copy view of a received application packet
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstring>
+#include <cstddef>
+
+#include "app/AppPacketView.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t HEADER_SIZE = sizeof(AppPacketHeader);
+static constexpr size_t FOOTER_SIZE = sizeof(AppPacketFooter);
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+AppPacketView::AppPacketView()
+    : m_buffer(nullptr),
+      m_buffer_size(0U),
+      m_error(AppPacket::AppPacketError::InvalidDataPointer)
+{
+}
+
+AppPacketView::AppPacketView(const uint8_t* buffer, size_t buffer_size, bool verify_crc)
+    : m_buffer(buffer),
+      m_buffer_size(buffer_size),
+      m_error(AppPacket::AppPacketError::None)
+{
+    if (buffer == nullptr)
+    {
+        m_error = AppPacket::AppPacketError::InvalidDataPointer;
+    }
+    else if (hasHeader() == false)
+    {
+        m_error = AppPacket::AppPacketError::InvalidPacket;
+    }
+    else if (getVersion() != APP_PACKET_VERSION)
+    {
+        m_error = AppPacket::AppPacketError::UnsupportedVersion;
+    }
+    else if (buffer_size < (HEADER_SIZE + getDataLength() + FOOTER_SIZE))
+    {
+        m_error = AppPacket::AppPacketError::InvalidPacket;
+    }
+    else if (getDataLength() > APP_PACKET_MAX_DATA_SIZE)
+    {
+        m_error = AppPacket::AppPacketError::DataTooLarge;
+    }
+    else if (verify_crc == true)
+    {
+        std::span<const uint8_t> coverage = getCrcCoverage();
+
+        if (Crc32::compute(getCrcAlgorithm(), coverage.data(), coverage.size()) != getCrc32())
+        {
+            m_error = AppPacket::AppPacketError::CrcMismatch;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Length of the packet at the start of a buffer holding several
+ *
+ * Coalesced datagrams are packets back to back; each header gives its own
+ * length. Matches UdpThreadManager::RxFrameSplitter.
+ *
+ * @param[in] buffer       Start of a packet
+ * @param[in] buffer_size  Bytes from there to the end of the datagram
+ * @return Header + payload + footer, or 0 if no whole packet fits
+ */
+size_t
+AppPacketView::frameLength(const uint8_t* buffer, size_t buffer_size)
+{
+    size_t length = 0U;
+    uint16_t data_length = 0U;
+
+    if ((buffer != nullptr) && (buffer_size >= (HEADER_SIZE + FOOTER_SIZE)))
+    {
+        std::memcpy(&data_length, &buffer[offsetof(AppPacketHeader, data_length)], sizeof(data_length));
+        length = HEADER_SIZE + data_length + FOOTER_SIZE;
+        if (length > buffer_size)
+        {
+            length = 0U;
+        }
+    }
+
+    return length;
+}
+
+/**
+ * @brief Unaligned load of a wire field (the buffer has no alignment guarantee)
+ */
+template <typename T>
+T
+AppPacketView::loadField(size_t offset) const
+{
+    T value = 0;
+
+    if (hasHeader() == true)
+    {
+        std::memcpy(&value, &m_buffer[offset], sizeof(T));
+    }
+
+    return value;
+}
+
+/**
+ * @brief Check whether framing (and the CRC, if verified) passed
+ */
+bool
+AppPacketView::isValid(void) const
+{
+    return (m_error == AppPacket::AppPacketError::None);
+}
+
+/**
+ * @brief Get the validation result
+ */
+AppPacket::AppPacketError
+AppPacketView::getError(void) const
+{
+    return m_error;
+}
+
+/**
+ * @brief Check whether the buffer is long enough to hold header and footer
+ */
+bool
+AppPacketView::hasHeader(void) const
+{
+    return ((m_buffer != nullptr) && (m_buffer_size >= (HEADER_SIZE + FOOTER_SIZE)));
+}
+
+/**
+ * @brief Get the sender's unique identifier
+ */
+uint32_t
+AppPacketView::getUniqueId(void) const
+{
+    return loadField<uint32_t>(offsetof(AppPacketHeader, unique_id));
+}
+
+/**
+ * @brief Get the sender's lifesign counter
+ */
+uint16_t
+AppPacketView::getLifesign(void) const
+{
+    return loadField<uint16_t>(offsetof(AppPacketHeader, lifesign));
+}
+
+/**
+ * @brief Get the payload length from the header
+ */
+uint16_t
+AppPacketView::getDataLength(void) const
+{
+    return loadField<uint16_t>(offsetof(AppPacketHeader, data_length));
+}
+
+/**
+ * @brief Get the wire format version
+ */
+uint8_t
+AppPacketView::getVersion(void) const
+{
+    return loadField<uint8_t>(offsetof(AppPacketHeader, version));
+}
+
+/**
+ * @brief Get the header flags (APP_PACKET_FLAG_*)
+ */
+uint8_t
+AppPacketView::getFlags(void) const
+{
+    return loadField<uint8_t>(offsetof(AppPacketHeader, flags));
+}
+
+/**
+ * @brief Get the message type id (MESSAGE_TYPE_NONE for untyped payloads)
+ */
+uint16_t
+AppPacketView::getMessageType(void) const
+{
+    return loadField<uint16_t>(offsetof(AppPacketHeader, message_type));
+}
+
+/**
+ * @brief Get the footer CRC algorithm the sender flagged
+ */
+CrcAlgorithm
+AppPacketView::getCrcAlgorithm(void) const
+{
+    return ((getFlags() & APP_PACKET_FLAG_CRC32C) != 0U) ? CrcAlgorithm::Castagnoli : CrcAlgorithm::Ieee;
+}
+
+/**
+ * @brief Check whether the sender advertised CRC-32C support
+ */
+bool
+AppPacketView::isPeerCrc32cCapable(void) const
+{
+    return ((getFlags() & APP_PACKET_FLAG_CRC32C_CAPABLE) != 0U);
+}
+
+/**
+ * @brief Get the payload inside the buffer (empty unless framing was valid)
+ */
+std::span<const uint8_t>
+AppPacketView::getPayload(void) const
+{
+    std::span<const uint8_t> payload;
+
+    if (getPacketLength() > 0U)
+    {
+        payload = std::span<const uint8_t>(&m_buffer[HEADER_SIZE], getDataLength());
+    }
+
+    return payload;
+}
+
+/**
+ * @brief Get the bytes the footer CRC covers (empty unless framing was valid)
+ */
+std::span<const uint8_t>
+AppPacketView::getCrcCoverage(void) const
+{
+    std::span<const uint8_t> coverage;
+
+    if (getPacketLength() > 0U)
+    {
+        coverage = std::span<const uint8_t>(m_buffer, HEADER_SIZE + getDataLength());
+    }
+
+    return coverage;
+}
+
+/**
+ * @brief Get the footer CRC (0 unless framing was valid)
+ */
+uint32_t
+AppPacketView::getCrc32(void) const
+{
+    uint32_t crc = 0U;
+
+    if (getPacketLength() > 0U)
+    {
+        std::memcpy(&crc, &m_buffer[HEADER_SIZE + getDataLength()], sizeof(crc));
+    }
+
+    return crc;
+}
+
+/**
+ * @brief Get the framed packet length (0 unless framing was valid)
+ *
+ * Bytes after this length (a longer datagram) are not part of the packet.
+ */
+size_t
+AppPacketView::getPacketLength(void) const
+{
+    size_t length = 0U;
+
+    if ((m_error == AppPacket::AppPacketError::None) || (m_error == AppPacket::AppPacketError::CrcMismatch))
+    {
+        length = HEADER_SIZE + getDataLength() + FOOTER_SIZE;
+    }
+
+    return length;
+}
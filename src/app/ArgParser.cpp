@@ -17,11 +17,13 @@
  * Includes
  ******************************************************************************/
 #include <arpa/inet.h>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <string>
 
 #include "app/ArgParser.hpp"
+#include "app/FecEncoder.hpp"
 
 
 /*******************************************************************************
@@ -31,8 +33,10 @@ static constexpr uint8_t PARSE_FLAG_HAS_SRC       = 0x01U;
 static constexpr uint8_t PARSE_FLAG_HAS_DST       = 0x02U;
 static constexpr uint8_t PARSE_FLAG_ERR_SRC_FMT   = 0x04U;
 static constexpr uint8_t PARSE_FLAG_ERR_DST_FMT   = 0x08U;
+static constexpr uint8_t PARSE_FLAG_ERR_FEC_FMT   = 0x10U;
+static constexpr uint8_t PARSE_FLAG_ERR_MSG_FMT   = 0x20U;
 static constexpr uint8_t PARSE_FLAG_REQUIRED_MASK  = 0x03U;  /* HAS_SRC | HAS_DST */
-static constexpr uint8_t PARSE_FLAG_ERROR_MASK     = 0x0CU;  /* ERR_SRC | ERR_DST */
+static constexpr uint8_t PARSE_FLAG_ERROR_MASK     = 0x3CU;  /* ERR_SRC | ERR_DST | ERR_FEC | ERR_MSG */
 
 
 /*******************************************************************************
@@ -71,11 +75,50 @@ parseAddrPort(const std::string& token, uint32_t& addr, uint16_t& port)
     return result;
 }
 
+/**
+ * @brief Parse a FEC code token <k>[:<m>] (m defaults to 1, XOR parity)
+ *
+ * @param[in]  token   String in the form <k> or <k>:<m>
+ * @param[out] data    K, 1..FEC_MAX_DATA_PACKETS
+ * @param[out] parity  M, 1..FEC_MAX_PARITY_PACKETS
+ * @return true on success, false on malformed input
+ */
+static bool
+parseFecCode(const char* token, uint8_t& data, uint8_t& parity)
+{
+    bool result = false;
+    char* end = nullptr;
+    unsigned long k = std::strtoul(token, &end, 10);
+    unsigned long m = 1UL;
+
+    if ((end != token) && (*end == ':'))
+    {
+        const char* m_str = end + 1;
+        m = std::strtoul(m_str, &end, 10);
+        if (end == m_str)
+        {
+            m = 0UL;
+        }
+    }
+
+    if ((end != token) && (*end == '\0') &&
+        (k > 0UL) && (k <= FEC_MAX_DATA_PACKETS) && (m > 0UL) && (m <= FEC_MAX_PARITY_PACKETS))
+    {
+        data   = static_cast<uint8_t>(k);
+        parity = static_cast<uint8_t>(m);
+        result = true;
+    }
+
+    return result;
+}
+
 /**
  * @brief Parse --src and --dst arguments in the form <addr>:<port>
  *
  * Expected usage:
- *   --src <own_addr>:<port> --dst <remote_addr>:<port>
+ *   --src <own_addr>:<port> --dst <remote_addr>:<port> [--control <path>] [--crc32c] [--coalesce]
+ *         [--fec <k>[:<m>]] [--message <bytes>]
+ *   --crc-bench | --frag-bench | --peer-bench | --fec-bench | --schema-bench   (no addresses needed)
  *
  * @param[in]  argc  Argument count
  * @param[in]  argv  Argument vector
@@ -123,12 +166,81 @@ parseUdpPeerArgs(int argc, char* argv[], UdpPeerArgs& args)
                 result_flags |= PARSE_FLAG_ERR_DST_FMT;
             }
         }
+        else if ((std::strcmp(argv[idx], "--control") == 0) &&
+                 (next < argc))
+        {
+            idx ++;  // Move to the argument after --control (pass white space)
+            args.control_path = argv[idx];
+        }
+        else if (std::strcmp(argv[idx], "--crc32c") == 0)
+        {
+            args.crc32c = true;
+        }
+        else if (std::strcmp(argv[idx], "--crc-bench") == 0)
+        {
+            args.crc_bench = true;
+        }
+        else if (std::strcmp(argv[idx], "--frag-bench") == 0)
+        {
+            args.frag_bench = true;
+        }
+        else if (std::strcmp(argv[idx], "--peer-bench") == 0)
+        {
+            args.peer_bench = true;
+        }
+        else if (std::strcmp(argv[idx], "--fec-bench") == 0)
+        {
+            args.fec_bench = true;
+        }
+        else if (std::strcmp(argv[idx], "--schema-bench") == 0)
+        {
+            args.schema_bench = true;
+        }
+        else if (std::strcmp(argv[idx], "--coalesce") == 0)
+        {
+            args.coalesce = true;
+        }
+        else if ((std::strcmp(argv[idx], "--fec") == 0) &&
+                 (next < argc))
+        {
+            idx ++;  // Move to the argument after --fec (pass white space)
+
+            if (parseFecCode(argv[idx], args.fec_data, args.fec_parity) == false)
+            {
+                result_flags |= PARSE_FLAG_ERR_FEC_FMT;
+            }
+        }
+        else if ((std::strcmp(argv[idx], "--message") == 0) &&
+                 (next < argc))
+        {
+            char* end = nullptr;
+            unsigned long size = 0UL;
+
+            idx ++;  // Move to the argument after --message (pass white space)
+
+            size = std::strtoul(argv[idx], &end, 10);
+            if ((end != argv[idx]) && (*end == '\0') && (size > 0UL) && (size <= ARG_MESSAGE_MAX_SIZE))
+            {
+                args.message_size = static_cast<uint32_t>(size);
+            }
+            else
+            {
+                result_flags |= PARSE_FLAG_ERR_MSG_FMT;
+            }
+        }
         else
         {
             /* Unrecognized argument, skip */
         }
     }
 
+    /* Benchmark mode runs no node: addresses are optional */
+    if ((args.crc_bench == true) || (args.frag_bench == true) || (args.peer_bench == true) ||
+        (args.fec_bench == true) || (args.schema_bench == true))
+    {
+        result_flags |= PARSE_FLAG_REQUIRED_MASK;
+    }
+
     /* Report errors at the end */
     if ((result_flags & PARSE_FLAG_ERR_SRC_FMT) != 0x00U)
     {
@@ -142,6 +254,18 @@ parseUdpPeerArgs(int argc, char* argv[], UdpPeerArgs& args)
                   << std::endl;
     }
 
+    if ((result_flags & PARSE_FLAG_ERR_FEC_FMT) != 0x00U)
+    {
+        std::cerr << "Error: invalid --fec format, expected <k>[:<m>] with k 1-" << FEC_MAX_DATA_PACKETS
+                  << ", m 1-" << FEC_MAX_PARITY_PACKETS << std::endl;
+    }
+
+    if ((result_flags & PARSE_FLAG_ERR_MSG_FMT) != 0x00U)
+    {
+        std::cerr << "Error: invalid --message size, expected 1-" << ARG_MESSAGE_MAX_SIZE << " bytes"
+                  << std::endl;
+    }
+
     if ((result_flags & PARSE_FLAG_HAS_SRC) == 0x00U)
     {
         std::cerr << "Error: missing --src <addr>:<port>" << std::endl;
@@ -0,0 +1,269 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ControlServer.cpp
+ * @ingroup app
+ * @brief UNIX datagram control socket implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "app/ControlServer.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <sstream>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t   CONTROL_MAX_COMMAND = 256U;   /**< Longest accepted command */
+static constexpr uint64_t NSEC_PER_USEC       = 1000U;
+
+/*******************************************************************************
+ * Public Function
+ ******************************************************************************/
+
+ControlServer::ControlServer()
+    : m_fd(-1)
+    , m_path()
+    , m_threadMgr(nullptr)
+    , m_logCallback()
+{
+}
+
+ControlServer::~ControlServer()
+{
+    close();
+}
+
+bool
+ControlServer::open(const std::string& path, UdpThreadManager& threadMgr)
+{
+    bool result = false;
+    struct sockaddr_un addr = {};
+
+    close();
+    addr.sun_family = AF_UNIX;
+
+    if ((path.empty() == true) || (path.size() >= sizeof(addr.sun_path)))
+    {
+        std::cerr << std::format("ControlServer: Invalid socket path '{}'", path) << std::endl;
+    }
+    else
+    {
+        std::memcpy(addr.sun_path, path.c_str(), path.size());
+        m_fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        if (m_fd < 0)
+        {
+            std::cerr << std::format("ControlServer: socket() failed: {}", strerror(errno)) << std::endl;
+        }
+        else
+        {
+            unlink(path.c_str());
+
+            if (bind(m_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0)
+            {
+                std::cerr << std::format("ControlServer: bind({}) failed: {}", path, strerror(errno))
+                          << std::endl;
+                ::close(m_fd);
+                m_fd = -1;
+            }
+            else
+            {
+                m_path = path;
+                m_threadMgr = &threadMgr;
+                result = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+void
+ControlServer::close()
+{
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+        unlink(m_path.c_str());
+        m_path.clear();
+    }
+}
+
+void
+ControlServer::handleEvent()
+{
+    char buffer[CONTROL_MAX_COMMAND];
+    struct sockaddr_un peer = {};
+    socklen_t peerLen = sizeof(peer);
+    ssize_t received = 0;
+
+    while ((received = recvfrom(m_fd, buffer, sizeof(buffer) - 1U, 0,
+                                reinterpret_cast<struct sockaddr*>(&peer), &peerLen)) >= 0)
+    {
+        std::string line(buffer, static_cast<size_t>(received));
+
+        while ((line.empty() == false) && ((line.back() == '\n') || (line.back() == '\r')))
+        {
+            line.pop_back();
+        }
+
+        std::string reply = execute(line);
+
+        if (m_logCallback)
+        {
+            m_logCallback(std::format("[CTL] {} -> {}", line, reply.substr(0U, reply.find('\n'))));
+        }
+
+        /* Unbound senders (autobind off) have no address to reply to */
+        if (peerLen > sizeof(sa_family_t))
+        {
+            sendto(m_fd, reply.data(), reply.size(), MSG_DONTWAIT,
+                   reinterpret_cast<struct sockaddr*>(&peer), peerLen);
+        }
+
+        peerLen = sizeof(peer);
+    }
+}
+
+/*******************************************************************************
+ * Private Function
+ ******************************************************************************/
+
+std::string
+ControlServer::execute(const std::string& line)
+{
+    std::istringstream words(line);
+    std::string command;
+    std::string target;
+    std::string reply = "error: usage: pin|sched|sockbuf|status (see ControlServer.hpp)\n";
+    UdpThreadManager::ManagedThread thread = UdpThreadManager::ManagedThread::Rx;
+    size_t worker = 0U;
+
+    words >> command;
+
+    if (command == "status")
+    {
+        reply = "ok\n" + m_threadMgr->describeThreads();
+    }
+    else if (command == "pin")
+    {
+        int cpu = -1;
+
+        if (((words >> target >> cpu).fail() == true) || (parseThread(target, thread, worker) == false))
+        {
+            reply = "error: usage: pin rx|tx|worker<N> <cpu>\n";
+        }
+        else if (m_threadMgr->setThreadAffinity(thread, worker, cpu) == false)
+        {
+            reply = std::format("error: pin {} to core {} failed\n", target, cpu);
+        }
+        else
+        {
+            reply = std::format("ok {} on core {}\n", target, cpu);
+        }
+    }
+    else if (command == "sched")
+    {
+        std::string policyName;
+        SchedSettings settings = {};
+        bool valid = ((words >> target >> policyName).fail() == false) &&
+                     (parseThread(target, thread, worker) == true) &&
+                     (ThreadScheduler::parsePolicy(policyName, settings.policy) == true);
+
+        if ((valid == true) && (settings.policy == SchedPolicy::Deadline))
+        {
+            uint64_t runtimeUs = 0U;
+            uint64_t deadlineUs = 0U;
+            uint64_t periodUs = 0U;
+
+            valid = ((words >> runtimeUs >> deadlineUs >> periodUs).fail() == false);
+            settings.runtimeNs = runtimeUs * NSEC_PER_USEC;
+            settings.deadlineNs = deadlineUs * NSEC_PER_USEC;
+            settings.periodNs = periodUs * NSEC_PER_USEC;
+        }
+        else if ((valid == true) && (settings.policy != SchedPolicy::Other))
+        {
+            valid = ((words >> settings.priority).fail() == false);
+        }
+
+        if (valid == false)
+        {
+            reply = "error: usage: sched rx|tx|worker<N> fifo|rr <prio> | other | "
+                    "deadline <runtime_us> <deadline_us> <period_us>\n";
+        }
+        else if (m_threadMgr->setThreadScheduling(thread, worker, settings) == false)
+        {
+            reply = std::format("error: {} on {} failed\n", ThreadScheduler::policyName(settings.policy), target);
+        }
+        else
+        {
+            reply = std::format("ok {} {}\n", target, ThreadScheduler::policyName(settings.policy));
+        }
+    }
+    else if (command == "sockbuf")
+    {
+        size_t rxBytes = 0U;
+        size_t txBytes = 0U;
+
+        if ((words >> rxBytes >> txBytes).fail() == true)
+        {
+            reply = "error: usage: sockbuf <rx_bytes> <tx_bytes>\n";
+        }
+        else if (m_threadMgr->setSocketBufferSizes(rxBytes, txBytes) == false)
+        {
+            reply = "error: socket buffer resize failed\n";
+        }
+        else
+        {
+            reply = "ok\n" + m_threadMgr->describeThreads();
+        }
+    }
+
+    return reply;
+}
+
+bool
+ControlServer::parseThread(const std::string& name, UdpThreadManager::ManagedThread& thread, size_t& worker)
+{
+    bool result = true;
+
+    worker = 0U;
+
+    if (name == "rx")
+    {
+        thread = UdpThreadManager::ManagedThread::Rx;
+    }
+    else if (name == "tx")
+    {
+        thread = UdpThreadManager::ManagedThread::Tx;
+    }
+    else if ((name.rfind("worker", 0U) == 0U) && (name.size() > 6U) && (name.size() <= 8U) &&
+             (name.find_first_not_of("0123456789", 6U) == std::string::npos))
+    {
+        thread = UdpThreadManager::ManagedThread::RxWorker;
+        worker = std::stoul(name.substr(6U));
+    }
+    else
+    {
+        result = false;
+    }
+
+    return result;
+}
@@ -0,0 +1,694 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Crc32.cpp
+ * @ingroup app
+ * @class Crc32
+ * @brief CRC-32 / CRC-32C kernels and CPUID dispatch
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "app/Crc32.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define CRC32_X86_KERNELS 1
+#endif
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint32_t CRC32_IEEE_POLYNOMIAL       = 0xEDB88320U;  /* Reflected 0x04C11DB7 */
+static constexpr uint32_t CRC32_CASTAGNOLI_POLYNOMIAL = 0x82F63B78U;  /* Reflected 0x1EDC6F41 */
+static constexpr uint32_t CRC32_INIT                  = 0xFFFFFFFFU;
+
+static constexpr size_t   PCLMUL_MIN_LENGTH           = 64U;   /* One 4x128-bit fold block */
+static constexpr size_t   MULTI_LANES                 = 4U;    /* Streams interleaved by computeMulti() */
+static constexpr double   BENCH_SECONDS_PER_CASE      = 0.02;
+static constexpr size_t   BENCH_SIZES[]               = {64U, 256U, 1472U, 65536U};
+
+/*******************************************************************************
+ * Type Definition
+ ******************************************************************************/
+using UpdateFunction = uint32_t (*)(uint32_t state, const uint8_t* data, size_t length);
+
+template <size_t SLICES>
+using SliceTables = std::array<std::array<uint32_t, 256U>, SLICES>;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Slice tables: [0] is the byte table, [k] advances [k-1] by one zero byte
+ */
+template <uint32_t POLYNOMIAL>
+static consteval SliceTables<16U>
+makeSliceTables()
+{
+    SliceTables<16U> tables = {};
+
+    for (uint32_t idx = 0U; idx < 256U; idx++)
+    {
+        uint32_t crc = idx;
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ POLYNOMIAL) : (crc >> 1U);
+        }
+        tables[0][idx] = crc;
+    }
+
+    for (size_t slice = 1U; slice < 16U; slice++)
+    {
+        for (uint32_t idx = 0U; idx < 256U; idx++)
+        {
+            uint32_t prev = tables[slice - 1U][idx];
+            tables[slice][idx] = (prev >> 8U) ^ tables[0][prev & 0xFFU];
+        }
+    }
+
+    return tables;
+}
+
+/* Slice-by-8 uses the first 8 of the 16 tables */
+template <uint32_t POLYNOMIAL>
+static constexpr SliceTables<16U> SLICE_TABLES = makeSliceTables<POLYNOMIAL>();
+
+static inline uint32_t
+load32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+template <uint32_t POLYNOMIAL>
+static uint32_t
+updateBitwise(uint32_t state, const uint8_t* data, size_t length)
+{
+    for (size_t idx = 0U; idx < length; idx++)
+    {
+        state ^= static_cast<uint32_t>(data[idx]);
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            state = ((state & 1U) != 0U) ? ((state >> 1U) ^ POLYNOMIAL) : (state >> 1U);
+        }
+    }
+
+    return state;
+}
+
+template <uint32_t POLYNOMIAL>
+static inline uint32_t
+updateBytes(uint32_t state, const uint8_t* data, size_t length)
+{
+    const auto& table = SLICE_TABLES<POLYNOMIAL>[0];
+
+    for (size_t idx = 0U; idx < length; idx++)
+    {
+        state = (state >> 8U) ^ table[(state ^ data[idx]) & 0xFFU];
+    }
+
+    return state;
+}
+
+template <uint32_t POLYNOMIAL>
+static uint32_t
+updateSlice8(uint32_t state, const uint8_t* data, size_t length)
+{
+    const auto& t = SLICE_TABLES<POLYNOMIAL>;
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (length >= 8U)
+        {
+            uint32_t one = load32(data) ^ state;
+            uint32_t two = load32(data + 4U);
+
+            state = t[7][one & 0xFFU] ^ t[6][(one >> 8U) & 0xFFU] ^
+                    t[5][(one >> 16U) & 0xFFU] ^ t[4][one >> 24U] ^
+                    t[3][two & 0xFFU] ^ t[2][(two >> 8U) & 0xFFU] ^
+                    t[1][(two >> 16U) & 0xFFU] ^ t[0][two >> 24U];
+            data += 8U;
+            length -= 8U;
+        }
+    }
+
+    return updateBytes<POLYNOMIAL>(state, data, length);
+}
+
+template <uint32_t POLYNOMIAL>
+static uint32_t
+updateSlice16(uint32_t state, const uint8_t* data, size_t length)
+{
+    const auto& t = SLICE_TABLES<POLYNOMIAL>;
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (length >= 16U)
+        {
+            uint32_t one = load32(data) ^ state;
+            uint32_t two = load32(data + 4U);
+            uint32_t three = load32(data + 8U);
+            uint32_t four = load32(data + 12U);
+
+            state = t[15][one & 0xFFU] ^ t[14][(one >> 8U) & 0xFFU] ^
+                    t[13][(one >> 16U) & 0xFFU] ^ t[12][one >> 24U] ^
+                    t[11][two & 0xFFU] ^ t[10][(two >> 8U) & 0xFFU] ^
+                    t[9][(two >> 16U) & 0xFFU] ^ t[8][two >> 24U] ^
+                    t[7][three & 0xFFU] ^ t[6][(three >> 8U) & 0xFFU] ^
+                    t[5][(three >> 16U) & 0xFFU] ^ t[4][three >> 24U] ^
+                    t[3][four & 0xFFU] ^ t[2][(four >> 8U) & 0xFFU] ^
+                    t[1][(four >> 16U) & 0xFFU] ^ t[0][four >> 24U];
+            data += 16U;
+            length -= 16U;
+        }
+    }
+
+    return updateBytes<POLYNOMIAL>(state, data, length);
+}
+
+#if defined(CRC32_X86_KERNELS)
+
+__attribute__((target("pclmul,sse4.1")))
+static inline __m128i
+foldPclmul(__m128i value, __m128i constants, __m128i next)
+{
+    __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+    __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(low, high), next);
+}
+
+/**
+ * @brief CRC-32 by carry-less multiplication folding
+ *
+ * Folds four 128-bit lanes per 64 bytes, then one lane per 16 bytes,
+ * reduces 128 -> 64 -> 32 bits and finishes with a Barrett reduction
+ * (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ").
+ * Constants are x^(k) mod P for the reflected IEEE polynomial; the tail
+ * below 16 bytes goes through slice-by-16.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t
+updatePclmulIeee(uint32_t state, const uint8_t* data, size_t length)
+{
+    if (length >= PCLMUL_MIN_LENGTH)
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x1C6E41596LL, 0x154442BD4LL);  /* x^(4*128+32), x^(4*128-32) */
+        const __m128i k3k4 = _mm_set_epi64x(0x0CCAA009ELL, 0x1751997D0LL);  /* x^(128+32), x^(128-32) */
+        const __m128i k5 = _mm_set_epi64x(0LL, 0x163CD6124LL);               /* x^64 */
+        const __m128i barrett = _mm_set_epi64x(0x1F7011641LL, 0x1DB710641LL);  /* mu, P */
+        const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+        const uint8_t* end = data + (length & ~static_cast<size_t>(15U));
+
+        __m128i x1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)),
+                                   _mm_cvtsi32_si128(static_cast<int>(state)));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16U));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32U));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48U));
+
+        for (data += 64U; (end - data) >= 64; data += 64U)
+        {
+            x1 = foldPclmul(x1, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            x2 = foldPclmul(x2, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16U)));
+            x3 = foldPclmul(x3, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32U)));
+            x4 = foldPclmul(x4, k1k2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48U)));
+        }
+
+        x1 = foldPclmul(x1, k3k4, x2);
+        x1 = foldPclmul(x1, k3k4, x3);
+        x1 = foldPclmul(x1, k3k4, x4);
+
+        for (; data < end; data += 16U)
+        {
+            x1 = foldPclmul(x1, k3k4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+        }
+
+        /* 128 -> 64 bits */
+        __m128i folded = _mm_clmulepi64_si128(k3k4, x1, 0x01);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), folded);
+
+        /* 64 -> 32 bits */
+        folded = _mm_srli_si128(x1, 4);
+        x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+        x1 = _mm_xor_si128(x1, folded);
+
+        /* Barrett reduction */
+        folded = x1;
+        x1 = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), barrett, 0x10), mask32);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, barrett, 0x00), folded);
+
+        state = static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+        length &= 15U;
+    }
+
+    return updateSlice16<CRC32_IEEE_POLYNOMIAL>(state, data, length);
+}
+
+__attribute__((target("sse4.2")))
+static uint32_t
+updateSse42Castagnoli(uint32_t state, const uint8_t* data, size_t length)
+{
+    uint64_t crc = state;
+
+    while (length >= 8U)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        crc = _mm_crc32_u64(crc, value);
+        data += 8U;
+        length -= 8U;
+    }
+
+    state = static_cast<uint32_t>(crc);
+    while (length > 0U)
+    {
+        state = _mm_crc32_u8(state, *data);
+        data++;
+        length--;
+    }
+
+    return state;
+}
+
+/**
+ * @brief Advance four CRC-32C streams by the same number of 8-byte words
+ *
+ * crc32 has a 3-cycle latency but issues every cycle, so one stream leaves
+ * two thirds of the unit idle; four independent chains keep it busy.
+ */
+__attribute__((target("sse4.2")))
+static void
+updateSse42CastagnoliX4(uint32_t* states, const uint8_t* const* data, size_t words)
+{
+    uint64_t crc0 = states[0];
+    uint64_t crc1 = states[1];
+    uint64_t crc2 = states[2];
+    uint64_t crc3 = states[3];
+
+    for (size_t offset = 0U; offset < (words * 8U); offset += 8U)
+    {
+        uint64_t value0;
+        uint64_t value1;
+        uint64_t value2;
+        uint64_t value3;
+        std::memcpy(&value0, data[0] + offset, sizeof(value0));
+        std::memcpy(&value1, data[1] + offset, sizeof(value1));
+        std::memcpy(&value2, data[2] + offset, sizeof(value2));
+        std::memcpy(&value3, data[3] + offset, sizeof(value3));
+        crc0 = _mm_crc32_u64(crc0, value0);
+        crc1 = _mm_crc32_u64(crc1, value1);
+        crc2 = _mm_crc32_u64(crc2, value2);
+        crc3 = _mm_crc32_u64(crc3, value3);
+    }
+
+    states[0] = static_cast<uint32_t>(crc0);
+    states[1] = static_cast<uint32_t>(crc1);
+    states[2] = static_cast<uint32_t>(crc2);
+    states[3] = static_cast<uint32_t>(crc3);
+}
+
+/**
+ * @brief Advance two CRC-32C streams by the same number of 8-byte words
+ *
+ * Tail of a batch that is not a multiple of four: two chains still hide
+ * a third of the latency.
+ */
+__attribute__((target("sse4.2")))
+static void
+updateSse42CastagnoliX2(uint32_t* states, const uint8_t* const* data, size_t words)
+{
+    uint64_t crc0 = states[0];
+    uint64_t crc1 = states[1];
+
+    for (size_t offset = 0U; offset < (words * 8U); offset += 8U)
+    {
+        uint64_t value0;
+        uint64_t value1;
+        std::memcpy(&value0, data[0] + offset, sizeof(value0));
+        std::memcpy(&value1, data[1] + offset, sizeof(value1));
+        crc0 = _mm_crc32_u64(crc0, value0);
+        crc1 = _mm_crc32_u64(crc1, value1);
+    }
+
+    states[0] = static_cast<uint32_t>(crc0);
+    states[1] = static_cast<uint32_t>(crc1);
+}
+
+#endif  // CRC32_X86_KERNELS
+
+static UpdateFunction
+kernelOf(CrcImpl impl, CrcAlgorithm algorithm)
+{
+    UpdateFunction function = nullptr;
+    bool ieee = (algorithm == CrcAlgorithm::Ieee);
+
+    switch (impl)
+    {
+        case CrcImpl::Bitwise:
+            function = ieee ? updateBitwise<CRC32_IEEE_POLYNOMIAL> : updateBitwise<CRC32_CASTAGNOLI_POLYNOMIAL>;
+            break;
+        case CrcImpl::Slice8:
+            function = ieee ? updateSlice8<CRC32_IEEE_POLYNOMIAL> : updateSlice8<CRC32_CASTAGNOLI_POLYNOMIAL>;
+            break;
+        case CrcImpl::Slice16:
+            function = ieee ? updateSlice16<CRC32_IEEE_POLYNOMIAL> : updateSlice16<CRC32_CASTAGNOLI_POLYNOMIAL>;
+            break;
+#if defined(CRC32_X86_KERNELS)
+        case CrcImpl::Pclmul:
+            if ((ieee == true) && (__builtin_cpu_supports("pclmul") != 0) &&
+                (__builtin_cpu_supports("sse4.1") != 0))
+            {
+                function = updatePclmulIeee;
+            }
+            break;
+        case CrcImpl::Sse42:
+            if ((ieee == false) && (__builtin_cpu_supports("sse4.2") != 0))
+            {
+                function = updateSse42Castagnoli;
+            }
+            break;
+#endif
+        default:
+            break;
+    }
+
+    return function;
+}
+
+/**
+ * @brief Kernels picked from CPUID on first use (thread-safe static init)
+ */
+struct Dispatch
+{
+    UpdateFunction update[2];
+    CrcImpl impl[2];
+};
+
+static const Dispatch&
+dispatch()
+{
+    static const Dispatch table = []()
+    {
+        Dispatch selected = {};
+
+        for (size_t algo = 0U; algo < 2U; algo++)
+        {
+            selected.impl[algo] = CrcImpl::Slice16;
+
+            /* Fastest first: hardware kernels, then slice-by-16 */
+            for (CrcImpl impl : {CrcImpl::Sse42, CrcImpl::Pclmul})
+            {
+                if ((selected.impl[algo] == CrcImpl::Slice16) &&
+                    (kernelOf(impl, static_cast<CrcAlgorithm>(algo)) != nullptr))
+                {
+                    selected.impl[algo] = impl;
+                }
+            }
+            selected.update[algo] = kernelOf(selected.impl[algo], static_cast<CrcAlgorithm>(algo));
+        }
+
+        return selected;
+    }();
+
+    return table;
+}
+
+/*******************************************************************************
+ * Public Function
+ ******************************************************************************/
+
+uint32_t
+Crc32::compute(CrcAlgorithm algorithm, const uint8_t* data, size_t length)
+{
+    return update(algorithm, CRC32_INIT, data, length) ^ CRC32_INIT;
+}
+
+uint32_t
+Crc32::update(CrcAlgorithm algorithm, uint32_t state, const uint8_t* data, size_t length)
+{
+    return dispatch().update[static_cast<size_t>(algorithm)](state, data, length);
+}
+
+size_t
+Crc32::computeMulti(CrcAlgorithm algorithm, const uint8_t* const* data, const size_t* lengths,
+                    uint32_t* crcs, size_t count)
+{
+    size_t idx = 0U;
+    size_t interleaved = 0U;
+
+#if defined(CRC32_X86_KERNELS)
+    if ((algorithm == CrcAlgorithm::Castagnoli) && (getSelected(algorithm) == CrcImpl::Sse42))
+    {
+        for (; (idx + MULTI_LANES) <= count; idx += MULTI_LANES)
+        {
+            uint32_t states[MULTI_LANES] = {CRC32_INIT, CRC32_INIT, CRC32_INIT, CRC32_INIT};
+            size_t common = lengths[idx];
+
+            for (size_t lane = 1U; lane < MULTI_LANES; lane++)
+            {
+                common = std::min(common, lengths[idx + lane]);
+            }
+            common &= ~static_cast<size_t>(7U);
+
+            /* Shared prefix interleaved, each remainder on its own */
+            updateSse42CastagnoliX4(states, &data[idx], common / 8U);
+            for (size_t lane = 0U; lane < MULTI_LANES; lane++)
+            {
+                crcs[idx + lane] = updateSse42Castagnoli(states[lane], data[idx + lane] + common,
+                                                         lengths[idx + lane] - common) ^ CRC32_INIT;
+            }
+        }
+
+        if ((idx + 2U) <= count)
+        {
+            uint32_t states[2U] = {CRC32_INIT, CRC32_INIT};
+            size_t common = std::min(lengths[idx], lengths[idx + 1U]) & ~static_cast<size_t>(7U);
+
+            updateSse42CastagnoliX2(states, &data[idx], common / 8U);
+            for (size_t lane = 0U; lane < 2U; lane++)
+            {
+                crcs[idx + lane] = updateSse42Castagnoli(states[lane], data[idx + lane] + common,
+                                                         lengths[idx + lane] - common) ^ CRC32_INIT;
+            }
+            idx += 2U;
+        }
+        interleaved = idx;
+    }
+#endif
+
+    for (; idx < count; idx++)
+    {
+        crcs[idx] = compute(algorithm, data[idx], lengths[idx]);
+    }
+
+    return interleaved;
+}
+
+uint32_t
+Crc32::computeWith(CrcImpl impl, CrcAlgorithm algorithm, const uint8_t* data, size_t length)
+{
+    UpdateFunction function = kernelOf(impl, algorithm);
+
+    if (function == nullptr)
+    {
+        function = dispatch().update[static_cast<size_t>(algorithm)];
+    }
+
+    return function(CRC32_INIT, data, length) ^ CRC32_INIT;
+}
+
+bool
+Crc32::isSupported(CrcImpl impl, CrcAlgorithm algorithm)
+{
+    return (kernelOf(impl, algorithm) != nullptr);
+}
+
+CrcImpl
+Crc32::getSelected(CrcAlgorithm algorithm)
+{
+    return dispatch().impl[static_cast<size_t>(algorithm)];
+}
+
+const char*
+Crc32::implName(CrcImpl impl)
+{
+    const char* name = "unknown";
+
+    switch (impl)
+    {
+        case CrcImpl::Bitwise: name = "bitwise";  break;
+        case CrcImpl::Slice8:  name = "slice-8";  break;
+        case CrcImpl::Slice16: name = "slice-16"; break;
+        case CrcImpl::Pclmul:  name = "pclmul";   break;
+        case CrcImpl::Sse42:   name = "sse4.2";   break;
+        default:                                  break;
+    }
+
+    return name;
+}
+
+const char*
+Crc32::algorithmName(CrcAlgorithm algorithm)
+{
+    return (algorithm == CrcAlgorithm::Ieee) ? "CRC-32" : "CRC-32C";
+}
+
+bool
+Crc32::benchmark(std::ostream& out)
+{
+    bool result = true;
+    std::vector<uint8_t> buffer(BENCH_SIZES[std::size(BENCH_SIZES) - 1U] + 64U);
+    uint32_t seed = 0x12345678U;
+    uint32_t sink = 0U;
+
+    /* Deterministic pseudo-random payload */
+    for (uint8_t& byte : buffer)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        byte = static_cast<uint8_t>(seed >> 16U);
+    }
+
+    out << "CRC engine benchmark (GB/s, single thread)\n";
+    out << std::format("{:<9} {:<9}", "Algorithm", "Kernel");
+    for (size_t size : BENCH_SIZES)
+    {
+        out << std::format(" {:>9}", std::format("{} B", size));
+    }
+    out << "\n";
+
+    for (CrcAlgorithm algorithm : {CrcAlgorithm::Ieee, CrcAlgorithm::Castagnoli})
+    {
+        for (size_t implIdx = 0U; implIdx < static_cast<size_t>(CrcImpl::Count); implIdx++)
+        {
+            CrcImpl impl = static_cast<CrcImpl>(implIdx);
+
+            if (isSupported(impl, algorithm) == false)
+            {
+                continue;
+            }
+
+            /* Cross-check every length up to 300 bytes at odd alignments */
+            bool correct = true;
+            for (size_t length = 0U; (length <= 300U) && (correct == true); length++)
+            {
+                const uint8_t* data = buffer.data() + (length % 7U);
+                correct = (computeWith(impl, algorithm, data, length) ==
+                           computeWith(CrcImpl::Bitwise, algorithm, data, length));
+            }
+
+            out << std::format("{:<9} {:<9}", algorithmName(algorithm), implName(impl));
+
+            for (size_t size : BENCH_SIZES)
+            {
+                uint64_t bytes = 0U;
+                auto start = std::chrono::steady_clock::now();
+                std::chrono::duration<double> elapsed(0.0);
+
+                /* Bitwise is ~100x slower: time it on the small sizes only */
+                if ((impl == CrcImpl::Bitwise) && (size > 1472U))
+                {
+                    out << std::format(" {:>9}", "-");
+                    continue;
+                }
+
+                do
+                {
+                    for (size_t rep = 0U; rep < 64U; rep++)
+                    {
+                        sink += computeWith(impl, algorithm, buffer.data() + (rep & 7U), size);
+                    }
+                    bytes += 64U * size;
+                    elapsed = std::chrono::steady_clock::now() - start;
+                }
+                while (elapsed.count() < BENCH_SECONDS_PER_CASE);
+
+                out << std::format(" {:>9.2f}", static_cast<double>(bytes) / elapsed.count() / 1e9);
+            }
+
+            out << ((correct == true) ? "\n" : "  MISMATCH\n");
+            result = (result == true) && (correct == true);
+        }
+    }
+
+    /* Multi-buffer: packet-sized frames, four at a time, against one by one */
+    for (CrcAlgorithm algorithm : {CrcAlgorithm::Ieee, CrcAlgorithm::Castagnoli})
+    {
+        const uint8_t* frames[MULTI_LANES * 8U];
+        size_t lengths[MULTI_LANES * 8U];
+        uint32_t crcs[MULTI_LANES * 8U];
+        bool correct = true;
+
+        /* Uneven lengths so every group has its own remainders */
+        for (size_t frame = 0U; frame < std::size(frames); frame++)
+        {
+            frames[frame] = buffer.data() + (frame * 97U);
+            lengths[frame] = (frame * 37U) % 300U;
+        }
+
+        /* Counts ending on a full group, a pair and a pair plus one */
+        for (size_t count : {std::size(frames), std::size(frames) - 2U, std::size(frames) - 1U})
+        {
+            computeMulti(algorithm, frames, lengths, crcs, count);
+            for (size_t frame = 0U; frame < count; frame++)
+            {
+                correct = (correct == true) &&
+                          (crcs[frame] == computeWith(CrcImpl::Bitwise, algorithm, frames[frame], lengths[frame]));
+            }
+        }
+
+        out << std::format("{:<9} {:<9}", algorithmName(algorithm), "multi");
+
+        for (size_t size : BENCH_SIZES)
+        {
+            uint64_t bytes = 0U;
+            auto start = std::chrono::steady_clock::now();
+            std::chrono::duration<double> elapsed(0.0);
+
+            for (size_t frame = 0U; frame < std::size(frames); frame++)
+            {
+                frames[frame] = buffer.data() + (frame & 7U);
+                lengths[frame] = size;
+            }
+
+            do
+            {
+                computeMulti(algorithm, frames, lengths, crcs, std::size(frames));
+                sink += crcs[0];
+                bytes += std::size(frames) * size;
+                elapsed = std::chrono::steady_clock::now() - start;
+            }
+            while (elapsed.count() < BENCH_SECONDS_PER_CASE);
+
+            out << std::format(" {:>9.2f}", static_cast<double>(bytes) / elapsed.count() / 1e9);
+        }
+
+        out << ((correct == true) ? "\n" : "  MISMATCH\n");
+        result = (result == true) && (correct == true);
+    }
+
+    out << std::format("Selected: {} -> {}, {} -> {} (checksum {:08x})\n",
+                       algorithmName(CrcAlgorithm::Ieee), implName(getSelected(CrcAlgorithm::Ieee)),
+                       algorithmName(CrcAlgorithm::Castagnoli), implName(getSelected(CrcAlgorithm::Castagnoli)),
+                       sink);
+
+    return result;
+}
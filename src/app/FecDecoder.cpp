@@ -0,0 +1,704 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file FecDecoder.cpp
+ * @ingroup app
+ * @class FecDecoder
+ * @brief Rebuilds lost packets from FEC parity without a retransmission
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+
+#include "app/FecDecoder.hpp"
+#include "app/Gf256.hpp"
+#include "thread/SeqLock.hpp"
+#include "timer/TscClock.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t   HISTORY_MASK            = FEC_HISTORY_SIZE - 1U;
+static constexpr size_t   GROUP_MAX_AGE           = FEC_HISTORY_SIZE - FEC_MAX_DATA_PACKETS;  /* Lifesigns behind the newest */
+static constexpr size_t   BENCH_CODES[][2]        = {{4U, 1U}, {8U, 1U}, {8U, 2U}, {16U, 4U}};
+static constexpr double   BENCH_LOSS_RATES[]      = {0.01, 0.05};
+static constexpr size_t   BENCH_PACKETS_PER_CASE  = 200000U;
+static constexpr size_t   BENCH_PAYLOAD_SIZE      = 256U;
+static constexpr size_t   BENCH_KERNEL_SIZES[]    = {256U, 1472U, 65536U};
+static constexpr double   BENCH_SECONDS_PER_CASE  = 0.02;
+
+static_assert((FEC_HISTORY_SIZE & HISTORY_MASK) == 0U, "FEC_HISTORY_SIZE must be a power of 2");
+static_assert(FEC_MAX_PARITY_PACKETS <= 8U, "Group::rows holds one bit per parity row");
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+FecDecoder::FecDecoder()
+    : m_source_count(0U),
+      m_group_age(0U),
+      m_data_packets(0U),
+      m_parity_packets(0U),
+      m_recovered(0U),
+      m_unrecoverable(0U),
+      m_rejected(0U),
+      m_decode_ticks(0U)
+{
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Allocate and prefault the history and parity pools
+ *
+ * @param[in] max_sources  Senders decoded at the same time
+ * @return true if successful
+ */
+bool
+FecDecoder::initialize(size_t max_sources)
+{
+    bool result = false;
+
+    if (max_sources == 0U)
+    {
+        goto FecDecoder_initialize_exit;
+    }
+
+    /* assign() writes every byte, so the pools are resident before the first packet */
+    m_frame_pool.assign(max_sources * FEC_HISTORY_SIZE * FEC_MAX_FRAME_SIZE, 0U);
+    m_parity_pool.assign(max_sources * FEC_PENDING_GROUPS * FEC_MAX_PARITY_PACKETS * FEC_MAX_FRAME_SIZE, 0U);
+    m_scratch.assign(FEC_MAX_PARITY_PACKETS * FEC_MAX_FRAME_SIZE, 0U);
+    m_frames.assign(max_sources * FEC_HISTORY_SIZE, Frame{});
+    m_groups.assign(max_sources * FEC_PENDING_GROUPS, Group{});
+    m_sources.assign(max_sources, Source{});
+
+    for (size_t idx = 0U; idx < m_frames.size(); idx++)
+    {
+        m_frames[idx].data = &m_frame_pool[idx * FEC_MAX_FRAME_SIZE];
+    }
+    for (size_t idx = 0U; idx < m_groups.size(); idx++)
+    {
+        for (size_t row = 0U; row < FEC_MAX_PARITY_PACKETS; row++)
+        {
+            m_groups[idx].parity[row] = &m_parity_pool[((idx * FEC_MAX_PARITY_PACKETS) + row) * FEC_MAX_FRAME_SIZE];
+        }
+    }
+    for (size_t idx = 0U; idx < max_sources; idx++)
+    {
+        m_sources[idx].history = &m_frames[idx * FEC_HISTORY_SIZE];
+        m_sources[idx].groups  = &m_groups[idx * FEC_PENDING_GROUPS];
+    }
+
+    m_source_count = 0U;
+    m_group_age = 0U;
+    result = true;
+
+FecDecoder_initialize_exit:
+    return result;
+}
+
+/**
+ * @brief Store a valid packet; rebuild whatever it makes recoverable
+ */
+void
+FecDecoder::add(const AppPacketView& packet, FecRecovery& recovery)
+{
+    uint64_t start = TscClock::now();
+    Source* source = nullptr;
+
+    recovery.count = 0U;
+
+    if ((isEnabled() == false) || (packet.isValid() == false))
+    {
+        goto FecDecoder_add_exit;
+    }
+
+    source = findSource(packet.getUniqueId());
+    if ((source == nullptr) && ((packet.getFlags() & APP_PACKET_FLAG_FEC_PARITY) != 0U))
+    {
+        /* Parity lifesigns are a stream of their own: a sender starts with its data */
+        goto FecDecoder_add_exit;
+    }
+
+    if (source == nullptr)
+    {
+        if (m_source_count >= m_sources.size())
+        {
+            SeqLock::add(m_rejected);
+            goto FecDecoder_add_exit;
+        }
+
+        source = &m_sources[m_source_count++];
+        source->source_id = packet.getUniqueId();
+        source->newest = packet.getLifesign();
+    }
+
+    if ((packet.getFlags() & APP_PACKET_FLAG_FEC_PARITY) != 0U)
+    {
+        addParity(*source, packet, recovery);
+    }
+    else
+    {
+        addData(*source, packet, recovery);
+    }
+
+FecDecoder_add_exit:
+    SeqLock::add(m_decode_ticks, TscClock::now() - start);
+    return;
+}
+
+/**
+ * @brief Check whether initialize() succeeded
+ */
+bool
+FecDecoder::isEnabled(void) const
+{
+    return (m_sources.empty() == false);
+}
+
+/**
+ * @brief Get the counters, decode time in nanoseconds
+ */
+FecDecoderStats
+FecDecoder::getStats(void) const
+{
+    FecDecoderStats stats = {};
+
+    stats.dataPackets   = m_data_packets.load(std::memory_order_relaxed);
+    stats.parityPackets = m_parity_packets.load(std::memory_order_relaxed);
+    stats.recovered     = m_recovered.load(std::memory_order_relaxed);
+    stats.unrecoverable = m_unrecoverable.load(std::memory_order_relaxed);
+    stats.rejected      = m_rejected.load(std::memory_order_relaxed);
+    stats.decodeNs      = TscClock::toNanoseconds(m_decode_ticks.load(std::memory_order_relaxed));
+
+    return stats;
+}
+
+/**
+ * @brief Find the state of a sender
+ */
+FecDecoder::Source*
+FecDecoder::findSource(uint32_t source_id)
+{
+    Source* source = nullptr;
+
+    for (size_t idx = 0U; idx < m_source_count; idx++)
+    {
+        if (m_sources[idx].source_id == source_id)
+        {
+            source = &m_sources[idx];
+            break;
+        }
+    }
+
+    return source;
+}
+
+/**
+ * @brief Keep a copy of a data packet; retry the group it belongs to
+ */
+void
+FecDecoder::addData(Source& source, const AppPacketView& packet, FecRecovery& recovery)
+{
+    uint16_t lifesign = packet.getLifesign();
+    int16_t delta = static_cast<int16_t>(static_cast<uint16_t>(lifesign - source.newest));
+    Frame& frame = source.history[lifesign & HISTORY_MASK];
+
+    if (packet.getPacketLength() > FEC_MAX_FRAME_SIZE)
+    {
+        SeqLock::add(m_rejected);
+        goto FecDecoder_addData_exit;
+    }
+
+    /* Older than the history, or already there (received or rebuilt) */
+    if ((delta <= -static_cast<int16_t>(FEC_HISTORY_SIZE)) ||
+        ((frame.length != 0U) && (frame.lifesign == lifesign)))
+    {
+        goto FecDecoder_addData_exit;
+    }
+
+    std::memcpy(frame.data, packet.getCrcCoverage().data(), packet.getPacketLength());
+    frame.lifesign = lifesign;
+    frame.length = static_cast<uint16_t>(packet.getPacketLength());
+    SeqLock::add(m_data_packets);
+
+    if (delta > 0)
+    {
+        source.newest = lifesign;
+    }
+
+    for (size_t idx = 0U; idx < FEC_PENDING_GROUPS; idx++)
+    {
+        Group& group = source.groups[idx];
+        uint16_t offset = static_cast<uint16_t>(lifesign - group.header.first_lifesign);
+
+        if (group.used == false)
+        {
+            continue;
+        }
+
+        if (static_cast<uint16_t>(source.newest - group.header.first_lifesign) >= GROUP_MAX_AGE)
+        {
+            /* Its packets are about to leave the history */
+            SeqLock::add(m_unrecoverable, countMissing(source, group.header, nullptr));
+            releaseGroup(group);
+        }
+        else if (offset < group.header.data_count)
+        {
+            recover(source, group, recovery);
+        }
+    }
+
+FecDecoder_addData_exit:
+    return;
+}
+
+/**
+ * @brief Validate a parity packet, keep its row if the group misses packets
+ */
+void
+FecDecoder::addParity(Source& source, const AppPacketView& packet, FecRecovery& recovery)
+{
+    std::span<const uint8_t> payload = packet.getPayload();
+    FecHeader header = {};
+    Group* group = nullptr;
+    bool valid = false;
+
+    if (payload.size() >= sizeof(FecHeader))
+    {
+        std::memcpy(&header, payload.data(), sizeof(header));
+        valid = (header.data_count > 0U) && (header.data_count <= FEC_MAX_DATA_PACKETS) &&
+                (header.parity_count > 0U) && (header.parity_count <= FEC_MAX_PARITY_PACKETS) &&
+                (header.parity_index < header.parity_count) &&
+                (header.parity_length > 0U) && (header.parity_length <= FEC_MAX_FRAME_SIZE) &&
+                (payload.size() == (sizeof(FecHeader) + header.parity_length));
+
+        for (size_t idx = 0U; (idx < header.data_count) && (valid == true); idx++)
+        {
+            valid = (header.lengths[idx] > 0U) && (header.lengths[idx] <= header.parity_length);
+        }
+    }
+
+    if (valid == false)
+    {
+        SeqLock::add(m_rejected);
+        goto FecDecoder_addParity_exit;
+    }
+
+    SeqLock::add(m_parity_packets);
+
+    /* Nothing lost, or the group's packets already left the history */
+    if ((countMissing(source, header, nullptr) == 0U) ||
+        ((static_cast<int16_t>(static_cast<uint16_t>(source.newest - header.first_lifesign)) > 0) &&
+         (static_cast<uint16_t>(source.newest - header.first_lifesign) >= GROUP_MAX_AGE)))
+    {
+        goto FecDecoder_addParity_exit;
+    }
+
+    for (size_t idx = 0U; idx < FEC_PENDING_GROUPS; idx++)
+    {
+        Group& candidate = source.groups[idx];
+
+        if ((candidate.used == true) &&
+            (candidate.header.first_lifesign == header.first_lifesign) &&
+            (candidate.header.data_count == header.data_count) &&
+            (candidate.header.parity_count == header.parity_count))
+        {
+            group = &candidate;
+            break;
+        }
+    }
+
+    if (group == nullptr)
+    {
+        group = allocateGroup(source);
+        group->header = header;
+    }
+
+    if ((group->rows & (1U << header.parity_index)) == 0U)
+    {
+        std::memcpy(group->parity[header.parity_index], &payload[sizeof(FecHeader)], header.parity_length);
+        group->rows = static_cast<uint8_t>(group->rows | (1U << header.parity_index));
+        recover(source, *group, recovery);
+    }
+
+FecDecoder_addParity_exit:
+    return;
+}
+
+/**
+ * @brief Take a free group slot, or give up the oldest waiting group
+ */
+FecDecoder::Group*
+FecDecoder::allocateGroup(Source& source)
+{
+    Group* group = nullptr;
+
+    for (size_t idx = 0U; idx < FEC_PENDING_GROUPS; idx++)
+    {
+        Group& candidate = source.groups[idx];
+
+        if (candidate.used == false)
+        {
+            group = &candidate;
+            break;
+        }
+        if ((group == nullptr) || (candidate.age < group->age))
+        {
+            group = &candidate;
+        }
+    }
+
+    if (group->used == true)
+    {
+        SeqLock::add(m_unrecoverable, countMissing(source, group->header, nullptr));
+        releaseGroup(*group);
+    }
+
+    group->used = true;
+    group->age = ++m_group_age;
+    group->rows = 0U;
+
+    return group;
+}
+
+/**
+ * @brief Count the data packets of a group missing from the history
+ *
+ * @param[out] missing  Their indices in the group (may be nullptr)
+ */
+size_t
+FecDecoder::countMissing(const Source& source, const FecHeader& header, size_t* missing) const
+{
+    size_t count = 0U;
+
+    for (size_t idx = 0U; idx < header.data_count; idx++)
+    {
+        uint16_t lifesign = static_cast<uint16_t>(header.first_lifesign + idx);
+        const Frame& frame = source.history[lifesign & HISTORY_MASK];
+
+        if ((frame.length == 0U) || (frame.lifesign != lifesign))
+        {
+            if (missing != nullptr)
+            {
+                missing[count] = idx;
+            }
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Solve the missing packets of a group once it has enough parity rows
+ *
+ * With n packets missing and rows r_0..r_n-1 received, each row minus
+ * the received packets' share leaves s_a = sum_b C[r_a][e_b] * d_e_b;
+ * the n x n Cauchy submatrix is inverted and the packets rebuilt from
+ * the s_a straight into their history slots.
+ *
+ * @return true if packets were rebuilt
+ */
+bool
+FecDecoder::recover(Source& source, Group& group, FecRecovery& recovery)
+{
+    bool result = false;
+    const FecHeader& header = group.header;
+    size_t missing[FEC_MAX_DATA_PACKETS];
+    size_t rows[FEC_MAX_PARITY_PACKETS];
+    uint8_t matrix[FEC_MAX_PARITY_PACKETS * FEC_MAX_PARITY_PACKETS];
+    size_t count = countMissing(source, header, missing);
+    size_t length = header.parity_length;
+    size_t available = 0U;
+
+    if (count == 0U)
+    {
+        releaseGroup(group);
+        goto FecDecoder_recover_exit;
+    }
+
+    for (size_t row = 0U; (row < header.parity_count) && (available < count); row++)
+    {
+        if ((group.rows & (1U << row)) != 0U)
+        {
+            rows[available++] = row;
+        }
+    }
+
+    if ((available < count) || ((recovery.count + count) > recovery.frames.size()))
+    {
+        goto FecDecoder_recover_exit;
+    }
+
+    for (size_t a = 0U; a < count; a++)
+    {
+        uint8_t* syndrome = &m_scratch[a * FEC_MAX_FRAME_SIZE];
+
+        std::memcpy(syndrome, group.parity[rows[a]], length);
+        for (size_t idx = 0U, next = 0U; idx < header.data_count; idx++)
+        {
+            if ((next < count) && (missing[next] == idx))
+            {
+                next++;
+                continue;
+            }
+
+            const Frame& frame = source.history[(header.first_lifesign + idx) & HISTORY_MASK];
+            Gf256::mulAdd(syndrome, frame.data, FecEncoder::coefficient(rows[a], idx),
+                          std::min<size_t>(frame.length, length));
+        }
+
+        for (size_t b = 0U; b < count; b++)
+        {
+            matrix[(a * count) + b] = FecEncoder::coefficient(rows[a], missing[b]);
+        }
+    }
+
+    if (Gf256::invert(matrix, count) == false)
+    {
+        SeqLock::add(m_unrecoverable, count);
+        releaseGroup(group);
+        goto FecDecoder_recover_exit;
+    }
+
+    for (size_t b = 0U; b < count; b++)
+    {
+        uint16_t lifesign = static_cast<uint16_t>(header.first_lifesign + missing[b]);
+        Frame& frame = source.history[lifesign & HISTORY_MASK];
+
+        std::memset(frame.data, 0, length);
+        for (size_t a = 0U; a < count; a++)
+        {
+            Gf256::mulAdd(frame.data, &m_scratch[a * FEC_MAX_FRAME_SIZE], matrix[(b * count) + a], length);
+        }
+        frame.lifesign = lifesign;
+        frame.length = header.lengths[missing[b]];
+
+        recovery.frames[recovery.count++] = {lifesign, frame.data, frame.length};
+    }
+
+    SeqLock::add(m_recovered, count);
+    releaseGroup(group);
+    result = true;
+
+FecDecoder_recover_exit:
+    return result;
+}
+
+/**
+ * @brief Free a group slot
+ */
+void
+FecDecoder::releaseGroup(Group& group)
+{
+    group.used = false;
+    group.rows = 0U;
+}
+
+/**
+ * @brief In-memory FEC benchmark
+ *
+ * First every GF(2^8) kernel is checked against the table kernel and
+ * timed. Then, per code (K+M) and loss rate, packets with a 256 B payload
+ * are encoded, folded into parity, dropped at random and fed to the
+ * decoder; each rebuilt packet is compared with the one sent. Residual
+ * loss is what FEC could not rebuild; cost is per packet sent/received.
+ */
+bool
+FecDecoder::benchmark(std::ostream& out)
+{
+    bool result = true;
+    std::vector<uint8_t> source(BENCH_KERNEL_SIZES[std::size(BENCH_KERNEL_SIZES) - 1U] + 64U);
+    std::vector<uint8_t> target(source.size());
+    std::vector<uint8_t> reference(source.size());
+    std::vector<uint8_t> sent(FEC_HISTORY_SIZE * APP_PACKET_MAX_DATA_SIZE);
+    std::vector<uint8_t> payload(BENCH_PAYLOAD_SIZE);
+    uint8_t wire[APP_PACKET_MAX_DATA_SIZE + sizeof(AppPacketHeader) + sizeof(AppPacketFooter)];
+    uint32_t seed = 0x12345678U;
+    auto random = [&seed]() -> uint32_t
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        return seed >> 8U;
+    };
+
+    TscClock::calibrate();
+
+    for (uint8_t& byte : source)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+
+    out << "GF(2^8) multiply-add kernels (GB/s, single thread)\n";
+    out << std::format("{:<9}", "Kernel");
+    for (size_t size : BENCH_KERNEL_SIZES)
+    {
+        out << std::format(" {:>9}", std::format("{} B", size));
+    }
+    out << "\n";
+
+    for (size_t implIdx = 0U; implIdx < static_cast<size_t>(GfImpl::Count); implIdx++)
+    {
+        GfImpl impl = static_cast<GfImpl>(implIdx);
+        bool correct = true;
+
+        if (Gf256::isSupported(impl) == false)
+        {
+            continue;
+        }
+
+        /* Cross-check every length up to 300 bytes, every coefficient, odd alignments */
+        for (size_t length = 0U; (length <= 300U) && (correct == true); length++)
+        {
+            uint8_t coefficient = static_cast<uint8_t>(length * 7U);
+            const uint8_t* data = source.data() + (length % 7U);
+
+            std::memcpy(target.data(), source.data() + 1024U, length);
+            std::memcpy(reference.data(), source.data() + 1024U, length);
+            Gf256::mulAddWith(impl, target.data(), data, coefficient, length);
+            Gf256::mulAddWith(GfImpl::Table, reference.data(), data, coefficient, length);
+            correct = (std::memcmp(target.data(), reference.data(), length) == 0);
+        }
+
+        out << std::format("{:<9}", Gf256::implName(impl));
+
+        for (size_t size : BENCH_KERNEL_SIZES)
+        {
+            uint64_t bytes = 0U;
+            auto start = std::chrono::steady_clock::now();
+            std::chrono::duration<double> elapsed(0.0);
+
+            do
+            {
+                for (size_t rep = 0U; rep < 64U; rep++)
+                {
+                    Gf256::mulAddWith(impl, target.data(), source.data() + (rep & 7U),
+                                      static_cast<uint8_t>(rep | 2U), size);
+                }
+                bytes += 64U * size;
+                elapsed = std::chrono::steady_clock::now() - start;
+            }
+            while (elapsed.count() < BENCH_SECONDS_PER_CASE);
+
+            out << std::format(" {:>9.2f}", static_cast<double>(bytes) / elapsed.count() / 1e9);
+        }
+
+        out << ((correct == true) ? "\n" : "  MISMATCH\n");
+        result = (result == true) && (correct == true);
+    }
+
+    out << std::format("Selected: {} (check {:02x})\n\n", Gf256::implName(Gf256::getSelected()), target[0]);
+
+    out << std::format("FEC benchmark ({} B payload, {} packets per case, random loss)\n",
+                       BENCH_PAYLOAD_SIZE, BENCH_PACKETS_PER_CASE);
+    out << std::format("{:>6} {:>6} {:>9} {:>10} {:>10} {:>9} {:>11} {:>11}\n",
+                       "Code", "Loss", "Overhead", "Lost", "Recovered", "Residual", "Enc ns/pkt", "Dec ns/pkt");
+
+    for (const auto& code : BENCH_CODES)
+    {
+        for (double loss : BENCH_LOSS_RATES)
+        {
+            FecEncoder encoder;
+            FecDecoder decoder;
+            AppPacket packet;
+            AppPacket parity_packet;
+            FecRecovery recovery = {};
+            uint64_t lost = 0U;
+            uint64_t received = 0U;
+            uint32_t loss_threshold = static_cast<uint32_t>(loss * static_cast<double>(1U << 24U));
+
+            encoder.initialize(code[0], code[1]);
+            decoder.initialize(1U);
+            packet.setUniqueId(0xFEC0U);
+            parity_packet.setUniqueId(0xFEC0U);
+
+            /* One packet through the channel and the decoder */
+            auto transmit = [&](const AppPacketGather& gather, bool data)
+            {
+                size_t offset = 0U;
+
+                for (size_t piece = 0U; piece < gather.iovcnt; piece++)
+                {
+                    std::memcpy(&wire[offset], gather.iov[piece].iov_base, gather.iov[piece].iov_len);
+                    offset += gather.iov[piece].iov_len;
+                }
+
+                if (data == true)
+                {
+                    std::memcpy(&sent[(gather.header.lifesign & HISTORY_MASK) * APP_PACKET_MAX_DATA_SIZE],
+                                wire, offset);
+                }
+
+                if ((random() & 0xFFFFFFU) < loss_threshold)
+                {
+                    lost += (data == true) ? 1U : 0U;
+                    return;
+                }
+
+                received++;
+                decoder.add(AppPacketView(wire, offset), recovery);
+
+                for (size_t idx = 0U; idx < recovery.count; idx++)
+                {
+                    const FecRecovery::Frame& frame = recovery.frames[idx];
+                    AppPacketView view(frame.data, frame.length);
+
+                    result = (result == true) && (view.isValid() == true) &&
+                             (std::memcmp(frame.data, &sent[(frame.lifesign & HISTORY_MASK) * APP_PACKET_MAX_DATA_SIZE],
+                                          frame.length) == 0);
+                }
+            };
+
+            for (size_t count = 0U; count < BENCH_PACKETS_PER_CASE; count++)
+            {
+                AppPacketGather gather;
+
+                for (uint8_t& byte : payload)
+                {
+                    byte = static_cast<uint8_t>(random());
+                }
+                packet.setDataPointer(payload.data(), payload.size());
+                packet.encodeGather(gather);
+
+                bool complete = encoder.add(gather.header.lifesign, gather.iov, gather.iovcnt);
+
+                transmit(gather, true);
+                while ((complete == true) && (encoder.encodeParity(parity_packet, gather) == true))
+                {
+                    transmit(gather, false);
+                }
+            }
+
+            FecEncoderStats encoded = encoder.getStats();
+            FecDecoderStats decoded = decoder.getStats();
+
+            out << std::format("{:>3}+{:<2} {:>5.1f}% {:>8.1f}% {:>10} {:>10} {:>8.3f}% {:>11.1f} {:>11.1f}\n",
+                               code[0], code[1], loss * 100.0,
+                               100.0 * static_cast<double>(code[1]) / static_cast<double>(code[0]),
+                               lost, decoded.recovered,
+                               100.0 * static_cast<double>(lost - std::min(lost, decoded.recovered)) /
+                                   static_cast<double>(BENCH_PACKETS_PER_CASE),
+                               static_cast<double>(encoded.encodeNs) / static_cast<double>(encoded.dataPackets),
+                               static_cast<double>(decoded.decodeNs) / static_cast<double>(std::max<uint64_t>(1U, received)));
+        }
+    }
+
+    out << ((result == true) ? "All rebuilt packets verified\n" : "MISMATCH in a rebuilt packet\n");
+
+    return result;
+}
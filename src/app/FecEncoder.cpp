@@ -0,0 +1,262 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file FecEncoder.cpp
+ * @ingroup app
+ * @class FecEncoder
+ * @brief Forward error correction: parity packets over groups of sent packets
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cstring>
+
+#include "app/FecEncoder.hpp"
+#include "app/Gf256.hpp"
+#include "timer/TscClock.hpp"
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+FecEncoder::FecEncoder()
+    : m_data_count(0U),
+      m_parity_count(0U),
+      m_added(0U),
+      m_next_parity(0U),
+      m_dirty(0U),
+      m_header{},
+      m_stats{}
+{
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Set the group shape and allocate the parity rows
+ *
+ * @param[in] data_count    K, 1..FEC_MAX_DATA_PACKETS
+ * @param[in] parity_count  M, 1..FEC_MAX_PARITY_PACKETS (1 = XOR parity)
+ * @return true if successful
+ */
+bool
+FecEncoder::initialize(size_t data_count, size_t parity_count)
+{
+    bool result = false;
+
+    if ((data_count == 0U) || (data_count > FEC_MAX_DATA_PACKETS) ||
+        (parity_count == 0U) || (parity_count > FEC_MAX_PARITY_PACKETS))
+    {
+        goto FecEncoder_initialize_exit;
+    }
+
+    /* assign() writes every byte, so the rows are resident before the first packet */
+    m_parity.assign(parity_count * FEC_MAX_FRAME_SIZE, 0U);
+    m_data_count   = data_count;
+    m_parity_count = parity_count;
+    m_added        = 0U;
+    m_next_parity  = parity_count;
+    m_dirty        = 0U;
+    m_stats        = {};
+    result = true;
+
+FecEncoder_initialize_exit:
+    return result;
+}
+
+/**
+ * @brief Fold one encoded data packet into the open group
+ */
+bool
+FecEncoder::add(uint16_t lifesign, const struct iovec* iov, size_t iovcnt)
+{
+    bool complete = false;
+    uint64_t start = TscClock::now();
+    size_t length = 0U;
+    size_t offset = 0U;
+
+    for (size_t piece = 0U; piece < iovcnt; piece++)
+    {
+        length += iov[piece].iov_len;
+    }
+
+    if (isEnabled() == false)
+    {
+        /* FEC off: nothing was meant to be protected */
+        goto FecEncoder_add_exit;
+    }
+
+    if ((length == 0U) || (length > FEC_MAX_FRAME_SIZE))
+    {
+        m_stats.skipped++;
+        goto FecEncoder_add_exit;
+    }
+
+    if ((m_added > 0U) && (m_added < m_data_count) &&
+        (lifesign != static_cast<uint16_t>(m_header.first_lifesign + m_added)))
+    {
+        /* Not consecutive: the open group can never be decoded */
+        m_stats.skipped += m_added;
+        m_added = 0U;
+    }
+
+    if ((m_added == 0U) || (m_added == m_data_count))
+    {
+        startGroup(lifesign);
+    }
+
+    for (size_t piece = 0U; piece < iovcnt; piece++)
+    {
+        const uint8_t* data = static_cast<const uint8_t*>(iov[piece].iov_base);
+
+        for (size_t row = 0U; row < m_parity_count; row++)
+        {
+            Gf256::mulAdd(&m_parity[(row * FEC_MAX_FRAME_SIZE) + offset], data,
+                          coefficient(row, m_added), iov[piece].iov_len);
+        }
+        offset += iov[piece].iov_len;
+    }
+
+    m_header.lengths[m_added] = static_cast<uint16_t>(length);
+    m_header.parity_length = std::max(m_header.parity_length, static_cast<uint16_t>(length));
+    m_dirty = std::max(m_dirty, length);
+    m_added++;
+    m_stats.dataPackets++;
+
+    if (m_added == m_data_count)
+    {
+        m_next_parity = 0U;
+        complete = true;
+    }
+
+FecEncoder_add_exit:
+    m_stats.encodeNs += TscClock::now() - start;    /* Ticks until getStats() */
+    return complete;
+}
+
+/**
+ * @brief Encode the next parity packet of the completed group
+ *
+ * @param[in,out] packet  Parity encoder, apart from the data packets' one (takes its next lifesign)
+ * @param[out]    gather  Packet pieces: header, FEC header, parity, footer
+ * @return true if a parity packet was encoded, false once all M are done
+ */
+bool
+FecEncoder::encodeParity(AppPacket& packet, AppPacketGather& gather)
+{
+    bool result = false;
+    uint64_t start = TscClock::now();
+    struct iovec payload[APP_PACKET_MAX_PAYLOAD_PIECES];
+
+    if ((m_added != m_data_count) || (m_next_parity >= m_parity_count))
+    {
+        goto FecEncoder_encodeParity_exit;
+    }
+
+    m_header.parity_index = static_cast<uint8_t>(m_next_parity);
+
+    payload[0] = {&m_header, sizeof(m_header)};
+    payload[1] = {&m_parity[m_next_parity * FEC_MAX_FRAME_SIZE], m_header.parity_length};
+
+    if (packet.encodeGather(gather, payload, APP_PACKET_MAX_PAYLOAD_PIECES, APP_PACKET_FLAG_FEC_PARITY) > 0U)
+    {
+        m_next_parity++;
+        m_stats.parityPackets++;
+        if (m_next_parity == m_parity_count)
+        {
+            m_stats.groups++;
+        }
+        result = true;
+    }
+
+    m_stats.encodeNs += TscClock::now() - start;
+
+FecEncoder_encodeParity_exit:
+    return result;
+}
+
+/**
+ * @brief Check whether initialize() succeeded
+ */
+bool
+FecEncoder::isEnabled(void) const
+{
+    return (m_data_count > 0U);
+}
+
+/**
+ * @brief Get K
+ */
+size_t
+FecEncoder::getDataCount(void) const
+{
+    return m_data_count;
+}
+
+/**
+ * @brief Get M
+ */
+size_t
+FecEncoder::getParityCount(void) const
+{
+    return m_parity_count;
+}
+
+/**
+ * @brief Get the counters, encode time in nanoseconds
+ */
+FecEncoderStats
+FecEncoder::getStats(void) const
+{
+    FecEncoderStats stats = m_stats;
+
+    stats.encodeNs = TscClock::toNanoseconds(m_stats.encodeNs);
+
+    return stats;
+}
+
+/**
+ * @brief Generator coefficient: Cauchy 1 / (x + y), column scaled by y to make row 0 ones
+ *
+ * x = parity_index is below FEC_MAX_PARITY_PACKETS and y =
+ * FEC_MAX_PARITY_PACKETS + data_index is not, so x + y (XOR) is never 0
+ * and every square submatrix is invertible; scaling a column keeps it so.
+ */
+uint8_t
+FecEncoder::coefficient(size_t parity_index, size_t data_index)
+{
+    uint8_t y = static_cast<uint8_t>(FEC_MAX_PARITY_PACKETS + data_index);
+
+    return Gf256::mul(y, Gf256::inverse(static_cast<uint8_t>(parity_index ^ y)));
+}
+
+/**
+ * @brief Clear the parity rows and open a group at a lifesign
+ */
+void
+FecEncoder::startGroup(uint16_t lifesign)
+{
+    for (size_t row = 0U; row < m_parity_count; row++)
+    {
+        std::memset(&m_parity[row * FEC_MAX_FRAME_SIZE], 0, m_dirty);
+    }
+
+    m_header = {};
+    m_header.first_lifesign = lifesign;
+    m_header.data_count     = static_cast<uint8_t>(m_data_count);
+    m_header.parity_count   = static_cast<uint8_t>(m_parity_count);
+    m_added       = 0U;
+    m_next_parity = m_parity_count;
+    m_dirty       = 0U;
+}
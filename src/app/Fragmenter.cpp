@@ -0,0 +1,152 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Fragmenter.cpp
+ * @ingroup app
+ * @class Fragmenter
+ * @brief Splits large messages into MTU-sized application packets
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+
+#include "app/Fragmenter.hpp"
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+Fragmenter::Fragmenter()
+    : m_message(nullptr),
+      m_length(0U),
+      m_message_id(0U),
+      m_count(0U),
+      m_next_index(0U),
+      m_header{}
+{
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Number of fragments a message of the given length needs
+ *
+ * @param[in] length  Message length in bytes
+ * @return Fragment count, 0 if the message is empty or too large
+ */
+uint16_t
+Fragmenter::fragmentCount(size_t length)
+{
+    uint16_t count = 0U;
+
+    if ((length > 0U) && (length <= FRAGMENT_MAX_MESSAGE_SIZE))
+    {
+        count = static_cast<uint16_t>((length + FRAGMENT_MAX_DATA_SIZE - 1U) / FRAGMENT_MAX_DATA_SIZE);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Start a new message (any unfinished message is abandoned)
+ *
+ * @param[in] message  Message bytes (not copied, must stay valid)
+ * @param[in] length   Message length, 1..FRAGMENT_MAX_MESSAGE_SIZE
+ * @return true if the message will be fragmented
+ */
+bool
+Fragmenter::begin(const uint8_t* message, size_t length)
+{
+    bool result = false;
+    uint16_t count = fragmentCount(length);
+
+    if ((message != nullptr) && (count > 0U))
+    {
+        m_message    = message;
+        m_length     = length;
+        m_count      = count;
+        m_next_index = 0U;
+        m_message_id++;
+        result = true;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Encode the next fragment of the current message
+ *
+ * @param[in,out] packet  Encoder (unique id, lifesign, CRC algorithm)
+ * @param[out]    gather  Packet pieces: header, fragment header, slice, footer
+ * @return true if a fragment was encoded, false once the message is done
+ */
+bool
+Fragmenter::next(AppPacket& packet, AppPacketGather& gather)
+{
+    bool result = false;
+    size_t offset = 0U;
+    struct iovec payload[APP_PACKET_MAX_PAYLOAD_PIECES];
+
+    if (isDone() == true)
+    {
+        goto Fragmenter_next_exit;
+    }
+
+    offset = static_cast<size_t>(m_next_index) * FRAGMENT_MAX_DATA_SIZE;
+
+    m_header.message_id     = m_message_id;
+    m_header.message_length = static_cast<uint32_t>(m_length);
+    m_header.offset         = static_cast<uint32_t>(offset);
+    m_header.index          = m_next_index;
+    m_header.count          = m_count;
+
+    payload[0] = {&m_header, sizeof(m_header)};
+    payload[1] = {const_cast<uint8_t*>(&m_message[offset]), std::min(FRAGMENT_MAX_DATA_SIZE, m_length - offset)};
+
+    if (packet.encodeGather(gather, payload, APP_PACKET_MAX_PAYLOAD_PIECES, APP_PACKET_FLAG_FRAGMENT) > 0U)
+    {
+        m_next_index++;
+        result = true;
+    }
+
+Fragmenter_next_exit:
+    return result;
+}
+
+/**
+ * @brief Check whether every fragment of the current message was encoded
+ */
+bool
+Fragmenter::isDone(void) const
+{
+    return (m_next_index >= m_count);
+}
+
+/**
+ * @brief Get the id of the current message
+ */
+uint32_t
+Fragmenter::getMessageId(void) const
+{
+    return m_message_id;
+}
+
+/**
+ * @brief Get the fragment count of the current message
+ */
+uint16_t
+Fragmenter::getFragmentCount(void) const
+{
+    return m_count;
+}
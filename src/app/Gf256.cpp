@@ -0,0 +1,446 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Gf256.cpp
+ * @ingroup app
+ * @class Gf256
+ * @brief GF(2^8) tables, region multiply kernels and CPUID dispatch
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "app/Gf256.hpp"
+
+#include <array>
+#include <cstring>
+#include <utility>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define GF256_X86_KERNELS 1
+#endif
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint32_t GF256_POLYNOMIAL   = 0x11DU;   /* x^8 + x^4 + x^3 + x^2 + 1 */
+static constexpr size_t   INVERT_MAX_SIZE    = 16U;      /* Largest matrix invert() accepts */
+
+/*******************************************************************************
+ * Type Definition
+ ******************************************************************************/
+using MulAddFunction = void (*)(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length);
+
+struct GfTables
+{
+    std::array<uint8_t, 512U> exp;      /**< Doubled so exp[log a + log b] needs no modulo */
+    std::array<uint8_t, 256U> log;      /**< log[0] unused */
+};
+
+/**
+ * @brief Per coefficient: products with every low nibble [0] and every high nibble [1]
+ */
+using NibbleTables = std::array<std::array<std::array<uint8_t, 16U>, 2U>, 256U>;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+static consteval GfTables
+makeTables()
+{
+    GfTables tables = {};
+    uint32_t value = 1U;
+
+    for (size_t power = 0U; power < 255U; power++)
+    {
+        tables.exp[power] = static_cast<uint8_t>(value);
+        tables.exp[power + 255U] = static_cast<uint8_t>(value);
+        tables.log[value] = static_cast<uint8_t>(power);
+        value <<= 1U;
+        if ((value & 0x100U) != 0U)
+        {
+            value ^= GF256_POLYNOMIAL;
+        }
+    }
+    tables.exp[510U] = tables.exp[0];
+    tables.exp[511U] = tables.exp[1];
+
+    return tables;
+}
+
+static constexpr GfTables GF_TABLES = makeTables();
+
+static constexpr uint8_t
+mulTable(uint8_t a, uint8_t b)
+{
+    return ((a == 0U) || (b == 0U)) ? 0U :
+           GF_TABLES.exp[static_cast<size_t>(GF_TABLES.log[a]) + GF_TABLES.log[b]];
+}
+
+static consteval NibbleTables
+makeNibbleTables()
+{
+    NibbleTables tables = {};
+
+    for (size_t coefficient = 0U; coefficient < 256U; coefficient++)
+    {
+        for (size_t nibble = 0U; nibble < 16U; nibble++)
+        {
+            tables[coefficient][0][nibble] = mulTable(static_cast<uint8_t>(coefficient), static_cast<uint8_t>(nibble));
+            tables[coefficient][1][nibble] = mulTable(static_cast<uint8_t>(coefficient),
+                                                      static_cast<uint8_t>(nibble << 4U));
+        }
+    }
+
+    return tables;
+}
+
+/* 8 KB: a call touches only the 32 bytes of its coefficient */
+alignas(64) static constexpr NibbleTables GF_NIBBLE_TABLES = makeNibbleTables();
+
+static void
+mulAddTable(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length)
+{
+    const uint8_t* low  = GF_NIBBLE_TABLES[coefficient][0].data();
+    const uint8_t* high = GF_NIBBLE_TABLES[coefficient][1].data();
+
+    for (size_t idx = 0U; idx < length; idx++)
+    {
+        dst[idx] ^= static_cast<uint8_t>(low[src[idx] & 0x0FU] ^ high[src[idx] >> 4U]);
+    }
+}
+
+#if defined(GF256_X86_KERNELS)
+
+__attribute__((target("ssse3")))
+static void
+mulAddSsse3(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length)
+{
+    const uint8_t* low  = GF_NIBBLE_TABLES[coefficient][0].data();
+    const uint8_t* high = GF_NIBBLE_TABLES[coefficient][1].data();
+    size_t idx = 0U;
+
+    const __m128i low_table  = _mm_load_si128(reinterpret_cast<const __m128i*>(low));
+    const __m128i high_table = _mm_load_si128(reinterpret_cast<const __m128i*>(high));
+    const __m128i mask       = _mm_set1_epi8(0x0F);
+
+    for (; (idx + 16U) <= length; idx += 16U)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[idx]));
+        __m128i product = _mm_xor_si128(
+            _mm_shuffle_epi8(low_table, _mm_and_si128(value, mask)),
+            _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi64(value, 4), mask)));
+        __m128i target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&dst[idx]));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[idx]), _mm_xor_si128(target, product));
+    }
+
+    for (; idx < length; idx++)
+    {
+        dst[idx] ^= static_cast<uint8_t>(low[src[idx] & 0x0FU] ^ high[src[idx] >> 4U]);
+    }
+}
+
+__attribute__((target("avx2")))
+static void
+mulAddAvx2(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length)
+{
+    const uint8_t* low  = GF_NIBBLE_TABLES[coefficient][0].data();
+    const uint8_t* high = GF_NIBBLE_TABLES[coefficient][1].data();
+    size_t idx = 0U;
+
+    /* vpshufb looks up within each 128-bit lane: same table in both */
+    const __m256i low_table  = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(low)));
+    const __m256i high_table = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(high)));
+    const __m256i mask       = _mm256_set1_epi8(0x0F);
+
+    for (; (idx + 32U) <= length; idx += 32U)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[idx]));
+        __m256i product = _mm256_xor_si256(
+            _mm256_shuffle_epi8(low_table, _mm256_and_si256(value, mask)),
+            _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi64(value, 4), mask)));
+        __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&dst[idx]));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[idx]), _mm256_xor_si256(target, product));
+    }
+
+    for (; idx < length; idx++)
+    {
+        dst[idx] ^= static_cast<uint8_t>(low[src[idx] & 0x0FU] ^ high[src[idx] >> 4U]);
+    }
+}
+
+#endif  // GF256_X86_KERNELS
+
+/**
+ * @brief dst ^= src, 8 bytes per step (the compiler vectorises the loop)
+ */
+static void
+xorRegion(uint8_t* dst, const uint8_t* src, size_t length)
+{
+    size_t idx = 0U;
+
+    for (; (idx + 8U) <= length; idx += 8U)
+    {
+        uint64_t target;
+        uint64_t value;
+        std::memcpy(&target, &dst[idx], sizeof(target));
+        std::memcpy(&value, &src[idx], sizeof(value));
+        target ^= value;
+        std::memcpy(&dst[idx], &target, sizeof(target));
+    }
+
+    for (; idx < length; idx++)
+    {
+        dst[idx] ^= src[idx];
+    }
+}
+
+/**
+ * @brief Kernel of an implementation, nullptr if not built in or not supported by the CPU
+ */
+static MulAddFunction
+kernelOf(GfImpl impl)
+{
+    MulAddFunction function = nullptr;
+
+    switch (impl)
+    {
+    case GfImpl::Table:
+        function = mulAddTable;
+        break;
+#if defined(GF256_X86_KERNELS)
+    case GfImpl::Ssse3:
+        if (__builtin_cpu_supports("ssse3") != 0)
+        {
+            function = mulAddSsse3;
+        }
+        break;
+    case GfImpl::Avx2:
+        if (__builtin_cpu_supports("avx2") != 0)
+        {
+            function = mulAddAvx2;
+        }
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return function;
+}
+
+/**
+ * @brief Kernel picked from CPUID on first use (thread-safe static init)
+ */
+struct GfDispatch
+{
+    MulAddFunction mulAdd;
+    GfImpl impl;
+};
+
+/**
+ * @brief Dispatch table, filled with the fastest supported kernel on first call
+ */
+static const GfDispatch&
+dispatch()
+{
+    static const GfDispatch table = []()
+    {
+        GfDispatch selected = {mulAddTable, GfImpl::Table};
+
+        /* Fastest first */
+        for (GfImpl impl : {GfImpl::Avx2, GfImpl::Ssse3})
+        {
+            if ((selected.impl == GfImpl::Table) && (kernelOf(impl) != nullptr))
+            {
+                selected.impl = impl;
+                selected.mulAdd = kernelOf(impl);
+            }
+        }
+
+        return selected;
+    }();
+
+    return table;
+}
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Product a * b
+ */
+uint8_t
+Gf256::mul(uint8_t a, uint8_t b)
+{
+    return mulTable(a, b);
+}
+
+/**
+ * @brief Multiplicative inverse of a (0 maps to 0)
+ */
+uint8_t
+Gf256::inverse(uint8_t a)
+{
+    return (a == 0U) ? 0U : GF_TABLES.exp[255U - GF_TABLES.log[a]];
+}
+
+/**
+ * @brief Region multiply-add: XOR for 1, nothing for 0, else the dispatched kernel
+ */
+void
+Gf256::mulAdd(uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length)
+{
+    if (coefficient == 1U)
+    {
+        xorRegion(dst, src, length);
+    }
+    else if (coefficient != 0U)
+    {
+        dispatch().mulAdd(dst, src, coefficient, length);
+    }
+}
+
+/**
+ * @brief Region multiply-add with a given kernel, or the dispatched one if unsupported
+ */
+void
+Gf256::mulAddWith(GfImpl impl, uint8_t* dst, const uint8_t* src, uint8_t coefficient, size_t length)
+{
+    MulAddFunction function = kernelOf(impl);
+
+    if (function == nullptr)
+    {
+        function = dispatch().mulAdd;
+    }
+
+    function(dst, src, coefficient, length);
+}
+
+/**
+ * @brief Gauss-Jordan on [matrix | identity], written back only on success
+ *
+ * @return false if the matrix is singular or size is 0 or above INVERT_MAX_SIZE
+ */
+bool
+Gf256::invert(uint8_t* matrix, size_t size)
+{
+    bool result = true;
+    uint8_t work[INVERT_MAX_SIZE][INVERT_MAX_SIZE * 2U] = {};
+
+    if ((size == 0U) || (size > INVERT_MAX_SIZE))
+    {
+        result = false;
+        goto Gf256_invert_exit;
+    }
+
+    /* [matrix | identity] -> [identity | inverse] */
+    for (size_t row = 0U; row < size; row++)
+    {
+        std::memcpy(work[row], &matrix[row * size], size);
+        work[row][size + row] = 1U;
+    }
+
+    for (size_t col = 0U; (col < size) && (result == true); col++)
+    {
+        size_t pivot = col;
+
+        while ((pivot < size) && (work[pivot][col] == 0U))
+        {
+            pivot++;
+        }
+        if (pivot == size)
+        {
+            result = false;
+            break;
+        }
+        if (pivot != col)
+        {
+            std::swap(work[pivot], work[col]);
+        }
+
+        uint8_t scale = inverse(work[col][col]);
+        for (size_t idx = 0U; idx < (size * 2U); idx++)
+        {
+            work[col][idx] = mulTable(work[col][idx], scale);
+        }
+
+        for (size_t row = 0U; row < size; row++)
+        {
+            uint8_t factor = work[row][col];
+
+            if ((row != col) && (factor != 0U))
+            {
+                for (size_t idx = 0U; idx < (size * 2U); idx++)
+                {
+                    work[row][idx] ^= mulTable(factor, work[col][idx]);
+                }
+            }
+        }
+    }
+
+    if (result == true)
+    {
+        for (size_t row = 0U; row < size; row++)
+        {
+            std::memcpy(&matrix[row * size], &work[row][size], size);
+        }
+    }
+
+Gf256_invert_exit:
+    return result;
+}
+
+/**
+ * @brief Whether impl is built in and supported by the CPU
+ */
+bool
+Gf256::isSupported(GfImpl impl)
+{
+    return (kernelOf(impl) != nullptr);
+}
+
+/**
+ * @brief Kernel mulAdd() dispatches to
+ */
+GfImpl
+Gf256::getSelected(void)
+{
+    return dispatch().impl;
+}
+
+/**
+ * @brief Short name of an implementation, as printed by the benchmark
+ */
+const char*
+Gf256::implName(GfImpl impl)
+{
+    const char* name = "unknown";
+
+    switch (impl)
+    {
+    case GfImpl::Table:
+        name = "table";
+        break;
+    case GfImpl::Ssse3:
+        name = "ssse3";
+        break;
+    case GfImpl::Avx2:
+        name = "avx2";
+        break;
+    default:
+        break;
+    }
+
+    return name;
+}
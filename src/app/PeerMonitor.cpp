@@ -0,0 +1,606 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file PeerMonitor.cpp
+ * @ingroup app
+ * @class PeerMonitor
+ * @brief Lifesign monitor for many peers, with deadlines on a timer wheel
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <format>
+
+#include "app/PeerMonitor.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint64_t NSEC_PER_USEC = 1000U;
+static constexpr uint64_t NSEC_PER_MSEC = 1000000U;
+static constexpr uint32_t HASH_MULTIPLIER = 2654435761U;   /**< Fibonacci hashing */
+
+static constexpr size_t   BENCH_PEER_COUNTS[] = {1000U, 10000U, 100000U};
+static constexpr uint32_t BENCH_INTERVAL_MS   = 100U;   /**< Lifesign period of every peer */
+static constexpr uint32_t BENCH_TOLERANCE_US  = 5000U;
+static constexpr uint32_t BENCH_TIMEOUT_MS    = 1000U;
+static constexpr uint32_t BENCH_DURATION_MS   = 5000U;  /**< Simulated time */
+static constexpr uint32_t BENCH_SILENT_AT_MS  = 1000U;  /**< 1 % of peers stop sending here */
+static constexpr uint32_t BENCH_POLL_MS       = 10U;    /**< Deadline check period */
+
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+static uint64_t
+steadyNowNs(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+PeerMonitor::PeerMonitor()
+    : m_comm_timeout_ns(static_cast<uint64_t>(APP_PACKET_COMM_TIMEOUT_MS) * NSEC_PER_MSEC),
+      m_expected_interval_ns(static_cast<uint64_t>(APP_PACKET_EXPECTED_INTERVAL_MS) * NSEC_PER_MSEC),
+      m_tolerance_ns(static_cast<uint64_t>(APP_PACKET_INTERVAL_TOLERANCE_US) * NSEC_PER_USEC),
+      m_base_ns(0U),
+      m_count(0U),
+      m_index_shift(32U),
+      m_armed(0U),
+      m_untracked(0U)
+{
+    for (std::atomic<size_t>& count : m_state_counts)
+    {
+        count.store(0U, std::memory_order_relaxed);
+    }
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Allocate the peer table, index and timer wheel
+ *
+ * @param[in] max_peers  Peers tracked at once; later senders are counted as untracked
+ * @param[in] now_ns     Monotonic time (steady_clock ns), the same clock as update()/poll()
+ * @return false if max_peers is 0 or too large
+ */
+bool
+PeerMonitor::initialize(size_t max_peers, uint64_t now_ns)
+{
+    bool result = false;
+    size_t index_size = 0U;
+
+    if ((max_peers == 0U) || (max_peers >= (PEER_MONITOR_NONE / 2U)))
+    {
+        goto PeerMonitor_initialize_exit;
+    }
+
+    /* At most half full: short probe sequences */
+    index_size = std::bit_ceil(max_peers * 2U);
+
+    if (m_wheel.initialize(max_peers, 0U) == false)
+    {
+        goto PeerMonitor_initialize_exit;
+    }
+
+    m_ids.assign(max_peers, 0U);
+    m_last_rx_ns       = std::vector<std::atomic<uint64_t>>(max_peers);
+    m_last_change_ns   = std::vector<std::atomic<uint64_t>>(max_peers);
+    m_interval_us      = std::vector<std::atomic<uint32_t>>(max_peers);
+    m_lifesign         = std::vector<std::atomic<uint16_t>>(max_peers);
+    m_unstable_counter = std::vector<std::atomic<uint16_t>>(max_peers);
+    m_state            = std::vector<std::atomic<PeerState>>(max_peers);
+    m_index.assign(index_size, 0U);
+    m_index_shift = 32U - static_cast<uint32_t>(std::countr_zero(index_size));
+    m_base_ns = now_ns;
+    m_armed = 0U;
+    m_count.store(0U, std::memory_order_relaxed);
+    m_untracked.store(0U, std::memory_order_relaxed);
+    for (std::atomic<size_t>& count : m_state_counts)
+    {
+        count.store(0U, std::memory_order_relaxed);
+    }
+    result = true;
+
+PeerMonitor_initialize_exit:
+    return result;
+}
+
+/**
+ * @brief Set the time a frozen lifesign takes to become Lost
+ */
+void
+PeerMonitor::setCommTimeout(uint32_t timeout_ms)
+{
+    m_comm_timeout_ns = static_cast<uint64_t>(timeout_ms) * NSEC_PER_MSEC;
+}
+
+/**
+ * @brief Set the expected packet interval and its tolerance
+ */
+void
+PeerMonitor::setExpectedInterval(uint32_t interval_ms, uint32_t tolerance_us)
+{
+    m_expected_interval_ns = static_cast<uint64_t>(interval_ms) * NSEC_PER_MSEC;
+    m_tolerance_ns         = static_cast<uint64_t>(tolerance_us) * NSEC_PER_USEC;
+}
+
+/**
+ * @brief Set the function called on every state change (from either thread)
+ */
+void
+PeerMonitor::setStateCallback(StateCallback callback)
+{
+    m_callback = std::move(callback);
+}
+
+/**
+ * @brief Record the lifesign of a valid packet
+ *
+ * @param[in] unique_id  Sender, e.g. AppPacketView::getUniqueId()
+ * @param[in] lifesign   e.g. AppPacketView::getLifesign()
+ * @param[in] now_ns     Receive time (steady_clock ns), may be shared by a batch
+ * @return Peer index for getStatus(), PEER_MONITOR_NONE if the table is full
+ */
+uint32_t
+PeerMonitor::update(uint32_t unique_id, uint16_t lifesign, uint64_t now_ns)
+{
+    bool added = false;
+    uint32_t index = findOrAdd(unique_id, now_ns, added);
+    uint64_t interval_ns = 0U;
+    uint64_t lower_bound = 0U;
+    uint16_t unstable_counter = 0U;
+    PeerState state = PeerState::Unknown;
+    PeerState next = PeerState::Up;
+
+    if (index == PEER_MONITOR_NONE)
+    {
+        m_untracked.store(m_untracked.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        goto PeerMonitor_update_exit;
+    }
+
+    if (added == true)
+    {
+        m_lifesign[index].store(lifesign, std::memory_order_relaxed);
+        transition(index, PeerState::Unknown, PeerState::Up);
+        goto PeerMonitor_update_exit;
+    }
+
+    interval_ns = now_ns - m_last_rx_ns[index].load(std::memory_order_relaxed);
+    m_last_rx_ns[index].store(now_ns, std::memory_order_relaxed);
+    m_interval_us[index].store(static_cast<uint32_t>(interval_ns / NSEC_PER_USEC), std::memory_order_relaxed);
+
+    /* Interval stability: out-of-tolerance intervals in a row */
+    unstable_counter = m_unstable_counter[index].load(std::memory_order_relaxed);
+    if (m_expected_interval_ns > m_tolerance_ns)
+    {
+        lower_bound = m_expected_interval_ns - m_tolerance_ns;
+    }
+    if ((interval_ns < lower_bound) || (interval_ns > (m_expected_interval_ns + m_tolerance_ns)))
+    {
+        if (unstable_counter < UINT16_MAX)
+        {
+            unstable_counter++;
+        }
+        next = PeerState::Unstable;
+    }
+    else
+    {
+        unstable_counter = 0U;
+    }
+    m_unstable_counter[index].store(unstable_counter, std::memory_order_relaxed);
+
+    state = m_state[index].load(std::memory_order_relaxed);
+    if (m_lifesign[index].load(std::memory_order_relaxed) != lifesign)
+    {
+        m_last_change_ns[index].store(now_ns, std::memory_order_relaxed);
+        m_lifesign[index].store(lifesign, std::memory_order_relaxed);
+    }
+    else if (state == PeerState::Lost)
+    {
+        /* Packets with a frozen lifesign do not bring a peer back */
+        next = PeerState::Lost;
+    }
+
+    if (next != state)
+    {
+        transition(index, state, next);
+    }
+
+PeerMonitor_update_exit:
+    return index;
+}
+
+/**
+ * @brief Handle every deadline reached by now
+ *
+ * Peers added since the last call are put on the wheel first. Call
+ * periodically; the period bounds how late a state change is seen.
+ *
+ * @param[in] now_ns  Monotonic time (steady_clock ns)
+ * @return Number of deadlines handled
+ */
+size_t
+PeerMonitor::poll(uint64_t now_ns)
+{
+    size_t count = m_count.load(std::memory_order_acquire);
+    size_t expired = 0U;
+
+    for (; m_armed < count; m_armed++)
+    {
+        evaluate(static_cast<uint32_t>(m_armed), now_ns);
+    }
+
+    expired = m_wheel.advance(toTick(now_ns), [this, now_ns](uint32_t index)
+    {
+        evaluate(index, now_ns);
+    });
+
+    return expired;
+}
+
+/**
+ * @brief Get the number of peers seen so far
+ */
+size_t
+PeerMonitor::getPeerCount(void) const
+{
+    return m_count.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Copy one peer's state
+ *
+ * @param[in]  index   Below getPeerCount(), or returned by update()
+ * @param[in]  now_ns  Monotonic time for since_change_ms
+ * @param[out] status  Each field whole, not necessarily from the same update
+ * @return false if the index is not a peer
+ */
+bool
+PeerMonitor::getStatus(uint32_t index, uint64_t now_ns, PeerStatus& status) const
+{
+    bool result = false;
+    uint64_t last_change_ns = 0U;
+
+    if (index < getPeerCount())
+    {
+        last_change_ns = m_last_change_ns[index].load(std::memory_order_relaxed);
+
+        status.unique_id        = m_ids[index];
+        status.state            = m_state[index].load(std::memory_order_relaxed);
+        status.lifesign         = m_lifesign[index].load(std::memory_order_relaxed);
+        status.last_interval_us = m_interval_us[index].load(std::memory_order_relaxed);
+        status.unstable_counter = m_unstable_counter[index].load(std::memory_order_relaxed);
+        status.since_change_ms  = (now_ns > last_change_ns) ?
+                                  static_cast<uint32_t>((now_ns - last_change_ns) / NSEC_PER_MSEC) : 0U;
+        result = true;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Get the number of peers in a state
+ */
+size_t
+PeerMonitor::getStateCount(PeerState state) const
+{
+    return m_state_counts[static_cast<size_t>(state)].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of packets from peers that did not fit the table
+ */
+uint64_t
+PeerMonitor::getUntrackedCount(void) const
+{
+    return m_untracked.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the configured communication timeout
+ *
+ * @return Timeout in milliseconds
+ */
+uint32_t
+PeerMonitor::getCommTimeout(void) const
+{
+    return static_cast<uint32_t>(m_comm_timeout_ns / NSEC_PER_MSEC);
+}
+
+/**
+ * @brief Printable name of a state
+ */
+const char*
+PeerMonitor::stateName(PeerState state)
+{
+    const char* name = "Unknown";
+
+    switch (state)
+    {
+    case PeerState::Up:
+        name = "Up";
+        break;
+    case PeerState::Unstable:
+        name = "Unstable";
+        break;
+    case PeerState::Lost:
+        name = "Lost";
+        break;
+    default:
+        break;
+    }
+
+    return name;
+}
+
+/**
+ * @brief Find a peer, adding it on first sight (writer thread)
+ *
+ * A new peer's fields are set before m_count publishes it.
+ */
+uint32_t
+PeerMonitor::findOrAdd(uint32_t unique_id, uint64_t now_ns, bool& added)
+{
+    uint32_t index = PEER_MONITOR_NONE;
+    size_t mask = m_index.size() - 1U;
+    size_t count = m_count.load(std::memory_order_relaxed);
+    size_t slot = (m_index_shift < 32U) ? ((unique_id * HASH_MULTIPLIER) >> m_index_shift) : 0U;
+
+    added = false;
+
+    if (m_index.empty() == true)
+    {
+        goto PeerMonitor_findOrAdd_exit;
+    }
+
+    /* Linear probing; never more than half full */
+    while (m_index[slot] != 0U)
+    {
+        if (m_ids[m_index[slot] - 1U] == unique_id)
+        {
+            index = m_index[slot] - 1U;
+            goto PeerMonitor_findOrAdd_exit;
+        }
+        slot = (slot + 1U) & mask;
+    }
+
+    if (count >= m_ids.size())
+    {
+        goto PeerMonitor_findOrAdd_exit;
+    }
+
+    index = static_cast<uint32_t>(count);
+    m_ids[index] = unique_id;
+    m_last_rx_ns[index].store(now_ns, std::memory_order_relaxed);
+    m_last_change_ns[index].store(now_ns, std::memory_order_relaxed);
+    m_interval_us[index].store(0U, std::memory_order_relaxed);
+    m_unstable_counter[index].store(0U, std::memory_order_relaxed);
+    m_state[index].store(PeerState::Unknown, std::memory_order_relaxed);
+    m_state_counts[static_cast<size_t>(PeerState::Unknown)].fetch_add(1U, std::memory_order_relaxed);
+    m_index[slot] = index + 1U;
+    m_count.store(count + 1U, std::memory_order_release);
+    added = true;
+
+PeerMonitor_findOrAdd_exit:
+    return index;
+}
+
+/**
+ * @brief Move a peer from one state to another unless the other thread got there first
+ *
+ * @return true if this call made the change (and ran the callback)
+ */
+bool
+PeerMonitor::transition(uint32_t index, PeerState from, PeerState to)
+{
+    bool result = m_state[index].compare_exchange_strong(from, to, std::memory_order_relaxed);
+
+    if (result == true)
+    {
+        m_state_counts[static_cast<size_t>(from)].fetch_sub(1U, std::memory_order_relaxed);
+        m_state_counts[static_cast<size_t>(to)].fetch_add(1U, std::memory_order_relaxed);
+
+        if (m_callback)
+        {
+            m_callback(m_ids[index], from, to);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Check a peer whose deadline came, change its state, re-arm its entry
+ *
+ * Lost peers are re-checked once per comm timeout: recovery is normally
+ * seen by update() first, the re-check only heals a lost race.
+ */
+void
+PeerMonitor::evaluate(uint32_t index, uint64_t now_ns)
+{
+    uint64_t loss_deadline = m_last_change_ns[index].load(std::memory_order_relaxed) + m_comm_timeout_ns;
+    uint64_t late_deadline = m_last_rx_ns[index].load(std::memory_order_relaxed) +
+                             m_expected_interval_ns + m_tolerance_ns;
+    PeerState state = m_state[index].load(std::memory_order_relaxed);
+    PeerState next = state;
+    uint64_t next_deadline = 0U;
+
+    if (now_ns >= loss_deadline)
+    {
+        next = PeerState::Lost;
+        next_deadline = now_ns + m_comm_timeout_ns;
+    }
+    else if (now_ns >= late_deadline)
+    {
+        /* Overdue: unstable now, look again one interval later */
+        next = PeerState::Unstable;
+        next_deadline = std::min(loss_deadline, now_ns + m_expected_interval_ns + m_tolerance_ns);
+    }
+    else
+    {
+        if (state == PeerState::Lost)
+        {
+            next = PeerState::Up;
+        }
+        next_deadline = std::min(loss_deadline, late_deadline);
+    }
+
+    if ((next != state) && (state != PeerState::Unknown))
+    {
+        transition(index, state, next);
+    }
+
+    m_wheel.schedule(index, toTickCeil(next_deadline));
+}
+
+/**
+ * @brief Wheel tick reached at a time
+ */
+uint64_t
+PeerMonitor::toTick(uint64_t now_ns) const
+{
+    return (now_ns > m_base_ns) ? ((now_ns - m_base_ns) / (PEER_MONITOR_TICK_US * NSEC_PER_USEC)) : 0U;
+}
+
+/**
+ * @brief First wheel tick at or after a deadline, so no entry expires early
+ */
+uint64_t
+PeerMonitor::toTickCeil(uint64_t deadline_ns) const
+{
+    uint64_t tick_ns = PEER_MONITOR_TICK_US * NSEC_PER_USEC;
+
+    return (deadline_ns > m_base_ns) ? ((deadline_ns - m_base_ns + tick_ns - 1U) / tick_ns) : 0U;
+}
+
+/**
+ * @brief Simulate peers sending lifesigns every 100 ms, 1 % going silent
+ *
+ * Simulated time advances in 1 ms steps; update() and poll() are timed
+ * with the real clock. For comparison the same checks are done the old
+ * way: one clock read and timeout test per peer at every poll.
+ */
+bool
+PeerMonitor::benchmark(std::ostream& out)
+{
+    bool result = true;
+
+    out << std::format("Peer monitor benchmark ({} ms lifesign, {} ms timeout, poll every {} ms, {} s simulated,"
+                       " 1% silent)\n",
+                       BENCH_INTERVAL_MS, BENCH_TIMEOUT_MS, BENCH_POLL_MS, BENCH_DURATION_MS / 1000U);
+    out << std::format("{:>7} {:>10} {:>11} {:>11} {:>9} {:>12} {:>9} {:>6}\n",
+                       "Peers", "update ns", "expiry/s", "poll us/s", "CPU %", "per-peer us/s", "CPU %", "Lost");
+
+    for (size_t peers : BENCH_PEER_COUNTS)
+    {
+        PeerMonitor monitor;
+        std::vector<std::vector<uint32_t>> phases(BENCH_INTERVAL_MS);
+        std::vector<uint16_t> lifesigns(peers, 0U);
+        std::vector<uint64_t> naive_last_change(peers, 0U);
+        uint64_t base_ns = 1000U * NSEC_PER_MSEC;
+        uint64_t update_ns = 0U;
+        uint64_t poll_ns = 0U;
+        uint64_t naive_ns = 0U;
+        uint64_t updates = 0U;
+        uint64_t expiries = 0U;
+        size_t naive_lost = 0U;
+        size_t wrong = 0U;
+
+        monitor.initialize(peers, base_ns);
+        monitor.setCommTimeout(BENCH_TIMEOUT_MS);
+        monitor.setExpectedInterval(BENCH_INTERVAL_MS, BENCH_TOLERANCE_US);
+
+        for (uint32_t peer = 0U; peer < peers; peer++)
+        {
+            phases[(peer * 7919U) % BENCH_INTERVAL_MS].push_back(peer);
+        }
+
+        for (uint32_t ms = 0U; ms < BENCH_DURATION_MS; ms++)
+        {
+            uint64_t now_ns = base_ns + (static_cast<uint64_t>(ms) * NSEC_PER_MSEC);
+            uint64_t start = steadyNowNs();
+
+            for (uint32_t peer : phases[ms % BENCH_INTERVAL_MS])
+            {
+                if (((peer % 100U) == 0U) && (ms >= BENCH_SILENT_AT_MS))
+                {
+                    continue;
+                }
+                lifesigns[peer]++;
+                monitor.update(0x10000U + peer, lifesigns[peer], now_ns);
+                naive_last_change[peer] = now_ns;
+                updates++;
+            }
+            update_ns += steadyNowNs() - start;
+
+            if ((ms % BENCH_POLL_MS) == 0U)
+            {
+                start = steadyNowNs();
+                expiries += monitor.poll(now_ns);
+                poll_ns += steadyNowNs() - start;
+
+                /* Per-peer polling: a clock read and a compare for every peer */
+                start = steadyNowNs();
+                naive_lost = 0U;
+                for (size_t peer = 0U; peer < peers; peer++)
+                {
+                    uint64_t clock_ns = steadyNowNs() - start + now_ns;
+
+                    if ((clock_ns - naive_last_change[peer]) >= (BENCH_TIMEOUT_MS * NSEC_PER_MSEC))
+                    {
+                        naive_lost++;
+                    }
+                }
+                naive_ns += steadyNowNs() - start;
+            }
+        }
+
+        /* Table order is arrival order: identify each peer by its id */
+        for (uint32_t index = 0U; index < peers; index++)
+        {
+            PeerStatus status = {};
+
+            monitor.getStatus(index, base_ns + (BENCH_DURATION_MS * NSEC_PER_MSEC), status);
+            if ((status.state == PeerState::Lost) != (((status.unique_id - 0x10000U) % 100U) == 0U))
+            {
+                wrong++;
+            }
+        }
+        result = (result == true) && (wrong == 0U) && (naive_lost == (peers / 100U));
+
+        double seconds = static_cast<double>(BENCH_DURATION_MS) / 1000.0;
+
+        out << std::format("{:>7} {:>10.1f} {:>11.0f} {:>11.1f} {:>8.3f}% {:>12.1f} {:>8.3f}% {:>6}\n",
+                           peers,
+                           static_cast<double>(update_ns) / static_cast<double>(updates),
+                           static_cast<double>(expiries) / seconds,
+                           static_cast<double>(poll_ns) / 1000.0 / seconds,
+                           static_cast<double>(update_ns + poll_ns) / (seconds * 1e7),
+                           static_cast<double>(naive_ns) / 1000.0 / seconds,
+                           static_cast<double>(naive_ns) / (seconds * 1e7),
+                           monitor.getStateCount(PeerState::Lost));
+    }
+
+    out << ((result == true) ? "Every silent peer Lost, every other peer not\n" : "WRONG peer state\n");
+
+    return result;
+}
@@ -0,0 +1,437 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file Reassembler.cpp
+ * @ingroup app
+ * @class Reassembler
+ * @brief Rebuilds fragmented messages in a preallocated buffer pool
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <memory>
+
+#include "app/Reassembler.hpp"
+#include "app/AppPacketView.hpp"
+#include "stats/LatencyStats.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t   BENCH_MESSAGE_SIZES[]   = {64U * 1024U, 1024U * 1024U, 4U * 1024U * 1024U};
+static constexpr double   BENCH_LOSS_RATES[]      = {0.0, 0.001, 0.01};
+static constexpr size_t   BENCH_BYTES_PER_CASE    = 64U * 1024U * 1024U;
+static constexpr uint32_t BENCH_REORDER_PERCENT   = 10U;    /* Adjacent fragments swapped */
+static constexpr size_t   BENCH_SLOTS             = 4U;
+static constexpr uint32_t BENCH_TIMEOUT_MS        = 100U;
+static constexpr size_t   BENCH_WIRE_SIZE         = APP_PACKET_MAX_DATA_SIZE + sizeof(AppPacketHeader) +
+                                                    sizeof(AppPacketFooter);
+
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+static uint64_t
+steadyNowNs(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+Reassembler::Reassembler()
+    : m_max_message_size(0U),
+      m_bitmap_words(0U),
+      m_timeout_ns(0U),
+      m_stats{}
+{
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Allocate and prefault the slot pool
+ *
+ * @param[in] slot_count        Messages reassembled at the same time
+ * @param[in] max_message_size  Largest message accepted (<= FRAGMENT_MAX_MESSAGE_SIZE)
+ * @param[in] timeout_ms        Drop a partial message idle for this long
+ * @return true if successful
+ */
+bool
+Reassembler::initialize(size_t slot_count, size_t max_message_size, uint32_t timeout_ms)
+{
+    bool result = false;
+    size_t max_fragments = Fragmenter::fragmentCount(max_message_size);
+
+    if ((slot_count == 0U) || (max_fragments == 0U))
+    {
+        goto Reassembler_initialize_exit;
+    }
+
+    m_max_message_size = max_message_size;
+    m_bitmap_words     = (max_fragments + 63U) / 64U;
+    m_timeout_ns       = static_cast<uint64_t>(timeout_ms) * 1000000U;
+    m_stats            = {};
+
+    /* assign() writes every byte, so the pool is resident before the first fragment */
+    m_pool.assign(slot_count * max_message_size, 0U);
+    m_bitmaps.assign(slot_count * m_bitmap_words, 0U);
+    m_slots.assign(slot_count, Slot{});
+
+    for (size_t idx = 0U; idx < slot_count; idx++)
+    {
+        m_slots[idx].data   = &m_pool[idx * max_message_size];
+        m_slots[idx].bitmap = &m_bitmaps[idx * m_bitmap_words];
+    }
+
+    result = true;
+
+Reassembler_initialize_exit:
+    return result;
+}
+
+/**
+ * @brief Store one fragment; report the message when it is complete
+ */
+Reassembler::Result
+Reassembler::addFragment(uint32_t source_id, std::span<const uint8_t> payload, uint64_t now_ns,
+                         ReassembledMessage& message)
+{
+    Result result = Result::Rejected;
+    FragmentHeader header = {};
+    size_t slice = 0U;
+    Slot* slot = nullptr;
+
+    releaseDelivered();
+
+    if ((m_slots.empty() == true) || (payload.size() < sizeof(FragmentHeader)))
+    {
+        m_stats.rejected++;
+        goto Reassembler_addFragment_exit;
+    }
+
+    std::memcpy(&header, payload.data(), sizeof(header));
+    slice = payload.size() - sizeof(header);
+
+    /* The slice must sit exactly where the fragmenter would have put it */
+    if ((header.message_length == 0U) || (header.message_length > m_max_message_size) ||
+        (header.count != Fragmenter::fragmentCount(header.message_length)) || (header.index >= header.count) ||
+        (header.offset != (static_cast<size_t>(header.index) * FRAGMENT_MAX_DATA_SIZE)) ||
+        (slice != std::min(FRAGMENT_MAX_DATA_SIZE, static_cast<size_t>(header.message_length - header.offset))))
+    {
+        m_stats.rejected++;
+        goto Reassembler_addFragment_exit;
+    }
+
+    slot = findSlot(source_id, header.message_id);
+    if (slot == nullptr)
+    {
+        slot = allocateSlot();
+        slot->used       = true;
+        slot->source_id  = source_id;
+        slot->message_id = header.message_id;
+        slot->length     = header.message_length;
+        slot->count      = header.count;
+        slot->received   = 0U;
+        slot->first_ns   = now_ns;
+        std::memset(slot->bitmap, 0, ((header.count + 63U) / 64U) * sizeof(uint64_t));
+    }
+    else if ((slot->length != header.message_length) || (slot->count != header.count))
+    {
+        m_stats.rejected++;
+        goto Reassembler_addFragment_exit;
+    }
+
+    if ((slot->bitmap[header.index / 64U] & (1ULL << (header.index % 64U))) != 0U)
+    {
+        m_stats.duplicates++;
+        result = Result::Duplicate;
+        goto Reassembler_addFragment_exit;
+    }
+
+    /* Out of order is fine: each slice goes straight to its offset */
+    slot->bitmap[header.index / 64U] |= (1ULL << (header.index % 64U));
+    std::memcpy(&slot->data[header.offset], payload.data() + sizeof(header), slice);
+    slot->received++;
+    slot->last_ns = now_ns;
+    m_stats.fragments++;
+    result = Result::Pending;
+
+    if (slot->received == slot->count)
+    {
+        message.source_id  = slot->source_id;
+        message.message_id = slot->message_id;
+        message.data       = slot->data;
+        message.length     = slot->length;
+        message.latency_ns = now_ns - slot->first_ns;
+
+        slot->delivered = true;
+        m_stats.completed++;
+        result = Result::Complete;
+    }
+
+Reassembler_addFragment_exit:
+    return result;
+}
+
+/**
+ * @brief Drop partial messages that saw no fragment for the timeout
+ *
+ * Call periodically (e.g. from the comm monitor timer of the same thread).
+ *
+ * @param[in] now_ns  Monotonic time (steady_clock ns)
+ * @return Number of messages dropped
+ */
+size_t
+Reassembler::expire(uint64_t now_ns)
+{
+    size_t expired = 0U;
+
+    releaseDelivered();
+
+    for (Slot& slot : m_slots)
+    {
+        if ((slot.used == true) && ((now_ns - slot.last_ns) >= m_timeout_ns))
+        {
+            slot.used = false;
+            expired++;
+        }
+    }
+    m_stats.timedOut += expired;
+
+    return expired;
+}
+
+/**
+ * @brief Number of partial messages held
+ */
+size_t
+Reassembler::getPendingCount(void) const
+{
+    size_t pending = 0U;
+
+    for (const Slot& slot : m_slots)
+    {
+        if ((slot.used == true) && (slot.delivered == false))
+        {
+            pending++;
+        }
+    }
+
+    return pending;
+}
+
+/**
+ * @brief Get the reassembly counters
+ */
+ReassemblerStats
+Reassembler::getStats(void) const
+{
+    return m_stats;
+}
+
+/**
+ * @brief Find the partial message of (sender, message id)
+ */
+Reassembler::Slot*
+Reassembler::findSlot(uint32_t source_id, uint32_t message_id)
+{
+    Slot* found = nullptr;
+
+    for (Slot& slot : m_slots)
+    {
+        if ((slot.used == true) && (slot.source_id == source_id) && (slot.message_id == message_id))
+        {
+            found = &slot;
+            break;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief A free slot, or the least recently active one (evicted)
+ */
+Reassembler::Slot*
+Reassembler::allocateSlot(void)
+{
+    Slot* victim = &m_slots[0];
+
+    for (Slot& slot : m_slots)
+    {
+        if (slot.used == false)
+        {
+            victim = &slot;
+            break;
+        }
+
+        if (slot.last_ns < victim->last_ns)
+        {
+            victim = &slot;
+        }
+    }
+
+    if (victim->used == true)
+    {
+        m_stats.evicted++;
+    }
+
+    return victim;
+}
+
+/**
+ * @brief Free the slot of a message handed out by the previous call
+ */
+void
+Reassembler::releaseDelivered(void)
+{
+    for (Slot& slot : m_slots)
+    {
+        if (slot.delivered == true)
+        {
+            slot.delivered = false;
+            slot.used = false;
+        }
+    }
+}
+
+/**
+ * @brief In-memory fragmentation and reassembly benchmark
+ *
+ * Per message size and loss rate: fragments are encoded, flattened into
+ * wire buffers (the copy sendmsg would make), dropped at random, swapped
+ * with a neighbour 10% of the time, then validated with AppPacketView and
+ * reassembled. Throughput counts delivered message bytes over the whole
+ * loop; latency is first fragment to completion of each message.
+ */
+bool
+Reassembler::benchmark(std::ostream& out)
+{
+    bool result = true;
+    size_t max_size = BENCH_MESSAGE_SIZES[std::size(BENCH_MESSAGE_SIZES) - 1U];
+    size_t max_fragments = Fragmenter::fragmentCount(max_size);
+    std::vector<uint8_t> message(max_size);
+    std::vector<uint8_t> wire(max_fragments * BENCH_WIRE_SIZE);
+    std::vector<size_t> wire_length(max_fragments);
+    std::vector<size_t> order(max_fragments);
+    auto latency = std::make_unique<LatencyStats<4096U>>();
+    uint32_t seed = 0x12345678U;
+    auto random = [&seed]() -> uint32_t
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        return seed >> 8U;
+    };
+
+    for (uint8_t& byte : message)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+
+    out << std::format("Fragmentation benchmark ({} B slices, {}% adjacent reorder, {} slots)\n",
+                       FRAGMENT_MAX_DATA_SIZE, BENCH_REORDER_PERCENT, BENCH_SLOTS);
+    out << std::format("{:>9} {:>6} {:>11} {:>9} {:>10} {:>10} {:>8}\n",
+                       "Message", "Loss", "Delivered", "MB/s", "p50 us", "p99 us", "Evicted");
+
+    for (size_t size : BENCH_MESSAGE_SIZES)
+    {
+        for (double loss : BENCH_LOSS_RATES)
+        {
+            Reassembler reassembler;
+            Fragmenter fragmenter;
+            AppPacket packet;
+            size_t messages = BENCH_BYTES_PER_CASE / size;
+            size_t delivered = 0U;
+            uint32_t loss_threshold = static_cast<uint32_t>(loss * static_cast<double>(1U << 24U));
+
+            reassembler.initialize(BENCH_SLOTS, size, BENCH_TIMEOUT_MS);
+            packet.setUniqueId(0xBE7C4U);
+            latency->reset();
+
+            auto start = std::chrono::steady_clock::now();
+
+            for (size_t msg = 0U; msg < messages; msg++)
+            {
+                size_t count = 0U;
+                AppPacketGather gather;
+                ReassembledMessage done = {};
+
+                /* Tag each message so a stale or mixed delivery is caught */
+                std::memcpy(message.data(), &msg, sizeof(msg));
+                fragmenter.begin(message.data(), size);
+
+                for (; fragmenter.next(packet, gather) == true; count++)
+                {
+                    uint8_t* frame = &wire[count * BENCH_WIRE_SIZE];
+                    size_t offset = 0U;
+
+                    for (size_t piece = 0U; piece < gather.iovcnt; piece++)
+                    {
+                        std::memcpy(&frame[offset], gather.iov[piece].iov_base, gather.iov[piece].iov_len);
+                        offset += gather.iov[piece].iov_len;
+                    }
+                    wire_length[count] = offset;
+                    order[count] = count;
+                }
+
+                for (size_t idx = 0U; (idx + 1U) < count; idx++)
+                {
+                    if ((random() % 100U) < BENCH_REORDER_PERCENT)
+                    {
+                        std::swap(order[idx], order[idx + 1U]);
+                    }
+                }
+
+                for (size_t idx = 0U; idx < count; idx++)
+                {
+                    if ((random() & 0xFFFFFFU) < loss_threshold)
+                    {
+                        continue;
+                    }
+
+                    AppPacketView view(&wire[order[idx] * BENCH_WIRE_SIZE], wire_length[order[idx]]);
+
+                    if ((view.isValid() == true) && ((view.getFlags() & APP_PACKET_FLAG_FRAGMENT) != 0U) &&
+                        (reassembler.addFragment(view.getUniqueId(), view.getPayload(), steadyNowNs(), done) ==
+                         Result::Complete))
+                    {
+                        delivered++;
+                        latency->recordSample(done.latency_ns);
+                        result = (result == true) && (done.length == size) &&
+                                 (std::memcmp(done.data, message.data(), size) == 0);
+                    }
+                }
+            }
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            auto stats = latency->computeStats();
+
+            out << std::format("{:>7} K {:>5.1f}% {:>5}/{:<5} {:>9.0f} {:>10.1f} {:>10.1f} {:>8}\n",
+                               size / 1024U, loss * 100.0, delivered, messages,
+                               static_cast<double>(delivered * size) / elapsed.count() / 1e6,
+                               stats.p50_us, stats.p99_us, reassembler.getStats().evicted);
+        }
+    }
+
+    out << ((result == true) ? "All delivered messages verified\n" : "MISMATCH in a delivered message\n");
+
+    return result;
+}
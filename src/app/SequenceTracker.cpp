@@ -0,0 +1,336 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file SequenceTracker.cpp
+ * @ingroup app
+ * @class SequenceTracker
+ * @brief Per-sender loss, duplicate and reordering analytics from the lifesign
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <bit>
+
+#include "app/SequenceTracker.hpp"
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+SequenceTracker::SequenceTracker()
+    : m_streams{},
+      m_stream_count(0U),
+      m_last_gap(0U)
+{
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Classify a received lifesign and update the sender's counters
+ *
+ * @param[in] source_id  Sender, e.g. AppPacketView::getUniqueId()
+ * @param[in] lifesign   Sequence number, e.g. AppPacketView::getLifesign()
+ * @return What the lifesign was relative to the ones before it
+ */
+SequenceTracker::Event
+SequenceTracker::update(uint32_t source_id, uint16_t lifesign)
+{
+    Event event = Event::InOrder;
+    Stream* stream = findStream(source_id);
+    size_t count = m_stream_count.load(std::memory_order_relaxed);
+    int16_t delta = 0;
+    uint16_t distance = 0U;
+
+    if (stream == nullptr)
+    {
+        if (count >= SEQUENCE_MAX_STREAMS)
+        {
+            event = Event::Untracked;
+            goto SequenceTracker_update_exit;
+        }
+
+        /* Readers only need the id once the stream is published */
+        stream = &m_streams[count];
+        stream->source_id = source_id;
+        m_stream_count.store(count + 1U, std::memory_order_release);
+        event = Event::First;
+    }
+    else
+    {
+        delta = static_cast<int16_t>(static_cast<uint16_t>(lifesign - stream->highest));
+    }
+
+    stream->sequence.write([&]()
+    {
+        if (event == Event::First)
+        {
+            restart(*stream, lifesign);
+            SeqLock::add(stream->received);
+        }
+        else if ((delta > static_cast<int16_t>(SEQUENCE_RESYNC_DISTANCE)) ||
+                 (delta < -static_cast<int16_t>(SEQUENCE_RESYNC_DISTANCE)))
+        {
+            /* Continue the extended count so expected/received stay cumulative */
+            restart(*stream, lifesign);
+            SeqLock::add(stream->received);
+            SeqLock::add(stream->resyncs);
+            event = Event::Resync;
+        }
+        else if (delta > 0)
+        {
+            distance = static_cast<uint16_t>(delta);
+            slideWindow(*stream, distance);
+            stream->window[0] |= 1U;
+            stream->highest = lifesign;
+            stream->highest_extended += distance;
+            SeqLock::add(stream->received);
+
+            if (distance > 1U)
+            {
+                m_last_gap = static_cast<uint16_t>(distance - 1U);
+                event = Event::Gap;
+            }
+        }
+        else if (delta == 0)
+        {
+            SeqLock::add(stream->duplicates);
+            event = Event::Duplicate;
+        }
+        else
+        {
+            distance = static_cast<uint16_t>(-delta);
+
+            if (distance >= SEQUENCE_WINDOW_SIZE)
+            {
+                SeqLock::add(stream->late);
+                event = Event::Late;
+            }
+            else if ((stream->window[distance / 64U] & (1ULL << (distance % 64U))) != 0U)
+            {
+                SeqLock::add(stream->duplicates);
+                event = Event::Duplicate;
+            }
+            else if (distance > (stream->highest_extended - stream->first_extended))
+            {
+                /* Before the stream started: nothing was expected there */
+                SeqLock::add(stream->late);
+                event = Event::Late;
+            }
+            else
+            {
+                stream->window[distance / 64U] |= (1ULL << (distance % 64U));
+                SeqLock::add(stream->received);
+                SeqLock::add(stream->reordered);
+                SeqLock::add(stream->reorder_histogram[reorderBucket(distance)]);
+                if (distance > stream->max_reorder.load(std::memory_order_relaxed))
+                {
+                    stream->max_reorder.store(distance, std::memory_order_relaxed);
+                }
+                event = Event::Reordered;
+            }
+        }
+
+        /* The extended count starts at 0 and steps by one over a resync */
+        uint32_t span = static_cast<uint32_t>(std::min<uint64_t>(SEQUENCE_WINDOW_SIZE,
+                                              stream->highest_extended - stream->first_extended + 1U));
+
+        stream->expected.store(stream->highest_extended + 1U, std::memory_order_relaxed);
+        stream->pub_highest.store(stream->highest, std::memory_order_relaxed);
+        stream->window_span.store(span, std::memory_order_relaxed);
+        stream->window_missing.store(countMissing(*stream, span), std::memory_order_relaxed);
+    });
+
+SequenceTracker_update_exit:
+    return event;
+}
+
+/**
+ * @brief Get how many lifesigns the last Gap event skipped (writer thread)
+ */
+uint16_t
+SequenceTracker::getLastGap(void) const
+{
+    return m_last_gap;
+}
+
+/**
+ * @brief Get the number of senders tracked so far
+ */
+size_t
+SequenceTracker::getStreamCount(void) const
+{
+    return m_stream_count.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Copy one sender's counters
+ *
+ * @param[in]  stream  Index below getStreamCount()
+ * @param[out] stats   Consistent snapshot
+ * @return false if the index is not a tracked stream
+ */
+bool
+SequenceTracker::getStats(size_t stream, SequenceStats& stats) const
+{
+    bool result = false;
+    const Stream* entry = nullptr;
+
+    if (stream >= getStreamCount())
+    {
+        goto SequenceTracker_getStats_exit;
+    }
+
+    entry = &m_streams[stream];
+    entry->sequence.read([&]()
+    {
+        stats.highest        = entry->pub_highest.load(std::memory_order_relaxed);
+        stats.expected       = entry->expected.load(std::memory_order_relaxed);
+        stats.received       = entry->received.load(std::memory_order_relaxed);
+        stats.duplicates     = entry->duplicates.load(std::memory_order_relaxed);
+        stats.reordered      = entry->reordered.load(std::memory_order_relaxed);
+        stats.late           = entry->late.load(std::memory_order_relaxed);
+        stats.resyncs        = entry->resyncs.load(std::memory_order_relaxed);
+        stats.window_span    = entry->window_span.load(std::memory_order_relaxed);
+        stats.window_missing = entry->window_missing.load(std::memory_order_relaxed);
+        stats.max_reorder    = entry->max_reorder.load(std::memory_order_relaxed);
+        for (size_t i = 0U; i < SEQUENCE_REORDER_BUCKETS; i++)
+        {
+            stats.reorder_histogram[i] = entry->reorder_histogram[i].load(std::memory_order_relaxed);
+        }
+    });
+
+    stats.source_id = entry->source_id;
+    stats.lost = (stats.expected > stats.received) ? (stats.expected - stats.received) : 0U;
+    result = true;
+
+SequenceTracker_getStats_exit:
+    return result;
+}
+
+/**
+ * @brief Histogram bucket of a reorder distance: 1, 2, 3-4, 5-8, ..., 65+
+ */
+size_t
+SequenceTracker::reorderBucket(uint16_t distance)
+{
+    size_t bucket = 0U;
+
+    if (distance > 1U)
+    {
+        bucket = std::min<size_t>(SEQUENCE_REORDER_BUCKETS - 1U,
+                                  static_cast<size_t>(std::bit_width(static_cast<uint16_t>(distance - 1U))));
+    }
+
+    return bucket;
+}
+
+/**
+ * @brief Label of a histogram bucket
+ */
+const char*
+SequenceTracker::reorderBucketName(size_t bucket)
+{
+    static constexpr const char* NAMES[SEQUENCE_REORDER_BUCKETS] =
+    {
+        "1", "2", "3-4", "5-8", "9-16", "17-32", "33-64", "65+"
+    };
+
+    return (bucket < SEQUENCE_REORDER_BUCKETS) ? NAMES[bucket] : "?";
+}
+
+/**
+ * @brief Find the stream of a sender (writer thread)
+ */
+SequenceTracker::Stream*
+SequenceTracker::findStream(uint32_t source_id)
+{
+    Stream* stream = nullptr;
+    size_t count = m_stream_count.load(std::memory_order_relaxed);
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        if (m_streams[i].source_id == source_id)
+        {
+            stream = &m_streams[i];
+            break;
+        }
+    }
+
+    return stream;
+}
+
+/**
+ * @brief Start the window over at a lifesign (first packet or resync)
+ *
+ * The extended count continues from the previous highest, so the jump
+ * itself is neither loss nor reordering.
+ */
+void
+SequenceTracker::restart(Stream& stream, uint16_t lifesign)
+{
+    stream.highest_extended = (stream.received.load(std::memory_order_relaxed) == 0U) ?
+                              0U : (stream.highest_extended + 1U);
+    stream.first_extended = stream.highest_extended;
+    stream.highest = lifesign;
+    std::fill(std::begin(stream.window), std::end(stream.window), 0U);
+    stream.window[0] = 1U;
+}
+
+/**
+ * @brief Move the window up by distance lifesigns; skipped ones stay clear
+ */
+void
+SequenceTracker::slideWindow(Stream& stream, uint16_t distance)
+{
+    size_t words = distance / 64U;
+    size_t bits = distance % 64U;
+
+    if (distance >= SEQUENCE_WINDOW_SIZE)
+    {
+        std::fill(std::begin(stream.window), std::end(stream.window), 0U);
+    }
+    else
+    {
+        for (size_t i = WINDOW_WORDS; i-- > 0U;)
+        {
+            uint64_t word = (i >= words) ? stream.window[i - words] : 0U;
+            uint64_t carry = ((i > words) && (bits > 0U)) ? (stream.window[i - words - 1U] >> (64U - bits)) : 0U;
+
+            stream.window[i] = (word << bits) | carry;
+        }
+    }
+}
+
+/**
+ * @brief Count the clear bits among the newest span lifesigns
+ */
+uint32_t
+SequenceTracker::countMissing(const Stream& stream, uint32_t span) const
+{
+    uint32_t received = 0U;
+
+    for (size_t i = 0U; (i * 64U) < span; i++)
+    {
+        uint64_t word = stream.window[i];
+
+        if ((span - (i * 64U)) < 64U)
+        {
+            word &= (1ULL << (span - (i * 64U))) - 1U;
+        }
+        received += static_cast<uint32_t>(std::popcount(word));
+    }
+
+    return span - received;
+}
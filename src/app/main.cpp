@@ -16,14 +16,30 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <format>
 #include <iostream>
 #include <cstring>
+#include <mutex>
+#include <vector>
 #include <sys/epoll.h>
 
 #include "app/ArgParser.hpp"
 #include "app/AppPacket.hpp"
+#include "app/AppPacketView.hpp"
+#include "app/AppMessages.hpp"
+#include "app/PeerMonitor.hpp"
+#include "app/SequenceTracker.hpp"
+#include "app/Fragmenter.hpp"
+#include "app/Reassembler.hpp"
+#include "app/FecEncoder.hpp"
+#include "app/FecDecoder.hpp"
+#include "app/Gf256.hpp"
+#include "app/Crc32.hpp"
 #include "app/SignalHandler.hpp"
+#include "app/ControlServer.hpp"
 #include "event/EventLoop.hpp"
 #include "socket/UdpNode.hpp"
 #include "timer/timer.hpp"
@@ -39,8 +55,13 @@
  * Constant
  ******************************************************************************/
 static constexpr uint32_t TX_INTERVAL_MS         = 100U;   /**< TX timer interval (ms) */
-static constexpr uint32_t COMM_MONITOR_MS        = 200U;   /**< Comm monitor interval (ms) */
+static constexpr uint32_t COMM_MONITOR_MS        = 10U;    /**< Peer deadline check interval (ms) */
 static constexpr uint32_t COMM_TIMEOUT_MS        = 1000U;  /**< Comm loss threshold (ms) */
+static constexpr size_t   MAX_PEERS              = 1024U;  /**< Peers the RX monitor tracks */
+static constexpr size_t   FEC_MAX_SOURCES        = 4U;     /**< Senders the FEC decoder keeps history for */
+static constexpr size_t   REASSEMBLY_SLOTS       = 4U;     /**< Messages reassembled at once (ARG_MESSAGE_MAX_SIZE each) */
+static constexpr uint32_t REASSEMBLY_TIMEOUT_MS  = 1000U;  /**< Partial message dropped after this idle time */
+static constexpr uint32_t MESSAGE_INTERVAL_MS    = 1000U;  /**< --message send interval (ms) */
 static constexpr size_t   UDP_RX_BUFFER_SIZE     = 512U;   /**< UDP receive buffer size */
 static constexpr uint32_t STATS_REPORT_INTERVAL_MS = 250U;   /**< Latency stats report interval (ms) */
 
@@ -49,10 +70,59 @@ static constexpr int      RX_CPU_CORE            = 2;       /**< CPU core for RX
 static constexpr int      TX_CPU_CORE            = 3;       /**< CPU core for TX thread */
 static constexpr int      RX_RT_PRIORITY         = 80;      /**< RX real-time priority (1-99) */
 static constexpr int      TX_RT_PRIORITY         = 70;      /**< TX real-time priority (1-99) */
+static constexpr int      RX_WORKER_CPU_CORE     = 4;       /**< CPU core for the RX worker thread */
+static constexpr int      RX_WORKER_RT_PRIORITY  = 60;      /**< RX worker real-time priority (1-99) */
+static constexpr size_t   RX_WORKER_BATCH_SIZE   = 32U;     /**< Max packets per worker batch */
+static constexpr uint32_t QUEUE_BLOCK_TIMEOUT_US = 1000U;   /**< Max wait for a full Block-policy queue */
+static constexpr uint32_t TX_CONTROL_LANE_WEIGHT = 4U;      /**< Control packets per turn (Weighted mode) */
+static constexpr uint32_t TX_BULK_LANE_WEIGHT    = 1U;      /**< Bulk packets per turn (Weighted mode) */
+static constexpr size_t   TX_BATCH_SIZE          = 16U;     /**< Max packets per TX thread wake-up */
+static constexpr uint64_t TX_RATE_PPS            = 10000U;  /**< Shaper packet rate cap */
+static constexpr uint64_t TX_RATE_BYTES_PER_SEC  = 12500000U;  /**< Shaper byte rate cap (100 Mbit/s) */
+static constexpr uint32_t TX_BURST_PACKETS       = 32U;     /**< Shaper burst (packets) */
+static constexpr uint32_t TX_BURST_BYTES         = 65536U;  /**< Shaper burst (bytes) */
+static constexpr size_t   RT_THREAD_STACK_SIZE   = 256U * 1024U;       /**< Prefaulted stack per RT thread */
+static constexpr size_t   HEAP_RESERVE_SIZE      = 8U * 1024U * 1024U; /**< Heap prefaulted at start */
+static constexpr uint32_t FAULT_WARMUP_MS        = 2000U;  /**< Page faults after this are reported */
+static constexpr int32_t  CPU_DMA_LATENCY_US     = 0;       /**< Keep RT cores out of deep C-states */
+static constexpr uint64_t TX_DL_RUNTIME_US       = 100U;    /**< TX SCHED_DEADLINE budget per period */
+static constexpr uint64_t TX_DL_DEADLINE_US      = 500U;    /**< TX job completes within this */
+static constexpr uint64_t TX_DL_PERIOD_US        = 1000U;   /**< TX job period (max wait of a queued packet) */
+static constexpr size_t   COALESCE_MTU           = 1472U;   /**< Coalesced datagram limit: 1500 MTU - IPv4 20 - UDP 8 */
+static constexpr size_t   COALESCE_MAX_PACKETS   = 16U;     /**< Packets per coalesced datagram */
+static constexpr uint32_t COALESCE_DEADLINE_US   = 200U;    /**< Longest a packet waits for its datagram */
 static constexpr size_t   SO_RCVBUF_SIZE         = 2097152; /**< 2MB RX socket buffer */
 static constexpr size_t   SO_SNDBUF_SIZE         = 1048576; /**< 1MB TX socket buffer */
 
 
+/*******************************************************************************
+ * Enum / Structure
+ ******************************************************************************/
+
+/**
+ * @brief Fragment reassembly shared by the RX worker and the comm monitor timer
+ *
+ * The worker adds fragments, the event loop expires stale messages; the
+ * lock is held for one addFragment() or one expire() pass over the slots.
+ */
+struct RxReassembly
+{
+    std::mutex lock;
+    Reassembler reassembler;
+};
+
+/**
+ * @brief decodeBatch() counters (RX worker writes, stats timer reads)
+ */
+struct RxBatchStats
+{
+    std::atomic<uint64_t> batches;
+    std::atomic<uint64_t> frames;
+    std::atomic<uint64_t> interleaved;  /**< Frames whose CRC ran in an interleaved group */
+    std::atomic<size_t> largest;        /**< Most frames in one batch */
+};
+
+
 /*******************************************************************************
  * Global Object
  ******************************************************************************/
@@ -60,10 +130,24 @@ static constexpr size_t   SO_SNDBUF_SIZE         = 1048576; /**< 1MB TX socket b
 /*******************************************************************************
  * Function Prototype
  ******************************************************************************/
-static void rxPacketHandler(const uint8_t* data, size_t length, AppPacket& rx_packet, TerminalUI& ui);
-static void commMonitorCallback(AppPacket& rx_packet, EventLoop& loop, TerminalUI& ui);
-static void txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, TerminalUI& ui);
-static void statsReportCallback(UdpThreadManager& threadMgr, TerminalUI& ui);
+static void rxBatchHandler(const struct iovec* frames, size_t count, PeerMonitor& rx_monitor,
+                           SequenceTracker& rx_sequence, FecDecoder& rx_fec, RxReassembly& rx_reassembly,
+                           RxBatchStats& rx_batch_stats, TerminalUI& ui, std::atomic<bool>& peer_crc32c);
+static void rxFragmentHandler(const AppPacketView& packet, RxReassembly& rx_reassembly, TerminalUI& ui);
+static void rxPacketHandler(const AppPacketView& packet, PeerMonitor& rx_monitor,
+                            SequenceTracker& rx_sequence, FecDecoder& rx_fec, TerminalUI& ui,
+                            std::atomic<bool>& peer_crc32c);
+static void commMonitorCallback(PeerMonitor& rx_monitor, RxReassembly& rx_reassembly, TerminalUI& ui);
+static void peerStateCallback(const PeerMonitor& rx_monitor, uint32_t unique_id, PeerState from, PeerState to,
+                              TerminalUI& ui);
+static void txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, FecEncoder& tx_fec,
+                            AppPacket& tx_parity_packet, TerminalUI& ui);
+static void txMessageCallback(UdpThreadManager& threadMgr, AppPacket& tx_message_packet, Fragmenter& tx_fragmenter,
+                              const std::vector<uint8_t>& tx_message, TerminalUI& ui);
+static void statsReportCallback(UdpThreadManager& threadMgr, const SequenceTracker& rx_sequence,
+                                const FecEncoder& tx_fec, const FecDecoder& rx_fec,
+                                const RxBatchStats& rx_batch_stats, TerminalUI& ui);
+static uint64_t steadyNowNs(void);
 
 
 /*******************************************************************************
@@ -87,27 +171,81 @@ main(int argc, char* argv[])
     if (parseUdpPeerArgs(argc, argv, peer_args) == false)
     {
         std::cerr << std::format(
-            "Usage: {} --src <addr>:<port> --dst <addr>:<port>\n",
-            argv[0])
+            "Usage: {} --src <addr>:<port> --dst <addr>:<port> [--control <socket path>] [--crc32c] [--coalesce]\n"
+            "          [--fec <k>[:<m>]] [--message <bytes>]\n"
+            "       {} --crc-bench | --frag-bench | --peer-bench | --fec-bench | --schema-bench\n",
+            argv[0], argv[0])
             << std::endl;
         main_ret = EXIT_FAILURE;
         goto main_exit;
     }
 
+    if (peer_args.crc_bench == true)
+    {
+        main_ret = ((Crc32::benchmark(std::cout) == true) && (AppPacket::benchmark(std::cout) == true)) ?
+                   EXIT_SUCCESS : EXIT_FAILURE;
+        goto main_exit;
+    }
+
+    if (peer_args.frag_bench == true)
+    {
+        main_ret = (Reassembler::benchmark(std::cout) == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+        goto main_exit;
+    }
+
+    if (peer_args.peer_bench == true)
+    {
+        main_ret = (PeerMonitor::benchmark(std::cout) == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+        goto main_exit;
+    }
+
+    if (peer_args.fec_bench == true)
+    {
+        main_ret = (FecDecoder::benchmark(std::cout) == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+        goto main_exit;
+    }
+
+    if (peer_args.schema_bench == true)
+    {
+        main_ret = (AppMessages::benchmark(std::cout) == true) ? EXIT_SUCCESS : EXIT_FAILURE;
+        goto main_exit;
+    }
+
     std::cout << std::format(
         "=== High-Performance UDP Configuration ===\n"
         "Source:      0x{:08X}:{}\n"
         "Destination: 0x{:08X}:{}\n"
         "RX Thread:   CPU core {}, priority {} (SCHED_FIFO)\n"
-        "TX Thread:   CPU core {}, priority {} (SCHED_FIFO)\n"
+        "TX Thread:   SCHED_DEADLINE {}/{}/{} us (fallback: CPU core {}, priority {})\n"
         "SO_RCVBUF:   {} bytes\n"
         "SO_SNDBUF:   {} bytes\n"
+        "CRC:         {} ({}){}\n"
+        "FEC:         {}\n"
+        "Message:     {}\n"
         "==========================================\n",
         peer_args.src_addr, peer_args.src_port,
         peer_args.dst_addr, peer_args.dst_port,
         RX_CPU_CORE, RX_RT_PRIORITY,
+        TX_DL_RUNTIME_US, TX_DL_DEADLINE_US, TX_DL_PERIOD_US,
         TX_CPU_CORE, TX_RT_PRIORITY,
-        SO_RCVBUF_SIZE, SO_SNDBUF_SIZE)
+        SO_RCVBUF_SIZE, SO_SNDBUF_SIZE,
+        Crc32::algorithmName(CrcAlgorithm::Ieee), Crc32::implName(Crc32::getSelected(CrcAlgorithm::Ieee)),
+        (peer_args.crc32c == true) ?
+            std::format(", {} ({}) once the peer supports it",
+                        Crc32::algorithmName(CrcAlgorithm::Castagnoli),
+                        Crc32::implName(Crc32::getSelected(CrcAlgorithm::Castagnoli))) :
+            std::string(),
+        (peer_args.fec_data > 0U) ?
+            std::format("{} parity per {} packets ({}, GF(2^8) {})",
+                        peer_args.fec_parity, peer_args.fec_data,
+                        (peer_args.fec_parity == 1U) ? "XOR" : "Reed-Solomon",
+                        Gf256::implName(Gf256::getSelected())) :
+            std::string("off"),
+        (peer_args.message_size > 0U) ?
+            std::format("{} bytes every {} ms ({} fragments, Bulk lane)",
+                        peer_args.message_size, MESSAGE_INTERVAL_MS,
+                        Fragmenter::fragmentCount(peer_args.message_size)) :
+            std::string("off (fragments received are reassembled)"))
         << std::endl;
 
     {
@@ -132,10 +270,47 @@ main(int argc, char* argv[])
         AppPacket tx_packet;
         tx_packet.setUniqueId(0x12345678U);
 
-        /* Initialize RX packet */
-        AppPacket rx_packet;
-        rx_packet.setCommTimeout(COMM_TIMEOUT_MS);
-        rx_packet.setExpectedInterval(TX_INTERVAL_MS, APP_PACKET_INTERVAL_TOLERANCE_US);
+        /* FEC parity: own encoder, so the data lifesigns stay consecutive */
+        AppPacket tx_parity_packet;
+        tx_parity_packet.setUniqueId(0x12345678U);
+
+        /* Optional large test message: own encoder, so fragments do not use up lifesigns */
+        AppPacket tx_message_packet;
+        Fragmenter tx_fragmenter;
+        std::vector<uint8_t> tx_message(peer_args.message_size);
+        tx_message_packet.setUniqueId(0x12345678U);
+        for (size_t idx = 0U; idx < tx_message.size(); idx++)
+        {
+            tx_message[idx] = static_cast<uint8_t>(idx);
+        }
+
+        /* Initialize RX peer monitor (packets are decoded statelessly); reports state changes only */
+        PeerMonitor rx_monitor;
+        rx_monitor.setCommTimeout(COMM_TIMEOUT_MS);
+        rx_monitor.setExpectedInterval(TX_INTERVAL_MS, APP_PACKET_INTERVAL_TOLERANCE_US);
+        rx_monitor.setStateCallback([&rx_monitor, &ui](uint32_t unique_id, PeerState from, PeerState to) {
+            peerStateCallback(rx_monitor, unique_id, from, to, ui);
+        });
+        rx_monitor.initialize(MAX_PEERS, steadyNowNs());
+
+        /* Loss, duplicate and reordering analytics per sender (RX worker writes, stats timer reads) */
+        SequenceTracker rx_sequence;
+
+        /* Fragment reassembly (RX worker adds, comm monitor timer expires); all memory allocated here */
+        RxReassembly rx_reassembly;
+        rx_reassembly.reassembler.initialize(REASSEMBLY_SLOTS, ARG_MESSAGE_MAX_SIZE, REASSEMBLY_TIMEOUT_MS);
+
+        /* Batch sizes seen by decodeBatch() and how many CRCs it interleaved */
+        RxBatchStats rx_batch_stats = {};
+
+        /* Optional FEC: parity after every k lifesigns (TX timer), lost ones rebuilt on RX (RX worker) */
+        FecEncoder tx_fec;
+        FecDecoder rx_fec;
+        if (peer_args.fec_data > 0U)
+        {
+            tx_fec.initialize(peer_args.fec_data, peer_args.fec_parity);
+            rx_fec.initialize(FEC_MAX_SOURCES);
+        }
 
         /* Initialize UDP Thread Manager */
         UdpThreadManager threadMgr;
@@ -146,12 +321,56 @@ main(int argc, char* argv[])
             .txPriority = TX_RT_PRIORITY,
             .useRealtimeScheduling = true,
             .rxBufferSize = SO_RCVBUF_SIZE,
-            .txBufferSize = SO_SNDBUF_SIZE
+            .txBufferSize = SO_SNDBUF_SIZE,
+            .useHugePages = true,
+            .lockMemory = true,
+            .numaAware = true,
+            .ringPlacement = UdpThreadManager::RingPlacement::Writer,
+            .rxDeliveryMode = UdpThreadManager::RxDeliveryMode::WorkerPool,
+            .rxWorkerCount = 1U,  /* rx_monitor/rx_sequence need packets in order: keep a single worker */
+            .rxWorkerCpuCores = {RX_WORKER_CPU_CORE, -1, -1, -1},
+            .rxWorkerPriority = RX_WORKER_RT_PRIORITY,
+            .rxWorkerBatchSize = RX_WORKER_BATCH_SIZE,
+            .rxOverflowPolicy = RingOverflowPolicy::DropNewest,  /* Whole batches per consumeBatch() */
+            .txOverflowPolicy = {RingOverflowPolicy::DropOldest,   /* Control: latest lifesign wins */
+                                 RingOverflowPolicy::DropNewest},  /* Bulk */
+            .overflowBlockTimeoutUs = QUEUE_BLOCK_TIMEOUT_US,
+            .queueTimestamps = true,
+            .txScheduling = UdpThreadManager::TxScheduling::StrictPriority,
+            .txLaneWeights = {TX_CONTROL_LANE_WEIGHT, TX_BULK_LANE_WEIGHT},
+            .txBatchSize = TX_BATCH_SIZE,
+            .txRatePps = TX_RATE_PPS,
+            .txRateBytesPerSec = TX_RATE_BYTES_PER_SEC,
+            .txBurstPackets = TX_BURST_PACKETS,
+            .txBurstBytes = TX_BURST_BYTES,
+            .txDirectSend = true,  /* Lifesign is sporadic: skip the TX thread hop when idle */
+            .lowLatencyProfile = true,
+            .threadStackSize = RT_THREAD_STACK_SIZE,
+            .heapReserveSize = HEAP_RESERVE_SIZE,
+            .faultWarmupMs = FAULT_WARMUP_MS,
+            .holdCpuDmaLatency = true,
+            .cpuDmaLatencyUs = CPU_DMA_LATENCY_US,
+            .checkHostTuning = true,
+            .allocationWarmupMs = FAULT_WARMUP_MS,
+            .abortOnRtAllocation = false,  /* Report only: the RX log path still formats strings */
+            .rtPolicy = SchedPolicy::Fifo,
+            .txDeadlineRuntimeNs = TX_DL_RUNTIME_US * 1000U,  /* Falls back to TX_RT_PRIORITY if refused */
+            .txDeadlineNs = TX_DL_DEADLINE_US * 1000U,
+            .txDeadlinePeriodNs = TX_DL_PERIOD_US * 1000U,
+            .txCoalesceMtu = (peer_args.coalesce == true) ? COALESCE_MTU : 0U,
+            .txCoalesceMaxPackets = COALESCE_MAX_PACKETS,
+            .txCoalesceDeadlineUs = COALESCE_DEADLINE_US,
+            .rxFrameSplitter = AppPacketView::frameLength  /* Always unpack: the peer may coalesce */
         };
 
-        // Set RX callback to process received packets
-        threadMgr.setRxCallback([&rx_packet, &ui](const uint8_t* data, size_t length) {
-            rxPacketHandler(data, length, rx_packet, ui);
+        /* Peer advertised CRC-32C support (written by the RX worker, read by the TX timer) */
+        std::atomic<bool> peer_crc32c{false};
+
+        // Set RX callback to process received packets, a worker batch at a time
+        threadMgr.setRxBatchCallback([&rx_monitor, &rx_sequence, &rx_fec, &rx_reassembly, &rx_batch_stats, &ui,
+                                      &peer_crc32c](const struct iovec* frames, size_t count) {
+            rxBatchHandler(frames, count, rx_monitor, rx_sequence, rx_fec, rx_reassembly, rx_batch_stats, ui,
+                           peer_crc32c);
         });
 
         // Start RX/TX threads
@@ -169,22 +388,36 @@ main(int argc, char* argv[])
         /* TX timer: periodic packet transmission */
         TimerHandle tx_timer;
         tx_timer.initialize(TimerHandle::msec2nsec(TX_INTERVAL_MS), true);
-        tx_timer.setCallback([&threadMgr, &tx_packet, &ui]() {
-            txTimerCallback(threadMgr, tx_packet, ui);
+        tx_timer.setCallback([&threadMgr, &tx_packet, &tx_fec, &tx_parity_packet, &ui, &peer_crc32c, &peer_args]() {
+            /* Switch to CRC-32C only once the peer has shown it can verify it */
+            bool use_crc32c = (peer_args.crc32c == true) && (peer_crc32c.load(std::memory_order_relaxed) == true);
+            tx_packet.setCrcAlgorithm((use_crc32c == true) ? CrcAlgorithm::Castagnoli : CrcAlgorithm::Ieee);
+            tx_parity_packet.setCrcAlgorithm((use_crc32c == true) ? CrcAlgorithm::Castagnoli : CrcAlgorithm::Ieee);
+            txTimerCallback(threadMgr, tx_packet, tx_fec, tx_parity_packet, ui);
         });
 
         /* Comm monitor timer: periodic communication loss check */
         TimerHandle comm_monitor_timer;
         comm_monitor_timer.initialize(TimerHandle::msec2nsec(COMM_MONITOR_MS), true);
-        comm_monitor_timer.setCallback([&rx_packet, &loop, &ui]() {
-            commMonitorCallback(rx_packet, loop, ui);
+        comm_monitor_timer.setCallback([&rx_monitor, &rx_reassembly, &ui]() {
+            commMonitorCallback(rx_monitor, rx_reassembly, ui);
+        });
+
+        /* Message timer: optional large message, fragmented onto the Bulk lane */
+        TimerHandle message_timer;
+        message_timer.initialize(TimerHandle::msec2nsec(MESSAGE_INTERVAL_MS), true);
+        message_timer.setCallback([&threadMgr, &tx_message_packet, &tx_fragmenter, &tx_message, &ui,
+                                   &peer_crc32c, &peer_args]() {
+            bool use_crc32c = (peer_args.crc32c == true) && (peer_crc32c.load(std::memory_order_relaxed) == true);
+            tx_message_packet.setCrcAlgorithm((use_crc32c == true) ? CrcAlgorithm::Castagnoli : CrcAlgorithm::Ieee);
+            txMessageCallback(threadMgr, tx_message_packet, tx_fragmenter, tx_message, ui);
         });
 
         /* Latency stats report timer: periodic percentile stats output */
         TimerHandle stats_timer;
         stats_timer.initialize(TimerHandle::msec2nsec(STATS_REPORT_INTERVAL_MS), true);
-        stats_timer.setCallback([&threadMgr, &ui]() {
-            statsReportCallback(threadMgr, ui);
+        stats_timer.setCallback([&threadMgr, &rx_sequence, &tx_fec, &rx_fec, &rx_batch_stats, &ui]() {
+            statsReportCallback(threadMgr, rx_sequence, tx_fec, rx_fec, rx_batch_stats, ui);
         });
 
         /* Register TX timer event */
@@ -197,11 +430,34 @@ main(int argc, char* argv[])
             comm_monitor_timer.handleEvent();
         });
 
+        /* Register Message timer event (only with --message) */
+        if (peer_args.message_size > 0U)
+        {
+            loop.registerEvent(message_timer.getFd(), EPOLLIN, [&message_timer]() {
+                message_timer.handleEvent();
+            });
+        }
+
         /* Register Stats report timer event */
         loop.registerEvent(stats_timer.getFd(), EPOLLIN, [&stats_timer]() {
             stats_timer.handleEvent();
         });
 
+        /* Runtime control socket: re-pin, re-prioritise, resize socket buffers */
+        ControlServer control;
+        if (peer_args.control_path != nullptr)
+        {
+            if (control.open(peer_args.control_path, threadMgr) == true)
+            {
+                control.setLogCallback([&ui](const std::string& text) {
+                    ui.log(text + "\n");
+                });
+                loop.registerEvent(control.getFd(), EPOLLIN, [&control]() {
+                    control.handleEvent();
+                });
+            }
+        }
+
         // Register shutdown callback to stop event loop on signal
         signalHandler.registerCallback([&loop](int) {
             loop.stop();
@@ -234,67 +490,321 @@ main_exit:
  * Function Definition
  ******************************************************************************/
 
+/**
+ * @brief RX batch handler
+ *
+ * Called via callback with the packets a worker popped together: from
+ * the RX worker thread in WorkerPool mode, from the RX thread (one packet
+ * per call) in Inline mode. Frames and CRCs of the whole batch are
+ * checked in one AppPacket::decodeBatch() pass; each valid packet then
+ * goes, in arrival order, to rxFragmentHandler() if it is a fragment and
+ * to rxPacketHandler() otherwise.
+ *
+ * @param[in] frames Received packets, valid for the duration of the call
+ * @param[in] count Number of packets
+ * @param[in,out] rx_reassembly Fragment reassembly (see rxFragmentHandler())
+ * @param[in,out] rx_batch_stats decodeBatch() counters (this thread is their writer)
+ * @param[in,out] rx_monitor, rx_sequence, rx_fec, ui, peer_crc32c See rxPacketHandler()
+ */
+static void
+rxBatchHandler(const struct iovec* frames, size_t count, PeerMonitor& rx_monitor,
+               SequenceTracker& rx_sequence, FecDecoder& rx_fec, RxReassembly& rx_reassembly,
+               RxBatchStats& rx_batch_stats, TerminalUI& ui, std::atomic<bool>& peer_crc32c)
+{
+    AppPacketFrame batch[APP_PACKET_MAX_BATCH];
+    AppPacket::BatchSummary summary;
+
+    for (size_t first = 0U; first < count; first += APP_PACKET_MAX_BATCH)
+    {
+        size_t chunk = std::min(count - first, APP_PACKET_MAX_BATCH);
+
+        for (size_t idx = 0U; idx < chunk; idx++)
+        {
+            batch[idx] = {static_cast<const uint8_t*>(frames[first + idx].iov_base), frames[first + idx].iov_len};
+        }
+
+        AppPacket::decodeBatch(std::span<const AppPacketFrame>(batch, chunk), summary);
+
+        /* Single writer: plain load + store, no read-modify-write */
+        rx_batch_stats.batches.store(rx_batch_stats.batches.load(std::memory_order_relaxed) + 1U,
+                                     std::memory_order_relaxed);
+        rx_batch_stats.frames.store(rx_batch_stats.frames.load(std::memory_order_relaxed) + chunk,
+                                    std::memory_order_relaxed);
+        rx_batch_stats.interleaved.store(rx_batch_stats.interleaved.load(std::memory_order_relaxed) +
+                                         summary.interleaved, std::memory_order_relaxed);
+        if (chunk > rx_batch_stats.largest.load(std::memory_order_relaxed))
+        {
+            rx_batch_stats.largest.store(chunk, std::memory_order_relaxed);
+        }
+
+        for (size_t idx = 0U; idx < chunk; idx++)
+        {
+            if (summary.status[idx] != AppPacket::AppPacketError::None)
+            {
+                ui.log(std::format(
+                    "[RX] Decode failed: error code {}\n",
+                    static_cast<int>(summary.status[idx])));
+            }
+            else if ((summary.flags[idx] & APP_PACKET_FLAG_FRAGMENT) != 0U)
+            {
+                /* Fragments carry no lifesign of the monitored stream */
+                rxFragmentHandler(AppPacketView(batch[idx].data, batch[idx].length, false), rx_reassembly, ui);
+            }
+            else
+            {
+                /* CRC already verified for the batch: framing only */
+                rxPacketHandler(AppPacketView(batch[idx].data, batch[idx].length, false),
+                                rx_monitor, rx_sequence, rx_fec, ui, peer_crc32c);
+            }
+        }
+    }
+}
+
+/**
+ * @brief RX fragment handler
+ *
+ * Adds one fragment to the reassembler and reports the message it
+ * completes. Fragments are encoded by the sender's own AppPacket, so
+ * they are kept away from the peer monitor and the sequence tracker.
+ *
+ * @param[in] packet Valid packet flagged APP_PACKET_FLAG_FRAGMENT
+ * @param[in,out] rx_reassembly Fragment reassembly (lock taken here)
+ */
+static void
+rxFragmentHandler(const AppPacketView& packet, RxReassembly& rx_reassembly, TerminalUI& ui)
+{
+    ReassembledMessage message = {};
+    Reassembler::Result result = Reassembler::Result::Rejected;
+
+    {
+        std::lock_guard<std::mutex> lock(rx_reassembly.lock);
+        result = rx_reassembly.reassembler.addFragment(packet.getUniqueId(), packet.getPayload(),
+                                                       steadyNowNs(), message);
+    }
+
+    if (result == Reassembler::Result::Complete)
+    {
+        ui.log(std::format(
+            "[RX] Message UniqueId: 0x{:08X}, Id: {}, Length: {} bytes, reassembled in {} us\n",
+            message.source_id,
+            message.message_id,
+            message.length,
+            message.latency_ns / 1000U));
+    }
+    else if (result == Reassembler::Result::Rejected)
+    {
+        ui.log(std::format(
+            "[RX] Fragment rejected: UniqueId: 0x{:08X}, DataLen: {}\n",
+            packet.getUniqueId(),
+            packet.getDataLength()));
+    }
+}
+
 /**
  * @brief RX packet handler
  *
- * Called from RX thread via callback when packet is received.
- * Decodes and processes the packet.
+ * Handles one valid packet of a batch. Feeds its lifesign to the monitor
+ * (FEC parity excepted) and the sequence tracker. With FEC on, the packet is also handed to
+ * the decoder; packets it rebuilds are validated and delivered right
+ * after it (to the sequence tracker, not the monitor: they carry no
+ * arrival time).
  *
- * @param[in] data Pointer to received data
- * @param[in] length Length of received data
- * @param[in,out] rx_packet Reference to RX packet for decoding
+ * @param[in] packet Valid received packet
+ * @param[in,out] rx_monitor Peer monitor (this thread is its writer)
+ * @param[in,out] rx_sequence Per-sender sequence tracker (this thread is its writer)
+ * @param[in,out] rx_fec FEC decoder (this thread is its writer; disabled without --fec)
+ * @param[out] peer_crc32c Set to whether the peer advertises CRC-32C support
  */
 static void
-rxPacketHandler(const uint8_t* data, size_t length, AppPacket& rx_packet, TerminalUI& ui)
+rxPacketHandler(const AppPacketView& packet, PeerMonitor& rx_monitor,
+                SequenceTracker& rx_sequence, FecDecoder& rx_fec, TerminalUI& ui,
+                std::atomic<bool>& peer_crc32c)
 {
-    bool decode_ok = rx_packet.decode(data, length);
+    SequenceTracker::Event sequence_event = SequenceTracker::Event::InOrder;
+    FecRecovery recovery = {};
+    PeerStatus peer = {};
+    uint32_t peer_index = PEER_MONITOR_NONE;
+    uint64_t now_ns = steadyNowNs();
+
+    /* Parity follows its group at once, off the TX cadence, and counts its own lifesigns */
+    if ((packet.getFlags() & APP_PACKET_FLAG_FEC_PARITY) == 0U)
+    {
+        peer_index = rx_monitor.update(packet.getUniqueId(), packet.getLifesign(), now_ns);
+        rx_monitor.getStatus(peer_index, now_ns, peer);
+        sequence_event = rx_sequence.update(packet.getUniqueId(), packet.getLifesign());
+    }
+    peer_crc32c.store(packet.isPeerCrc32cCapable(), std::memory_order_relaxed);
+
+    ui.log(std::format(
+        "[RX] UniqueId: 0x{:08X}, Lifesign: {}, DataLen: {}, Interval: {} us, {}{}\n",
+        packet.getUniqueId(),
+        packet.getLifesign(),
+        packet.getDataLength(),
+        peer.last_interval_us,
+        Crc32::algorithmName(packet.getCrcAlgorithm()),
+        ((packet.getFlags() & APP_PACKET_FLAG_FEC_PARITY) != 0U) ? ", FEC parity" : ""));
+
+    if (sequence_event == SequenceTracker::Event::Gap)
+    {
+        ui.log(std::format(
+            "[RX] Sequence gap: {} lifesign(s) missing before {}\n",
+            rx_sequence.getLastGap(),
+            packet.getLifesign()));
+    }
+    else if ((sequence_event == SequenceTracker::Event::Duplicate) ||
+             (sequence_event == SequenceTracker::Event::Reordered) ||
+             (sequence_event == SequenceTracker::Event::Late) ||
+             (sequence_event == SequenceTracker::Event::Resync))
+    {
+        ui.log(std::format(
+            "[RX] Sequence {}: lifesign {}\n",
+            (sequence_event == SequenceTracker::Event::Duplicate) ? "duplicate" :
+            (sequence_event == SequenceTracker::Event::Reordered) ? "reordered" :
+            (sequence_event == SequenceTracker::Event::Late) ? "late" : "resync",
+            packet.getLifesign()));
+    }
 
-    if (decode_ok == true)
+    if (peer.unstable_counter > 0U)
     {
         ui.log(std::format(
-            "[RX] UniqueId: 0x{:08X}, Lifesign: {}, DataLen: {}, Interval: {} us\n",
-            rx_packet.getUniqueId(),
-            rx_packet.getReceivedLifesign(),
-            rx_packet.getDataLength(),
-            rx_packet.getLastIntervalUs()));
+            "[RX] Warning: Communication unstable (count: {})\n",
+            peer.unstable_counter));
+    }
 
-        if (rx_packet.isCommUnstable() == true)
+    /* Rebuilt packets fill their gap in the sequence as if they had arrived out of order */
+    rx_fec.add(packet, recovery);
+    for (size_t idx = 0U; idx < recovery.count; idx++)
+    {
+        AppPacketView rebuilt(recovery.frames[idx].data, recovery.frames[idx].length);
+
+        if (rebuilt.isValid() == true)
+        {
+            rx_sequence.update(rebuilt.getUniqueId(), rebuilt.getLifesign());
+            ui.log(std::format(
+                "[RX] FEC rebuilt UniqueId: 0x{:08X}, Lifesign: {}, DataLen: {}\n",
+                rebuilt.getUniqueId(),
+                rebuilt.getLifesign(),
+                rebuilt.getDataLength()));
+        }
+        else
         {
             ui.log(std::format(
-                "[RX] Warning: Communication unstable (count: {})\n",
-                rx_packet.getUnstableCounter()));
+                "[RX] FEC rebuilt lifesign {} failed validation: error code {}\n",
+                recovery.frames[idx].lifesign,
+                static_cast<int>(rebuilt.getError())));
         }
     }
-    else
+}
+
+
+/**
+ * @brief Message timer callback
+ *
+ * Sends the test message as fragments on the Bulk lane, so a burst
+ * never delays lifesigns queued on the Control lane. The message uses
+ * its own AppPacket: fragments consume none of the lifesigns the peer
+ * monitors.
+ *
+ * @param[in,out] threadMgr Thread manager (TX queues)
+ * @param[in,out] tx_message_packet Encoder of the fragments
+ * @param[in,out] tx_fragmenter Fragmenter (message id incremented per call)
+ * @param[in] tx_message Message to send
+ */
+static void
+txMessageCallback(UdpThreadManager& threadMgr, AppPacket& tx_message_packet, Fragmenter& tx_fragmenter,
+                  const std::vector<uint8_t>& tx_message, TerminalUI& ui)
+{
+    AppPacketGather tx_gather = {};
+    uint32_t not_queued = 0U;
+
+    if (tx_fragmenter.begin(tx_message.data(), tx_message.size()) == false)
     {
-        ui.log(std::format(
-            "[RX] Decode failed: error code {}\n",
-            static_cast<int>(rx_packet.getError())));
+        ui.log("[TX] Message not fragmented (invalid length)\n");
+        goto txMessageCallback_exit;
+    }
+
+    while (tx_fragmenter.next(tx_message_packet, tx_gather) == true)
+    {
+        if (threadMgr.queueTxPacketv(tx_gather.iov, tx_gather.iovcnt,
+                                     UdpThreadManager::TxLane::Bulk) == false)
+        {
+            not_queued++;
+        }
     }
-}
 
+    ui.log(std::format(
+        "[TX] Message Id: {}, Length: {} bytes, Fragments: {}, Not queued: {}\n",
+        tx_fragmenter.getMessageId(),
+        tx_message.size(),
+        tx_fragmenter.getFragmentCount(),
+        not_queued));
+
+txMessageCallback_exit:
+    return;
+}
 
 /**
  * @brief Communication monitor callback
  *
- * Periodic callback to check for communication loss.
- * Stops the event loop if communication is lost.
+ * Periodic callback that handles the peer deadlines due by now (timer
+ * wheel: the cost does not grow with the number of healthy peers).
+ * State changes are reported through peerStateCallback(). Partial
+ * messages whose fragments stopped arriving are released here as well.
  *
- * @param[in] rx_packet Reference to RX packet for monitoring
- * @param[in,out] loop  Reference to event loop
+ * @param[in,out] rx_monitor Peer monitor (this thread polls it)
+ * @param[in,out] rx_reassembly Fragment reassembly (lock taken here)
  */
 static void
-commMonitorCallback(AppPacket& rx_packet, EventLoop& loop, TerminalUI& ui)
+commMonitorCallback(PeerMonitor& rx_monitor, RxReassembly& rx_reassembly, TerminalUI& ui)
 {
-    if (rx_packet.isCommLost() == true)
+    const uint64_t now_ns = steadyNowNs();
+    size_t expired = 0U;
+
+    rx_monitor.poll(now_ns);
+
     {
-        ui.log(std::format(
-            "[MONITOR] Communication lost! No packet for {} ms (threshold: {} ms)\n",
-            rx_packet.getTimeSinceLastChange(),
-            rx_packet.getCommTimeout()));
+        std::lock_guard<std::mutex> lock(rx_reassembly.lock);
+        expired = rx_reassembly.reassembler.expire(now_ns);
+    }
+
+    if (expired > 0U)
+    {
+        ui.log(std::format("[RX] {} partial message(s) timed out\n", expired));
+    }
 
-        /* Stop the event loop on comm loss - or handle as needed */
-        /* loop.stop(); */
+    /* To stop on comm loss, capture the loop in the state callback and call stop() there */
+}
+
+
+/**
+ * @brief Peer state change callback
+ *
+ * Called by the RX worker (a packet changed the state) or by the event
+ * loop (a deadline passed); TerminalUI::log() is thread-safe.
+ *
+ * @param[in] rx_monitor Peer monitor
+ * @param[in] unique_id  Peer whose state changed
+ * @param[in] from       Previous state
+ * @param[in] to         New state
+ */
+static void
+peerStateCallback(const PeerMonitor& rx_monitor, uint32_t unique_id, PeerState from, PeerState to,
+                  TerminalUI& ui)
+{
+    if (to == PeerState::Lost)
+    {
+        ui.log(std::format(
+            "[MONITOR] Communication lost! Peer 0x{:08X} lifesign frozen for {} ms\n",
+            unique_id,
+            rx_monitor.getCommTimeout()));
+    }
+    else
+    {
+        ui.log(std::format(
+            "[MONITOR] Peer 0x{:08X}: {} -> {}\n",
+            unique_id,
+            PeerMonitor::stateName(from),
+            PeerMonitor::stateName(to)));
     }
 }
 
@@ -302,25 +812,33 @@ commMonitorCallback(AppPacket& rx_packet, EventLoop& loop, TerminalUI& ui)
 /**
  * @brief TX timer callback
  *
- * Periodic callback to transmit packets via TX thread.
+ * Periodic callback to transmit packets via TX thread. With FEC on, each
+ * lifesign is folded into the open parity group; when the group is
+ * complete its parity packets are queued right behind it.
  *
  * @param[in,out] threadMgr Reference to thread manager
  * @param[in,out] tx_packet Reference to TX packet
+ * @param[in,out] tx_fec FEC encoder (disabled without --fec)
+ * @param[in,out] tx_parity_packet Encoder of the parity packets (lifesigns of its own)
  */
 static void
-txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, TerminalUI& ui)
+txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, FecEncoder& tx_fec,
+                AppPacket& tx_parity_packet, TerminalUI& ui)
 {
     static const uint8_t tx_payload[] = "Agent Team Test";
-    uint8_t tx_buffer[256] = {0};
+    AppPacketGather tx_gather;
+    bool fec_complete = false;
 
     tx_packet.setDataPointer(tx_payload, sizeof(tx_payload) - 1U);
 
-    size_t encoded_len = tx_packet.encode(tx_buffer, sizeof(tx_buffer));
+    /* Header/footer on the stack, payload in place: sendmsg or one copy into the ring slot */
+    size_t encoded_len = tx_packet.encodeGather(tx_gather);
 
     if (encoded_len > 0U)
     {
-        // Queue packet for transmission via TX thread
-        if (threadMgr.queueTxPacket(tx_buffer, encoded_len) == true)
+        // Queue lifesign on the control lane so bulk traffic cannot delay it
+        if (threadMgr.queueTxPacketv(tx_gather.iov, tx_gather.iovcnt,
+                                     UdpThreadManager::TxLane::Control) == true)
         {
             ui.log(std::format(
                 "[TX] Lifesign: {}, Queued: {} bytes (TX queue: {})\n",
@@ -332,6 +850,26 @@ txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, TerminalUI& u
         {
             ui.log("[TX] Failed to queue packet (queue full)\n");
         }
+
+        /* Folded in even if not queued: the peer then rebuilds it like a lost one */
+        fec_complete = (tx_fec.isEnabled() == true) &&
+                       (tx_fec.add(tx_gather.header.lifesign, tx_gather.iov, tx_gather.iovcnt) == true);
+    }
+
+    while ((fec_complete == true) && (tx_fec.encodeParity(tx_parity_packet, tx_gather) == true))
+    {
+        if (threadMgr.queueTxPacketv(tx_gather.iov, tx_gather.iovcnt,
+                                     UdpThreadManager::TxLane::Control) == true)
+        {
+            ui.log(std::format(
+                "[TX] FEC parity lifesign: {}, Queued: {} bytes\n",
+                tx_gather.header.lifesign,
+                tx_gather.length));
+        }
+        else
+        {
+            ui.log("[TX] Failed to queue FEC parity (queue full)\n");
+        }
     }
 }
 
@@ -340,17 +878,110 @@ txTimerCallback(UdpThreadManager& threadMgr, AppPacket& tx_packet, TerminalUI& u
  *
  * Periodic callback to print percentile latency statistics.
  * Computes and displays p50/p95/p99/p99.9/p99.99 for TX send,
- * RX processing, and RX inter-packet interval.
+ * RX processing, RX inter-packet interval and queue residence time,
+ * plus the queue high-water marks, the lifesign sequence analytics
+ * summed over all senders, the RX batch sizes and the FEC counters.
  *
  * @param[in,out] threadMgr Reference to thread manager
+ * @param[in] rx_sequence Per-sender sequence tracker (read side)
+ * @param[in] tx_fec FEC encoder (same thread as the TX timer)
+ * @param[in] rx_fec FEC decoder (read side)
+ * @param[in] rx_batch_stats decodeBatch() counters (read side)
  */
 static void
-statsReportCallback(UdpThreadManager& threadMgr, TerminalUI& ui)
+statsReportCallback(UdpThreadManager& threadMgr, const SequenceTracker& rx_sequence,
+                    const FecEncoder& tx_fec, const FecDecoder& rx_fec,
+                    const RxBatchStats& rx_batch_stats, TerminalUI& ui)
 {
-    auto rxStats = threadMgr.getRxLatencyStats().computeStats();
-    auto txStats = threadMgr.getTxLatencyStats().computeStats();
-    auto intervalStats = threadMgr.getRxIntervalStats().computeStats();
+    UdpThreadManager::TxCounters tx_counters = threadMgr.getTxCounters();
+    UdpThreadManager::RxCounters rx_counters = threadMgr.getRxCounters();
+    FecEncoderStats fec_tx = tx_fec.getStats();
+    FecDecoderStats fec_rx = rx_fec.getStats();
+    SequenceStats sequence = {};
+    SequenceStats stream = {};
+
+    for (size_t i = 0U; i < rx_sequence.getStreamCount(); i++)
+    {
+        if (rx_sequence.getStats(i, stream) == true)
+        {
+            sequence.received       += stream.received;
+            sequence.lost           += stream.lost;
+            sequence.window_span    += stream.window_span;
+            sequence.window_missing += stream.window_missing;
+            sequence.duplicates     += stream.duplicates;
+            sequence.reordered      += stream.reordered;
+            sequence.late           += stream.late;
+            sequence.max_reorder     = std::max(sequence.max_reorder, stream.max_reorder);
+            for (size_t b = 0U; b < SEQUENCE_REORDER_BUCKETS; b++)
+            {
+                sequence.reorder_histogram[b] += stream.reorder_histogram[b];
+            }
+        }
+    }
+
+    TerminalUI::Dashboard dashboard = {
+        .txSend = threadMgr.getTxLatencyStats().computeStats(),
+        .rxProc = threadMgr.getRxLatencyStats().computeStats(),
+        .rxInterval = threadMgr.getRxIntervalStats().computeStats(),
+        .txShaping = threadMgr.getTxShapingStats().computeStats(),
+        .txDirect = threadMgr.getTxDirectLatencyStats().computeStats(),
+        .txQueued = threadMgr.getTxQueuedLatencyStats().computeStats(),
+        .txControlQueue = threadMgr.getTxResidenceStats(UdpThreadManager::TxLane::Control).computeStats(),
+        .txBulkQueue = threadMgr.getTxResidenceStats(UdpThreadManager::TxLane::Bulk).computeStats(),
+        .rxQueue = threadMgr.getRxResidenceStats(0U).computeStats(),  /* Single worker */
+        .txCoalesceHold = threadMgr.getTxCoalesceHoldStats().computeStats(),
+        .txControlHighWater = threadMgr.getTxQueueHighWaterMark(UdpThreadManager::TxLane::Control),
+        .txBulkHighWater = threadMgr.getTxQueueHighWaterMark(UdpThreadManager::TxLane::Bulk),
+        .rxQueueHighWater = threadMgr.getRxQueueHighWaterMark(),
+        .queueCapacity = UdpThreadManager::getQueueCapacity(),
+        .coalescedDatagrams = tx_counters.coalescedDatagrams,
+        .coalescedPackets = tx_counters.coalescedPackets,
+        .coalesceFlushes = {tx_counters.coalesceFlushes[0], tx_counters.coalesceFlushes[1],
+                            tx_counters.coalesceFlushes[2], tx_counters.coalesceFlushes[3]},
+        .rxDatagrams = rx_counters.packets,
+        .rxFrames = rx_counters.frames,
+        .rxBatches = rx_batch_stats.batches.load(std::memory_order_relaxed),
+        .rxBatchFrames = rx_batch_stats.frames.load(std::memory_order_relaxed),
+        .rxBatchInterleaved = rx_batch_stats.interleaved.load(std::memory_order_relaxed),
+        .rxBatchLargest = rx_batch_stats.largest.load(std::memory_order_relaxed),
+        .seqReceived = sequence.received,
+        .seqLost = sequence.lost,
+        .seqWindowSpan = sequence.window_span,
+        .seqWindowMissing = sequence.window_missing,
+        .seqDuplicates = sequence.duplicates,
+        .seqReordered = sequence.reordered,
+        .seqLate = sequence.late,
+        .seqMaxReorder = sequence.max_reorder,
+        .seqReorderHistogram = {sequence.reorder_histogram[0], sequence.reorder_histogram[1],
+                                sequence.reorder_histogram[2], sequence.reorder_histogram[3],
+                                sequence.reorder_histogram[4], sequence.reorder_histogram[5],
+                                sequence.reorder_histogram[6], sequence.reorder_histogram[7]},
+        .fecData = static_cast<uint8_t>(tx_fec.getDataCount()),
+        .fecParity = static_cast<uint8_t>(tx_fec.getParityCount()),
+        .fecParitySent = fec_tx.parityPackets,
+        .fecEncodeNs = static_cast<double>(fec_tx.encodeNs) / static_cast<double>(std::max<uint64_t>(1U, fec_tx.dataPackets)),
+        .fecParityReceived = fec_rx.parityPackets,
+        .fecRecovered = fec_rx.recovered,
+        .fecUnrecoverable = fec_rx.unrecoverable,
+        .fecDecodeNs = static_cast<double>(fec_rx.decodeNs) /
+                       static_cast<double>(std::max<uint64_t>(1U, fec_rx.dataPackets + fec_rx.parityPackets)),
+        .rxThread = threadMgr.getRxThreadTelemetry(),
+        .txThread = threadMgr.getTxThreadTelemetry(),
+        .rxWorker = threadMgr.getRxWorkerTelemetry(0U)
+    };
 
     /* Update the pinned dashboard (upper area) */
-    ui.updateStats(txStats, rxStats, intervalStats);
+    ui.updateStats(dashboard);
+}
+
+/**
+ * @brief Monotonic time for the peer monitor
+ *
+ * @return steady_clock time in nanoseconds
+ */
+static uint64_t
+steadyNowNs(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count());
 }
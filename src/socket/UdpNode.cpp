@@ -20,6 +20,8 @@
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <ifaddrs.h>
+#include <net/if.h>
 #include <unistd.h>
 #include <iostream>
 #include <format>
@@ -158,6 +160,45 @@ UdpNode::send(const uint8_t* data, size_t length)
 }
 
 
+/**
+ * @brief Send one datagram gathered from several buffers (sendmsg)
+ *
+ * The kernel copies the pieces straight into the skb, so header, payload
+ * and footer need not be contiguous in user space.
+ *
+ * @param[in] iov     Buffers in datagram order
+ * @param[in] iovcnt  Number of buffers
+ * @return Bytes sent, or -1 on error
+ */
+ssize_t
+UdpNode::sendv(const struct iovec* iov, size_t iovcnt)
+{
+    ssize_t sent_bytes = -1;
+    struct msghdr message = {};
+
+    message.msg_iov    = const_cast<struct iovec*>(iov);
+    message.msg_iovlen = iovcnt;
+
+    sent_bytes = sendmsg(m_sockfd, &message, 0);
+
+    if (sent_bytes < 0)
+    {
+        m_error = UdpNodeError::SendFail;
+        std::cerr << std::format(
+            "UdpNode::sendv: Send failed\n"
+            "sent_bytes: {}\n",
+            sent_bytes)
+            << std::endl;
+    }
+    else
+    {
+        m_error = UdpNodeError::None;
+    }
+
+    return sent_bytes;
+}
+
+
 ssize_t
 UdpNode::receive(uint8_t* buffer, size_t length)
 {
@@ -190,6 +231,42 @@ UdpNode::getFd(void) const
 }
 
 
+/**
+ * @brief Get the name of the network interface the socket is bound to
+ *
+ * Matches the bound IPv4 address against the host's interface addresses.
+ *
+ * @return Interface name, or empty if unbound / bound to INADDR_ANY
+ */
+std::string
+UdpNode::getInterfaceName(void) const
+{
+    std::string name;
+    struct sockaddr_in local_addr = {0};
+    socklen_t addr_len = sizeof(local_addr);
+    struct ifaddrs* if_list = nullptr;
+
+    if ((m_sockfd >= 0) &&
+        (getsockname(m_sockfd, (struct sockaddr*)&local_addr, &addr_len) == 0) &&
+        (local_addr.sin_addr.s_addr != htonl(INADDR_ANY)) &&
+        (getifaddrs(&if_list) == 0))
+    {
+        for (struct ifaddrs* ifa = if_list; (ifa != nullptr) && (name.empty() == true); ifa = ifa->ifa_next)
+        {
+            if ((ifa->ifa_addr != nullptr) &&
+                (ifa->ifa_addr->sa_family == AF_INET) &&
+                (((struct sockaddr_in*)ifa->ifa_addr)->sin_addr.s_addr == local_addr.sin_addr.s_addr))
+            {
+                name = ifa->ifa_name;
+            }
+        }
+        freeifaddrs(if_list);
+    }
+
+    return name;
+}
+
+
 void
 UdpNode::close(void)
 {
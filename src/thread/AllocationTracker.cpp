@@ -0,0 +1,474 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file AllocationTracker.cpp
+ * @ingroup thread
+ * @brief Heap allocation detector implementation and allocator wrappers
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/AllocationTracker.hpp"
+
+#if defined(ALLOC_TRACKING)
+#include <dlfcn.h>
+#include <unistd.h>
+#include <cxxabi.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <new>
+#include <string>
+
+#include "timer/TscClock.hpp"
+
+/*******************************************************************************
+ * glibc allocator entry points (the wrappers below forward to these)
+ ******************************************************************************/
+extern "C"
+{
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void  __libc_free(void* ptr);
+}
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint64_t NSEC_PER_MSEC    = 1'000'000ULL;
+static constexpr size_t   NAME_SIZE        = 32U;
+static constexpr size_t   REPORT_TOP_SITES = 8U;
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+
+/**
+ * @brief Counters of one registered thread
+ *
+ * Written only by the owning thread (relaxed atomics so report() may run
+ * at any time without a data race).
+ */
+struct ThreadSlot
+{
+    std::atomic<bool> used;
+    char name[NAME_SIZE];
+    uint64_t warmupEndTicks;
+    bool abortAfterWarmup;
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> afterWarmup;
+    std::atomic<uint64_t> sitesDropped;     /**< Post-warm-up allocations with no free site entry */
+    std::atomic<uintptr_t> siteCaller[AllocationTracker::MAX_SITES];   /**< 0 = empty */
+    std::atomic<uint64_t> siteCount[AllocationTracker::MAX_SITES];
+};
+
+static ThreadSlot s_slots[AllocationTracker::MAX_THREADS];
+static std::mutex s_registerMutex;
+
+/* Trivial type: no TLS constructor runs inside malloc */
+static thread_local ThreadSlot* t_slot = nullptr;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+static void
+writeText(const char* text)
+{
+    ssize_t ignored = write(STDERR_FILENO, text, strlen(text));
+    (void)ignored;
+}
+
+/**
+ * @brief Format a number without allocating (abort path runs inside malloc)
+ */
+static const char*
+formatHex(uintptr_t value, char (&buffer)[2U + 2U * sizeof(uintptr_t) + 1U])
+{
+    static constexpr char DIGITS[] = "0123456789abcdef";
+    size_t pos = sizeof(buffer) - 1U;
+
+    buffer[pos] = '\0';
+    do
+    {
+        buffer[--pos] = DIGITS[value & 0xFU];
+        value >>= 4U;
+    }
+    while ((value != 0U) && (pos > 2U));
+    buffer[--pos] = 'x';
+    buffer[--pos] = '0';
+
+    return &buffer[pos];
+}
+
+[[noreturn]] static void
+abortOnAllocation(const ThreadSlot& slot, size_t size, uintptr_t caller)
+{
+    char sizeText[2U + 2U * sizeof(uintptr_t) + 1U];
+    char callerText[2U + 2U * sizeof(uintptr_t) + 1U];
+
+    writeText("AllocationTracker: heap allocation on RT thread \"");
+    writeText(slot.name);
+    writeText("\" after warm-up, size ");
+    writeText(formatHex(size, sizeText));
+    writeText(", caller ");
+    writeText(formatHex(caller, callerText));
+    writeText("\n");
+    std::abort();
+}
+
+static void
+recordSite(ThreadSlot& slot, uintptr_t caller)
+{
+    /* Open addressing on the return address; the table only ever grows */
+    size_t index = static_cast<size_t>((caller >> 4U) * 0x9E3779B97F4A7C15ULL) % AllocationTracker::MAX_SITES;
+    bool recorded = false;
+
+    for (size_t probe = 0U; (probe < AllocationTracker::MAX_SITES) && (recorded == false); probe++)
+    {
+        size_t slotIndex = (index + probe) % AllocationTracker::MAX_SITES;
+        uintptr_t current = slot.siteCaller[slotIndex].load(std::memory_order_relaxed);
+
+        if (current == 0U)
+        {
+            slot.siteCaller[slotIndex].store(caller, std::memory_order_relaxed);
+            current = caller;
+        }
+        if (current == caller)
+        {
+            slot.siteCount[slotIndex].store(slot.siteCount[slotIndex].load(std::memory_order_relaxed) + 1U,
+                                            std::memory_order_relaxed);
+            recorded = true;
+        }
+    }
+
+    if (recorded == false)
+    {
+        slot.sitesDropped.store(slot.sitesDropped.load(std::memory_order_relaxed) + 1U,
+                                std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Count one allocation of the calling thread (no-op if unregistered)
+ */
+static inline void
+recordAllocation(size_t size, void* caller)
+{
+    ThreadSlot* slot = t_slot;
+
+    if (slot != nullptr)
+    {
+        /* Single writer per slot: load + store instead of a locked RMW */
+        slot->allocations.store(slot->allocations.load(std::memory_order_relaxed) + 1U,
+                                std::memory_order_relaxed);
+
+        if (TscClock::now() >= slot->warmupEndTicks)
+        {
+            uintptr_t address = reinterpret_cast<uintptr_t>(caller);
+
+            slot->afterWarmup.store(slot->afterWarmup.load(std::memory_order_relaxed) + 1U,
+                                    std::memory_order_relaxed);
+            recordSite(*slot, address);
+
+            if (slot->abortAfterWarmup == true)
+            {
+                abortOnAllocation(*slot, size, address);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Describe a code address as "symbol+0x.. (module+0x..)"
+ */
+static std::string
+describeSite(uintptr_t address)
+{
+    std::string text = std::format("0x{:x}", address);
+    Dl_info info = {};
+
+    if ((dladdr(reinterpret_cast<void*>(address), &info) != 0) && (info.dli_fname != nullptr))
+    {
+        uintptr_t moduleOffset = address - reinterpret_cast<uintptr_t>(info.dli_fbase);
+
+        if (info.dli_sname != nullptr)
+        {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+
+            text = std::format("{}+0x{:x}", (status == 0) ? demangled : info.dli_sname,
+                               address - reinterpret_cast<uintptr_t>(info.dli_saddr));
+            std::free(demangled);
+        }
+        text += std::format(" ({}+0x{:x})", info.dli_fname, moduleOffset);
+    }
+
+    return text;
+}
+#endif  // ALLOC_TRACKING
+
+/*******************************************************************************
+ * Public Methods
+ ******************************************************************************/
+
+bool
+AllocationTracker::isCompiledIn()
+{
+#if defined(ALLOC_TRACKING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+AllocationTracker::registerThread(const char* name, uint32_t warmupMs, bool abortAfterWarmup)
+{
+    bool result = false;
+
+#if defined(ALLOC_TRACKING)
+    std::lock_guard<std::mutex> lock(s_registerMutex);
+    ThreadSlot* slot = nullptr;
+
+    for (ThreadSlot& candidate : s_slots)
+    {
+        if ((candidate.used.load(std::memory_order_relaxed) == true) &&
+            (std::strncmp(candidate.name, name, NAME_SIZE - 1U) == 0))
+        {
+            slot = &candidate;
+            break;
+        }
+    }
+    for (ThreadSlot& candidate : s_slots)
+    {
+        if ((slot == nullptr) && (candidate.used.load(std::memory_order_relaxed) == false))
+        {
+            slot = &candidate;
+        }
+    }
+
+    if (slot != nullptr)
+    {
+        TscClock::calibrate();
+
+        std::strncpy(slot->name, name, NAME_SIZE - 1U);
+        slot->name[NAME_SIZE - 1U] = '\0';
+        slot->warmupEndTicks = TscClock::now() + TscClock::fromNanoseconds(warmupMs * NSEC_PER_MSEC);
+        slot->abortAfterWarmup = abortAfterWarmup;
+        slot->allocations.store(0U, std::memory_order_relaxed);
+        slot->afterWarmup.store(0U, std::memory_order_relaxed);
+        slot->sitesDropped.store(0U, std::memory_order_relaxed);
+        for (size_t idx = 0U; idx < MAX_SITES; idx++)
+        {
+            slot->siteCaller[idx].store(0U, std::memory_order_relaxed);
+            slot->siteCount[idx].store(0U, std::memory_order_relaxed);
+        }
+        slot->used.store(true, std::memory_order_release);
+
+        t_slot = slot;
+        result = true;
+    }
+#else
+    (void)name;
+    (void)warmupMs;
+    (void)abortAfterWarmup;
+#endif
+
+    return result;
+}
+
+void
+AllocationTracker::unregisterThread()
+{
+#if defined(ALLOC_TRACKING)
+    t_slot = nullptr;
+#endif
+}
+
+uint64_t
+AllocationTracker::getAllocationsAfterWarmup()
+{
+    uint64_t total = 0U;
+
+#if defined(ALLOC_TRACKING)
+    for (const ThreadSlot& slot : s_slots)
+    {
+        if (slot.used.load(std::memory_order_acquire) == true)
+        {
+            total += slot.afterWarmup.load(std::memory_order_relaxed);
+        }
+    }
+#endif
+
+    return total;
+}
+
+void
+AllocationTracker::report(std::ostream& out)
+{
+#if defined(ALLOC_TRACKING)
+    out << "Allocation Tracker (heap allocations on RT threads)\n";
+
+    for (const ThreadSlot& slot : s_slots)
+    {
+        if (slot.used.load(std::memory_order_acquire) == false)
+        {
+            continue;
+        }
+
+        uint64_t afterWarmup = slot.afterWarmup.load(std::memory_order_relaxed);
+        std::array<std::pair<uint64_t, uintptr_t>, MAX_SITES> sites = {};
+
+        out << std::format("  {}: {} allocations, {} after warm-up ({})\n",
+                           slot.name, slot.allocations.load(std::memory_order_relaxed), afterWarmup,
+                           (afterWarmup == 0U) ? "OK" : "WARNING");
+
+        for (size_t idx = 0U; idx < MAX_SITES; idx++)
+        {
+            sites[idx] = {slot.siteCount[idx].load(std::memory_order_relaxed),
+                          slot.siteCaller[idx].load(std::memory_order_relaxed)};
+        }
+        std::sort(sites.begin(), sites.end(), std::greater<>());
+
+        for (size_t idx = 0U; (idx < REPORT_TOP_SITES) && (sites[idx].first > 0U); idx++)
+        {
+            out << std::format("    {:>8} x {}\n", sites[idx].first, describeSite(sites[idx].second));
+        }
+
+        if (slot.sitesDropped.load(std::memory_order_relaxed) > 0U)
+        {
+            out << std::format("    {:>8} x (site table full)\n",
+                               slot.sitesDropped.load(std::memory_order_relaxed));
+        }
+    }
+    out << std::flush;
+#else
+    (void)out;
+#endif
+}
+
+#if defined(ALLOC_TRACKING)
+/*******************************************************************************
+ * Allocator Wrappers
+ *
+ * Replacing malloc/calloc/realloc/free in the executable interposes them
+ * for every library (glibc supports this); memalign-family calls are not
+ * counted. operator new is replaced as well so its caller is recorded,
+ * not the malloc call inside libstdc++.
+ ******************************************************************************/
+extern "C"
+{
+
+void*
+malloc(size_t size)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    return __libc_malloc(size);
+}
+
+void*
+calloc(size_t count, size_t size)
+{
+    recordAllocation(count * size, __builtin_return_address(0));
+    return __libc_calloc(count, size);
+}
+
+void*
+realloc(void* ptr, size_t size)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    return __libc_realloc(ptr, size);
+}
+
+void
+free(void* ptr)
+{
+    __libc_free(ptr);
+}
+
+}  // extern "C"
+
+void*
+operator new(std::size_t size)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    void* ptr = __libc_malloc(size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void*
+operator new[](std::size_t size)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    void* ptr = __libc_malloc(size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void*
+operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    recordAllocation(size, __builtin_return_address(0));
+    return __libc_malloc(size);
+}
+
+void*
+operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    recordAllocation(size, __builtin_return_address(0));
+    return __libc_malloc(size);
+}
+
+void*
+operator new(std::size_t size, std::align_val_t alignment)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    void* ptr = __libc_memalign(static_cast<size_t>(alignment), size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void*
+operator new[](std::size_t size, std::align_val_t alignment)
+{
+    recordAllocation(size, __builtin_return_address(0));
+    void* ptr = __libc_memalign(static_cast<size_t>(alignment), size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+#endif  // ALLOC_TRACKING
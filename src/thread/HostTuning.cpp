@@ -0,0 +1,277 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file HostTuning.cpp
+ * @ingroup thread
+ * @brief CPU power-state control and host tuning checks implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/HostTuning.hpp"
+#include "thread/NumaTopology.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr const char* DMA_LATENCY_DEVICE = "/dev/cpu_dma_latency";
+static constexpr const char* SYSFS_CPU_DIR      = "/sys/devices/system/cpu";
+static constexpr const char* PROC_INTERRUPTS    = "/proc/interrupts";
+static constexpr const char* PROC_IRQ_DIR       = "/proc/irq";
+static constexpr const char* EXPECTED_GOVERNOR  = "performance";
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Whether an IRQ description names the given network interface
+ *
+ * Drivers name queue IRQs "<if>", "<if>-TxRx-0", "<if>-rx-1" and so on.
+ */
+static bool
+isDeviceIrq(const std::string& description, const std::string& ifname)
+{
+    bool result = false;
+    std::istringstream tokens(description);
+    std::string token;
+
+    while ((result == false) && (tokens >> token))
+    {
+        result = (token.compare(0U, ifname.size(), ifname) == 0) &&
+                 ((token.size() == ifname.size()) || (token[ifname.size()] == '-'));
+    }
+
+    return result;
+}
+
+static bool
+containsCpu(const std::vector<int>& cpus, int cpu)
+{
+    return std::find(cpus.begin(), cpus.end(), cpu) != cpus.end();
+}
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+
+HostTuning::HostTuning()
+    : m_dmaLatencyFd(-1)
+    , m_dmaLatencyUs(0)
+{
+}
+
+HostTuning::~HostTuning()
+{
+    releaseDmaLatency();
+}
+
+/*******************************************************************************
+ * Public Methods
+ ******************************************************************************/
+
+bool
+HostTuning::holdDmaLatency(int32_t latencyUs)
+{
+    bool result = false;
+
+    releaseDmaLatency();
+
+    int fd = open(DMA_LATENCY_DEVICE, O_WRONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        std::cerr << std::format(
+            "HostTuning: Failed to open {}: {}\n"
+            "Note: May require root privileges\n",
+            DMA_LATENCY_DEVICE, strerror(errno))
+            << std::endl;
+    }
+    /* The binary form (a raw s32) is accepted by every kernel version */
+    else if (write(fd, &latencyUs, sizeof(latencyUs)) != static_cast<ssize_t>(sizeof(latencyUs)))
+    {
+        std::cerr << std::format("HostTuning: Failed to write {}: {}\n",
+                                 DMA_LATENCY_DEVICE, strerror(errno))
+                  << std::endl;
+        close(fd);
+    }
+    else
+    {
+        m_dmaLatencyFd = fd;
+        m_dmaLatencyUs = latencyUs;
+        result = true;
+    }
+
+    return result;
+}
+
+void
+HostTuning::releaseDmaLatency()
+{
+    if (m_dmaLatencyFd >= 0)
+    {
+        close(m_dmaLatencyFd);
+        m_dmaLatencyFd = -1;
+    }
+}
+
+size_t
+HostTuning::checkCores(const std::vector<int>& cores, const std::string& ifname) const
+{
+    size_t findings = 0U;
+    std::vector<int> isolated;
+    std::vector<int> nohzFull;
+    std::vector<IrqInfo> irqs = readIrqs();
+
+    /* Missing or empty files simply mean "no CPU listed" */
+    readCpuListFile(std::format("{}/isolated", SYSFS_CPU_DIR), isolated);
+    readCpuListFile(std::format("{}/nohz_full", SYSFS_CPU_DIR), nohzFull);
+
+    for (int cpu : cores)
+    {
+        if (cpu < 0)
+        {
+            continue;
+        }
+
+        std::string governor = readGovernor(cpu);
+        size_t nicIrqs = 0U;
+        size_t otherIrqs = 0U;
+
+        if (governor.empty() == true)
+        {
+            std::cout << std::format("HostTuning: Core {}: no cpufreq governor (frequency not controlled by the OS)",
+                                     cpu)
+                      << std::endl;
+        }
+        else if (governor != EXPECTED_GOVERNOR)
+        {
+            std::cerr << std::format("HostTuning: Warning: core {} uses governor \"{}\", expected \"{}\"",
+                                     cpu, governor, EXPECTED_GOVERNOR)
+                      << std::endl;
+            findings++;
+        }
+
+        if (containsCpu(isolated, cpu) == false)
+        {
+            std::cerr << std::format("HostTuning: Warning: core {} is not in isolcpus", cpu) << std::endl;
+            findings++;
+        }
+
+        if (containsCpu(nohzFull, cpu) == false)
+        {
+            std::cerr << std::format("HostTuning: Warning: core {} is not in nohz_full", cpu) << std::endl;
+            findings++;
+        }
+
+        for (const IrqInfo& info : irqs)
+        {
+            if (containsCpu(info.cpus, cpu) == true)
+            {
+                if ((ifname.empty() == false) && (isDeviceIrq(info.name, ifname) == true))
+                {
+                    std::cerr << std::format("HostTuning: Warning: IRQ {} ({}) may run on core {}",
+                                             info.irq, ifname, cpu)
+                              << std::endl;
+                    nicIrqs++;
+                }
+                else
+                {
+                    otherIrqs++;
+                }
+            }
+        }
+
+        if (otherIrqs > 0U)
+        {
+            std::cerr << std::format("HostTuning: Warning: {} other IRQs may run on core {}", otherIrqs, cpu)
+                      << std::endl;
+        }
+        findings += nicIrqs + ((otherIrqs > 0U) ? 1U : 0U);
+    }
+
+    return findings;
+}
+
+std::string
+HostTuning::readGovernor(int cpu)
+{
+    std::string governor;
+    std::ifstream file(std::format("{}/cpu{}/cpufreq/scaling_governor", SYSFS_CPU_DIR, cpu));
+
+    if (file.is_open() == true)
+    {
+        std::getline(file, governor);
+    }
+
+    return governor;
+}
+
+/*******************************************************************************
+ * Private Methods
+ ******************************************************************************/
+
+bool
+HostTuning::readCpuListFile(const std::string& path, std::vector<int>& cpus)
+{
+    bool result = false;
+    std::ifstream file(path);
+    std::string line;
+
+    if ((file.is_open() == true) && (std::getline(file, line)) && (line.empty() == false))
+    {
+        result = NumaTopology::parseCpuList(line, cpus);
+    }
+
+    return result;
+}
+
+std::vector<HostTuning::IrqInfo>
+HostTuning::readIrqs()
+{
+    std::vector<IrqInfo> irqs;
+    std::ifstream file(PROC_INTERRUPTS);
+    std::string line;
+
+    /* Numbered lines only: "  24:  1  0  IO-APIC  5-edge  eth0-TxRx-0" (LOC, NMI... are per-CPU) */
+    while (std::getline(file, line))
+    {
+        size_t colon = line.find(':');
+        IrqInfo info{};
+
+        if ((colon != std::string::npos) &&
+            (std::sscanf(line.c_str(), "%d:", &info.irq) == 1))
+        {
+            info.name = line.substr(colon + 1U);
+
+            /* Effective affinity is where the IRQ is actually routed; older kernels lack it */
+            if ((readCpuListFile(std::format("{}/{}/effective_affinity_list", PROC_IRQ_DIR, info.irq),
+                                 info.cpus) == true) ||
+                (readCpuListFile(std::format("{}/{}/smp_affinity_list", PROC_IRQ_DIR, info.irq),
+                                 info.cpus) == true))
+            {
+                irqs.push_back(std::move(info));
+            }
+        }
+    }
+
+    return irqs;
+}
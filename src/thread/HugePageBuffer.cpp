@@ -0,0 +1,285 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file HugePageBuffer.cpp
+ * @ingroup thread
+ * @brief Huge-page backed memory implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/HugePageBuffer.hpp"
+#include "thread/NumaTopology.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstring>
+#include <iostream>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t STANDARD_PAGE_SIZE = 4096U;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+static size_t
+roundUp(size_t value, size_t alignment)
+{
+    return ((value + alignment - 1U) / alignment) * alignment;
+}
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+
+HugePageBuffer::HugePageBuffer()
+    : m_base(nullptr)
+    , m_size(0U)
+    , m_mappedSize(0U)
+    , m_backing(Backing::None)
+    , m_locked(false)
+    , m_numaNode(-1)
+{
+}
+
+HugePageBuffer::~HugePageBuffer()
+{
+    release();
+}
+
+/*******************************************************************************
+ * Public Methods
+ ******************************************************************************/
+
+bool
+HugePageBuffer::allocate(size_t size, bool useHugePages, int numaNode)
+{
+    bool result = false;
+
+    release();
+
+    if (size > 0U)
+    {
+        if (useHugePages == true)
+        {
+            result = mapHugeTlb(size);
+
+            if (result == false)
+            {
+                result = mapTransparent(size);
+            }
+        }
+
+        if (result == false)
+        {
+            result = mapStandard(size);
+        }
+
+        if (result == true)
+        {
+            m_size = size;
+
+            /* Policy must be set before the first touch to take effect */
+            if ((numaNode >= 0) && (NumaTopology::bindMemory(m_base, m_mappedSize, numaNode) == true))
+            {
+                m_numaNode = numaNode;
+            }
+            prefault();
+        }
+        else
+        {
+            std::cerr << std::format(
+                "HugePageBuffer: Failed to map {} bytes: {}\n",
+                size, strerror(errno))
+                << std::endl;
+        }
+    }
+
+    return result;
+}
+
+void
+HugePageBuffer::prefault()
+{
+    volatile uint8_t* bytes = static_cast<volatile uint8_t*>(m_base);
+
+    if (bytes != nullptr)
+    {
+        /* Write (not read) so copy-on-write zero pages are replaced too */
+        for (size_t offset = 0U; offset < m_mappedSize; offset += STANDARD_PAGE_SIZE)
+        {
+            bytes[offset] = 0U;
+        }
+    }
+}
+
+bool
+HugePageBuffer::lock()
+{
+    bool result = false;
+
+    if (m_base == nullptr)
+    {
+        std::cerr << "HugePageBuffer: Nothing to lock" << std::endl;
+    }
+    else if (m_locked == true)
+    {
+        result = true;
+    }
+    else if (mlock(m_base, m_mappedSize) != 0)
+    {
+        std::cerr << std::format(
+            "HugePageBuffer: mlock of {} bytes failed: {}\n"
+            "Note: May require CAP_IPC_LOCK or a larger RLIMIT_MEMLOCK\n",
+            m_mappedSize, strerror(errno))
+            << std::endl;
+    }
+    else
+    {
+        m_locked = true;
+        result = true;
+    }
+
+    return result;
+}
+
+void
+HugePageBuffer::release()
+{
+    if (m_base != nullptr)
+    {
+        if (m_locked == true)
+        {
+            munlock(m_base, m_mappedSize);
+        }
+        munmap(m_base, m_mappedSize);
+    }
+
+    m_base = nullptr;
+    m_size = 0U;
+    m_mappedSize = 0U;
+    m_backing = Backing::None;
+    m_locked = false;
+    m_numaNode = -1;
+}
+
+const char*
+HugePageBuffer::backingName(Backing backing)
+{
+    const char* name = "none";
+
+    switch (backing)
+    {
+        case Backing::HugeTlb:
+            name = "hugetlb 2MiB";
+            break;
+        case Backing::TransparentHugePage:
+            name = "THP 2MiB";
+            break;
+        case Backing::StandardPage:
+            name = "4KiB pages";
+            break;
+        default:
+            break;
+    }
+
+    return name;
+}
+
+/*******************************************************************************
+ * Private Methods
+ ******************************************************************************/
+
+bool
+HugePageBuffer::mapHugeTlb(size_t size)
+{
+    bool result = false;
+    size_t mapSize = roundUp(size, HUGE_PAGE_SIZE);
+    void* addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if (addr != MAP_FAILED)
+    {
+        m_base = addr;
+        m_mappedSize = mapSize;
+        m_backing = Backing::HugeTlb;
+        result = true;
+    }
+
+    return result;
+}
+
+bool
+HugePageBuffer::mapTransparent(size_t size)
+{
+    bool result = false;
+    size_t mapSize = roundUp(size, HUGE_PAGE_SIZE);
+
+    /* Over-map by one huge page so the region can be trimmed to 2 MiB alignment */
+    size_t rawSize = mapSize + HUGE_PAGE_SIZE;
+    void* raw = mmap(nullptr, rawSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (raw != MAP_FAILED)
+    {
+        uintptr_t rawAddr = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t alignedAddr = roundUp(rawAddr, HUGE_PAGE_SIZE);
+        size_t head = alignedAddr - rawAddr;
+        size_t tail = rawSize - head - mapSize;
+
+        if (head > 0U)
+        {
+            munmap(raw, head);
+        }
+        if (tail > 0U)
+        {
+            munmap(reinterpret_cast<void*>(alignedAddr + mapSize), tail);
+        }
+
+        m_base = reinterpret_cast<void*>(alignedAddr);
+        m_mappedSize = mapSize;
+
+        if (madvise(m_base, m_mappedSize, MADV_HUGEPAGE) == 0)
+        {
+            m_backing = Backing::TransparentHugePage;
+        }
+        else
+        {
+            /* THP disabled in kernel - the aligned mapping is still usable */
+            m_backing = Backing::StandardPage;
+        }
+        result = true;
+    }
+
+    return result;
+}
+
+bool
+HugePageBuffer::mapStandard(size_t size)
+{
+    bool result = false;
+    size_t mapSize = roundUp(size, STANDARD_PAGE_SIZE);
+    void* addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (addr != MAP_FAILED)
+    {
+        m_base = addr;
+        m_mappedSize = mapSize;
+        m_backing = Backing::StandardPage;
+        result = true;
+    }
+
+    return result;
+}
@@ -0,0 +1,219 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file NumaTopology.cpp
+ * @ingroup thread
+ * @brief NUMA topology discovery implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/NumaTopology.hpp"
+
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr const char* SYSFS_NODE_DIR = "/sys/devices/system/node";
+static constexpr const char* SYSFS_NET_DIR  = "/sys/class/net";
+static constexpr size_t      BITS_PER_WORD  = sizeof(unsigned long) * 8U;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Read the first line of a sysfs attribute
+ */
+static bool
+readSysfsLine(const std::string& path, std::string& line)
+{
+    bool result = false;
+    std::ifstream file(path);
+
+    if (file.is_open() == true)
+    {
+        if (std::getline(file, line))
+        {
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Parse a decimal integer covering the whole token
+ */
+static bool
+parseInt(const std::string& token, int& value)
+{
+    const char* first = token.data();
+    const char* last = token.data() + token.size();
+    auto [ptr, ec] = std::from_chars(first, last, value);
+
+    return (ec == std::errc()) && (ptr == last) && (token.empty() == false);
+}
+
+/*******************************************************************************
+ * Constructor
+ ******************************************************************************/
+
+NumaTopology::NumaTopology()
+    : m_nodeCount(0)
+{
+}
+
+/*******************************************************************************
+ * Public Methods
+ ******************************************************************************/
+
+bool
+NumaTopology::initialize()
+{
+    std::string onlineList;
+    std::vector<int> nodes;
+
+    m_cpuToNode.clear();
+    m_nodeCount = 0;
+
+    if ((readSysfsLine(std::format("{}/online", SYSFS_NODE_DIR), onlineList) == true) &&
+        (parseCpuList(onlineList, nodes) == true))
+    {
+        for (int node : nodes)
+        {
+            std::string cpuList;
+            std::vector<int> cpus;
+
+            if ((node < MAX_NODES) &&
+                (readSysfsLine(std::format("{}/node{}/cpulist", SYSFS_NODE_DIR, node), cpuList) == true) &&
+                (parseCpuList(cpuList, cpus) == true))
+            {
+                for (int cpu : cpus)
+                {
+                    if (static_cast<size_t>(cpu) >= m_cpuToNode.size())
+                    {
+                        m_cpuToNode.resize(static_cast<size_t>(cpu) + 1U, -1);
+                    }
+                    m_cpuToNode[static_cast<size_t>(cpu)] = node;
+                }
+                m_nodeCount++;
+            }
+        }
+    }
+
+    return m_nodeCount > 0;
+}
+
+int
+NumaTopology::getNodeOfCpu(int cpu) const
+{
+    int node = -1;
+
+    if ((cpu >= 0) && (static_cast<size_t>(cpu) < m_cpuToNode.size()))
+    {
+        node = m_cpuToNode[static_cast<size_t>(cpu)];
+    }
+
+    return node;
+}
+
+int
+NumaTopology::getNodeOfNetDevice(const std::string& ifname)
+{
+    int node = -1;
+    std::string text;
+
+    /* Virtual devices (lo, veth, bridges) have no "device" link */
+    if ((ifname.empty() == false) &&
+        (readSysfsLine(std::format("{}/{}/device/numa_node", SYSFS_NET_DIR, ifname), text) == true))
+    {
+        if (parseInt(text, node) == false)
+        {
+            node = -1;
+        }
+    }
+
+    return node;
+}
+
+bool
+NumaTopology::parseCpuList(const std::string& list, std::vector<int>& cpus)
+{
+    bool result = true;
+    size_t start = 0U;
+
+    do
+    {
+        size_t comma = list.find(',', start);
+        std::string token = list.substr(start, (comma == std::string::npos) ? std::string::npos : comma - start);
+        size_t dash = token.find('-');
+        int first = 0;
+        int last = 0;
+
+        if (dash == std::string::npos)
+        {
+            result = parseInt(token, first);
+            last = first;
+        }
+        else
+        {
+            result = (parseInt(token.substr(0U, dash), first) == true) &&
+                     (parseInt(token.substr(dash + 1U), last) == true) &&
+                     (first <= last);
+        }
+
+        for (int cpu = first; (result == true) && (cpu <= last); cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+
+        start = (comma == std::string::npos) ? list.size() : comma + 1U;
+    }
+    while ((result == true) && (start < list.size()));
+
+    return result;
+}
+
+bool
+NumaTopology::bindMemory(void* addr, size_t length, int node)
+{
+    bool result = false;
+    unsigned long nodeMask[MAX_NODES / BITS_PER_WORD] = {0};
+
+    if ((node >= 0) && (node < MAX_NODES))
+    {
+        nodeMask[static_cast<size_t>(node) / BITS_PER_WORD] = 1UL << (static_cast<size_t>(node) % BITS_PER_WORD);
+
+        if (syscall(SYS_mbind, addr, length, MPOL_PREFERRED, nodeMask,
+                    static_cast<unsigned long>(MAX_NODES) + 1UL, 0U) == 0)
+        {
+            result = true;
+        }
+        else
+        {
+            std::cerr << std::format(
+                "NumaTopology: mbind to node {} failed: {}\n",
+                node, strerror(errno))
+                << std::endl;
+        }
+    }
+
+    return result;
+}
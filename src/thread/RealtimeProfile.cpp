@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file RealtimeProfile.cpp
+ * @ingroup thread
+ * @brief Low-latency hardening implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/RealtimeProfile.hpp"
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <malloc.h>
+#include <limits.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr size_t GUARD_PAGE_SIZE = 4096U;
+static constexpr uint64_t NSEC_PER_MSEC = 1'000'000ULL;
+
+/*******************************************************************************
+ * RealtimeProfile
+ ******************************************************************************/
+
+bool
+RealtimeProfile::lockAllMemory()
+{
+    bool result = true;
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        std::cerr << std::format(
+            "RealtimeProfile: mlockall failed: {}\n"
+            "Note: May require CAP_IPC_LOCK or a larger RLIMIT_MEMLOCK\n",
+            strerror(errno))
+            << std::endl;
+        result = false;
+    }
+
+    return result;
+}
+
+bool
+RealtimeProfile::disableMallocTrim()
+{
+    /* mallopt() returns 1 on success */
+    bool result = (mallopt(M_TRIM_THRESHOLD, -1) == 1) &&
+                  (mallopt(M_MMAP_MAX, 0) == 1);
+
+    if (result == false)
+    {
+        std::cerr << "RealtimeProfile: mallopt failed, heap trimming stays enabled" << std::endl;
+    }
+
+    return result;
+}
+
+void
+RealtimeProfile::reserveHeap(size_t size)
+{
+    if (size > 0U)
+    {
+        volatile uint8_t* block = static_cast<volatile uint8_t*>(std::malloc(size));
+
+        if (block != nullptr)
+        {
+            for (size_t offset = 0U; offset < size; offset += GUARD_PAGE_SIZE)
+            {
+                block[offset] = 0U;
+            }
+            /* With trimming disabled the pages stay in the heap for later allocations */
+            std::free(const_cast<uint8_t*>(block));
+        }
+    }
+}
+
+bool
+RealtimeProfile::allocateStack(HugePageBuffer& stack, size_t size, int numaNode)
+{
+    bool result = false;
+    size_t usable = std::max(size, static_cast<size_t>(PTHREAD_STACK_MIN));
+
+    /* 4 KiB pages: a guard page cannot be carved out of a huge page */
+    if (stack.allocate(usable + GUARD_PAGE_SIZE, false, numaNode) == false)
+    {
+        std::cerr << "RealtimeProfile: Failed to allocate thread stack" << std::endl;
+    }
+    else if (mprotect(stack.data(), GUARD_PAGE_SIZE, PROT_NONE) != 0)
+    {
+        std::cerr << std::format(
+            "RealtimeProfile: Failed to protect stack guard page: {}\n",
+            strerror(errno))
+            << std::endl;
+        stack.release();
+    }
+    else
+    {
+        result = true;
+    }
+
+    return result;
+}
+
+bool
+RealtimeProfile::setStack(pthread_attr_t& attr, const HugePageBuffer& stack)
+{
+    bool result = false;
+    uint8_t* base = static_cast<uint8_t*>(stack.data());
+
+    if (base != nullptr)
+    {
+        /* Stack grows down towards the guard page at the bottom of the mapping */
+        result = (pthread_attr_setstack(&attr, base + GUARD_PAGE_SIZE,
+                                        stack.mappedSize() - GUARD_PAGE_SIZE) == 0);
+    }
+
+    return result;
+}
+
+RealtimeProfile::FaultCounters
+RealtimeProfile::getThreadFaults()
+{
+    FaultCounters counters = {};
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_THREAD, &usage) == 0)
+    {
+        counters.minor = static_cast<uint64_t>(usage.ru_minflt);
+        counters.major = static_cast<uint64_t>(usage.ru_majflt);
+    }
+
+    return counters;
+}
+
+/*******************************************************************************
+ * FaultMonitor
+ ******************************************************************************/
+
+FaultMonitor::FaultMonitor()
+    : m_enabled(false)
+    , m_armed(false)
+    , m_warmupEndTicks(0U)
+    , m_baseline{}
+    , m_faults{}
+{
+}
+
+void
+FaultMonitor::begin(uint32_t warmupMs)
+{
+    m_enabled = true;
+    m_armed = false;
+    m_faults = {};
+    m_warmupEndTicks = TscClock::now() + TscClock::fromNanoseconds(warmupMs * NSEC_PER_MSEC);
+}
+
+void
+FaultMonitor::arm()
+{
+    m_baseline = RealtimeProfile::getThreadFaults();
+    m_armed = true;
+}
+
+void
+FaultMonitor::finish()
+{
+    if (m_armed == true)
+    {
+        RealtimeProfile::FaultCounters now = RealtimeProfile::getThreadFaults();
+        m_faults.minor = now.minor - m_baseline.minor;
+        m_faults.major = now.major - m_baseline.major;
+    }
+}
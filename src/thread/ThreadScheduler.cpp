@@ -0,0 +1,271 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ThreadScheduler.cpp
+ * @ingroup thread
+ * @brief CPU affinity and scheduling policy helpers implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/ThreadScheduler.hpp"
+
+#include <sched.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+
+#ifndef SCHED_FLAG_DL_OVERRUN
+#define SCHED_FLAG_DL_OVERRUN 0x04
+#endif
+
+/*******************************************************************************
+ * Type Definition
+ ******************************************************************************/
+
+/**
+ * @brief Kernel struct sched_attr (include/uapi/linux/sched/types.h)
+ *
+ * Declared locally: older glibc has no wrapper or definition, newer glibc
+ * defines struct sched_attr itself.
+ */
+struct SchedAttr
+{
+    uint32_t size;
+    uint32_t schedPolicy;
+    uint64_t schedFlags;
+    int32_t  schedNice;
+    uint32_t schedPriority;
+    uint64_t schedRuntime;
+    uint64_t schedDeadline;
+    uint64_t schedPeriod;
+};
+
+/*******************************************************************************
+ * Static Variable
+ ******************************************************************************/
+static std::atomic<uint64_t> s_overrunCount{0U};
+static std::atomic<bool> s_overrunHandlerInstalled{false};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "signal handler needs a lock-free counter");
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+static void
+overrunSignalHandler(int)
+{
+    s_overrunCount.fetch_add(1U, std::memory_order_relaxed);
+}
+
+static int
+toKernelPolicy(SchedPolicy policy)
+{
+    int kernelPolicy = SCHED_OTHER;
+
+    switch (policy)
+    {
+        case SchedPolicy::Fifo:       kernelPolicy = SCHED_FIFO;     break;
+        case SchedPolicy::RoundRobin: kernelPolicy = SCHED_RR;       break;
+        case SchedPolicy::Deadline:   kernelPolicy = SCHED_DEADLINE; break;
+        case SchedPolicy::Other:      kernelPolicy = SCHED_OTHER;    break;
+    }
+
+    return kernelPolicy;
+}
+
+static bool
+setDeadline(pid_t tid, const SchedSettings& settings)
+{
+    bool result = false;
+    SchedAttr attr = {};
+
+    attr.size = sizeof(attr);
+    attr.schedPolicy = SCHED_DEADLINE;
+    attr.schedFlags = (settings.overrunSignal == true) ? SCHED_FLAG_DL_OVERRUN : 0U;
+    attr.schedRuntime = settings.runtimeNs;
+    attr.schedDeadline = settings.deadlineNs;
+    attr.schedPeriod = settings.periodNs;
+
+    if (tid <= 0)
+    {
+        errno = ESRCH;
+    }
+    else if (syscall(SYS_sched_setattr, tid, &attr, 0U) == 0)
+    {
+        result = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Public Function
+ ******************************************************************************/
+
+bool
+ThreadScheduler::setAffinity(pthread_t thread, int cpuCore)
+{
+    bool result = false;
+    cpu_set_t cpuset;
+
+    CPU_ZERO(&cpuset);
+
+    if ((cpuCore < 0) || (cpuCore >= CPU_SETSIZE))
+    {
+        errno = EINVAL;
+    }
+    else
+    {
+        CPU_SET(cpuCore, &cpuset);
+
+        int rc = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset);
+        if (rc == 0)
+        {
+            result = true;
+        }
+        else
+        {
+            errno = rc;
+        }
+    }
+
+    return result;
+}
+
+bool
+ThreadScheduler::setScheduling(pthread_t thread, pid_t tid, const SchedSettings& settings)
+{
+    bool result = false;
+
+    if (settings.policy == SchedPolicy::Deadline)
+    {
+        result = setDeadline(tid, settings);
+    }
+    else
+    {
+        struct sched_param param = {};
+        param.sched_priority = (settings.policy == SchedPolicy::Other) ? 0 : settings.priority;
+
+        int rc = pthread_setschedparam(thread, toKernelPolicy(settings.policy), &param);
+        if (rc == 0)
+        {
+            result = true;
+        }
+        else
+        {
+            errno = rc;
+        }
+    }
+
+    return result;
+}
+
+bool
+ThreadScheduler::installOverrunHandler()
+{
+    bool result = true;
+
+    if (s_overrunHandlerInstalled.load(std::memory_order_acquire) == false)
+    {
+        struct sigaction action = {};
+        action.sa_handler = overrunSignalHandler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+
+        result = (sigaction(SIGXCPU, &action, nullptr) == 0);
+        s_overrunHandlerInstalled.store(result, std::memory_order_release);
+    }
+
+    return result;
+}
+
+uint64_t
+ThreadScheduler::getOverrunCount()
+{
+    return s_overrunCount.load(std::memory_order_relaxed);
+}
+
+std::string
+ThreadScheduler::describe(pid_t tid)
+{
+    std::string text = "unknown";
+    struct sched_param param = {};
+    int policy = (tid > 0) ? sched_getscheduler(tid) : -1;
+
+    if ((policy >= 0) && (sched_getparam(tid, &param) == 0))
+    {
+        switch (policy)
+        {
+            case SCHED_FIFO:     text = std::format("SCHED_FIFO/{}", param.sched_priority); break;
+            case SCHED_RR:       text = std::format("SCHED_RR/{}", param.sched_priority);   break;
+            case SCHED_DEADLINE: text = "SCHED_DEADLINE";                                  break;
+            default:             text = "SCHED_OTHER";                                     break;
+        }
+    }
+
+    return text;
+}
+
+bool
+ThreadScheduler::parsePolicy(const std::string& name, SchedPolicy& policy)
+{
+    bool result = true;
+
+    if (name == "fifo")
+    {
+        policy = SchedPolicy::Fifo;
+    }
+    else if (name == "rr")
+    {
+        policy = SchedPolicy::RoundRobin;
+    }
+    else if (name == "deadline")
+    {
+        policy = SchedPolicy::Deadline;
+    }
+    else if (name == "other")
+    {
+        policy = SchedPolicy::Other;
+    }
+    else
+    {
+        result = false;
+    }
+
+    return result;
+}
+
+const char*
+ThreadScheduler::policyName(SchedPolicy policy)
+{
+    const char* name = "SCHED_OTHER";
+
+    switch (policy)
+    {
+        case SchedPolicy::Fifo:       name = "SCHED_FIFO";     break;
+        case SchedPolicy::RoundRobin: name = "SCHED_RR";       break;
+        case SchedPolicy::Deadline:   name = "SCHED_DEADLINE"; break;
+        case SchedPolicy::Other:      name = "SCHED_OTHER";    break;
+    }
+
+    return name;
+}
@@ -0,0 +1,178 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file ThreadTelemetry.cpp
+ * @ingroup thread
+ * @brief Per-thread OS telemetry implementation
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "thread/ThreadTelemetry.hpp"
+
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <format>
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint64_t NSEC_PER_SEC  = 1'000'000'000ULL;
+static constexpr double   NSEC_PER_MSEC = 1'000'000.0;
+
+/* Field positions in /proc/<pid>/task/<tid>/stat, counted from 1 (see proc(5)) */
+static constexpr int STAT_FIELD_MINFLT    = 10;
+static constexpr int STAT_FIELD_MAJFLT    = 12;
+static constexpr int STAT_FIELD_UTIME     = 14;
+static constexpr int STAT_FIELD_STIME     = 15;
+static constexpr int STAT_FIELD_PROCESSOR = 39;
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Parse the stat line: faults, CPU ticks and last CPU
+ *
+ * The command name (field 2) may contain spaces, so parsing starts after
+ * its closing parenthesis, at field 3.
+ */
+static bool
+parseStat(const std::string& line, ThreadTelemetry::Sample& sample, uint64_t& cpuTicks)
+{
+    bool result = false;
+    size_t paren = line.rfind(')');
+
+    if (paren != std::string::npos)
+    {
+        std::istringstream fields(line.substr(paren + 1U));
+        std::string field;
+        int index = 3;
+
+        cpuTicks = 0U;
+
+        while ((fields >> field) && (index <= STAT_FIELD_PROCESSOR))
+        {
+            switch (index)
+            {
+            case STAT_FIELD_MINFLT: sample.minorFaults = std::stoull(field); break;
+            case STAT_FIELD_MAJFLT: sample.majorFaults = std::stoull(field); break;
+            case STAT_FIELD_UTIME:
+            case STAT_FIELD_STIME:  cpuTicks += std::stoull(field); break;
+            case STAT_FIELD_PROCESSOR:
+                sample.lastCpu = std::stoi(field);
+                result = true;
+                break;
+            default: break;
+            }
+            index++;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Read the context switch counters from the status file
+ */
+static void
+parseStatus(std::ifstream& file, ThreadTelemetry::Sample& sample)
+{
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string key;
+        uint64_t value = 0U;
+
+        if (fields >> key >> value)
+        {
+            if (key == "voluntary_ctxt_switches:")
+            {
+                sample.voluntarySwitches = value;
+            }
+            else if (key == "nonvoluntary_ctxt_switches:")
+            {
+                sample.involuntarySwitches = value;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ * Public Methods
+ ******************************************************************************/
+
+bool
+ThreadTelemetry::sample(pid_t tid, Sample& sample)
+{
+    std::string taskDir = std::format("/proc/self/task/{}", tid);
+    std::ifstream statFile(taskDir + "/stat");
+    std::string line;
+    uint64_t cpuTicks = 0U;
+
+    sample = Sample{};
+    sample.lastCpu = -1;
+
+    if ((tid > 0) && (statFile.is_open() == true) && (std::getline(statFile, line)) &&
+        (parseStat(line, sample, cpuTicks) == true))
+    {
+        std::ifstream statusFile(taskDir + "/status");
+        std::ifstream schedstatFile(taskDir + "/schedstat");
+        uint64_t runNs = 0U;
+
+        parseStatus(statusFile, sample);
+
+        /* schedstat: "<ns on CPU> <ns waiting on a run queue> <timeslices>" */
+        if (schedstatFile >> runNs >> sample.runQueueWaitNs >> sample.timeslices)
+        {
+            sample.cpuTimeNs = runNs;
+        }
+        else
+        {
+            /* Kernels without CONFIG_SCHEDSTATS: clock-tick resolution, no run-queue wait */
+            sample.cpuTimeNs = cpuTicks * (NSEC_PER_SEC / static_cast<uint64_t>(sysconf(_SC_CLK_TCK)));
+        }
+
+        sample.valid = true;
+    }
+
+    return sample.valid;
+}
+
+std::string
+ThreadTelemetry::Sample::header()
+{
+    return std::format("  {:<12}{:>10} {:>10} {:>9} {:>9} {:>12} {:>10} {:>5}",
+                       "Thread", "csw vol", "csw invol", "flt min", "flt maj", "rq wait ms", "cpu ms", "cpu");
+}
+
+std::string
+ThreadTelemetry::Sample::toString(const std::string& name) const
+{
+    std::string text;
+
+    if (valid == false)
+    {
+        text = std::format("  {:<12}{:>10} {:>10} {:>9} {:>9} {:>12} {:>10} {:>5}",
+                           name, "-", "-", "-", "-", "-", "-", "-");
+    }
+    else
+    {
+        text = std::format("  {:<12}{:>10} {:>10} {:>9} {:>9} {:>12.3f} {:>10.1f} {:>5}",
+                           name, voluntarySwitches, involuntarySwitches, minorFaults, majorFaults,
+                           static_cast<double>(runQueueWaitNs) / NSEC_PER_MSEC,
+                           static_cast<double>(cpuTimeNs) / NSEC_PER_MSEC, lastCpu);
+    }
+
+    return text;
+}
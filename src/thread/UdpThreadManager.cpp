@@ -25,6 +25,18 @@
 #include <cstring>
 #include <iostream>
 #include <format>
+#include <algorithm>
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+static const char*
+txLaneName(size_t lane)
+{
+    static constexpr const char* NAMES[UdpThreadManager::TX_LANE_COUNT] = {"Control", "Bulk"};
+
+    return (lane < UdpThreadManager::TX_LANE_COUNT) ? NAMES[lane] : "?";
+}
 
 /*******************************************************************************
  * Constructor/Destructor
@@ -33,17 +45,25 @@
 UdpThreadManager::UdpThreadManager()
     : m_rxThread(0)
     , m_txThread(0)
+    , m_allMemoryLocked(false)
+    , m_rxTid(0)
+    , m_txTid(0)
+    , m_txDeadlinePacing(false)
+    , m_rxExitTelemetry{}
+    , m_txExitTelemetry{}
+    , m_hostTuningFindings(0U)
+    , m_rxWorkers{}
+    , m_rxWorkerCount(0U)
     , m_running(false)
     , m_udpNode(nullptr)
     , m_config{}
     , m_rxCallback(nullptr)
+    , m_rxBatchCallback(nullptr)
     , m_error(Error::None)
-    , m_rxPacketCount(0)
-    , m_txPacketCount(0)
-    , m_rxDropCount(0)
-    , m_txDropCount(0)
-    , m_lastRxTime(std::chrono::steady_clock::now())
-    , m_firstRxPacket(true)
+    , m_rxHot{}
+    , m_txHot{}
+    , m_txProducer{}
+    , m_txCoalesce{}
 {
 }
 
@@ -70,46 +90,108 @@ UdpThreadManager::start(UdpNode& udpNode, const Config& config)
         m_udpNode = &udpNode;
         m_config = config;
         m_error = Error::None;
+        m_txHot.laneCursor = 0U;
+        m_txHot.laneCredit = 0U;
+        m_rxHot.firstRxPacket = true;
+        m_txCoalesce.length = 0U;
+        m_txCoalesce.packets = 0U;
+        m_txCoalesce.mtu = std::min(m_config.txCoalesceMtu, PACKET_MAX_SIZE);
+        m_txCoalesce.maxPackets = std::clamp(m_config.txCoalesceMaxPackets, static_cast<size_t>(1U),
+                                             TX_COALESCE_MAX_PACKETS);
+        m_txHot.coalescePending.store(false, std::memory_order_relaxed);
         
+        if ((m_config.queueTimestamps == true) || (m_config.txDirectSend == true) ||
+            (m_config.txCoalesceMtu > 0U) ||
+            (m_config.lowLatencyProfile == true) || (m_config.txDeadlineRuntimeNs > 0U) ||
+            (m_config.txRatePps > 0U) || (m_config.txRateBytesPerSec > 0U))
+        {
+            TscClock::calibrate();
+        }
+
+        /* Burst must fit the largest packet, or such a packet would never be admitted */
+        m_txHot.shaper.configure(m_config.txRatePps, m_config.txRateBytesPerSec, m_config.txBurstPackets,
+                             std::max(m_config.txBurstBytes, static_cast<uint32_t>(PACKET_MAX_SIZE)));
+
+        if (m_config.numaAware == true)
+        {
+            m_numa.initialize();
+            checkNicLocality();
+        }
+
+        // Allocate rings and statistics on huge pages before any RT thread exists
+        if (allocateBuffers() == false)
+        {
+            m_error = Error::AllocateFail;
+        }
         // Configure socket buffers
-        if (configureSocketBuffers() == false)
+        else if (configureSocketBuffers() == false)
         {
             m_error = Error::SetSocketBufferFail;
         }
         else
         {
+            if (m_config.lowLatencyProfile == true)
+            {
+                applyLowLatencyProfile();
+            }
+
+            applyHostTuning();
+
+            m_rxFaults = FaultMonitor();
+            m_txFaults = FaultMonitor();
             m_running.store(true, std::memory_order_release);
             
+            // Create RX workers first so the RX queues are drained from the first packet
+            if (startRxWorkers() == false)
+            {
+                m_error = Error::ThreadCreateFail;
+                m_running.store(false, std::memory_order_release);
+                stopRxWorkers();
+            }
             // Create RX thread
-            if (pthread_create(&m_rxThread, nullptr, rxThreadEntry, this) != 0)
+            else if (createThread(m_rxThread, rxThreadEntry, this, m_rxStack) == false)
             {
                 std::cerr << "UdpThreadManager: Failed to create RX thread: " 
                           << strerror(errno) << std::endl;
                 m_error = Error::ThreadCreateFail;
                 m_running.store(false, std::memory_order_release);
+                stopRxWorkers();
             }
             else
             {
                 // Create TX thread
-                if (pthread_create(&m_txThread, nullptr, txThreadEntry, this) != 0)
+                if (createThread(m_txThread, txThreadEntry, this, m_txStack) == false)
                 {
                     std::cerr << "UdpThreadManager: Failed to create TX thread: " 
                               << strerror(errno) << std::endl;
                     m_error = Error::ThreadCreateFail;
                     m_running.store(false, std::memory_order_release);
                     pthread_join(m_rxThread, nullptr);
+                    stopRxWorkers();
                 }
                 else
                 {
                     // Configure RX thread
-                    if (configureThread(m_rxThread, config.rxCpuCore, config.rxPriority, config.useRealtimeScheduling) == false)
+                    SchedSettings rxSettings = {};
+                    rxSettings.policy = config.rtPolicy;
+                    rxSettings.priority = config.rxPriority;
+
+                    if (configureThread(m_rxThread, 0, config.rxCpuCore, rxSettings, config.useRealtimeScheduling) == false)
                     {
                         std::cerr << "UdpThreadManager: Failed to configure RX thread" << std::endl;
                         // Continue anyway - not fatal
                     }
                     
-                    // Configure TX thread
-                    if (configureThread(m_txThread, config.txCpuCore, config.txPriority, config.useRealtimeScheduling) == false)
+                    SchedSettings txSettings = {};
+                    txSettings.policy = config.rtPolicy;
+                    txSettings.priority = config.txPriority;
+
+                    // Configure TX thread (a deadline TX thread configures itself)
+                    if (config.txDeadlineRuntimeNs > 0U)
+                    {
+                        /* applyTxDeadline() runs on the TX thread */
+                    }
+                    else if (configureThread(m_txThread, 0, config.txCpuCore, txSettings, config.useRealtimeScheduling) == false)
                     {
                         std::cerr << "UdpThreadManager: Failed to configure TX thread" << std::endl;
                         // Continue anyway - not fatal
@@ -117,12 +199,67 @@ UdpThreadManager::start(UdpNode& udpNode, const Config& config)
                     
                     std::cout << std::format(
                         "UdpThreadManager: Started\n"
-                        "  RX: CPU core {}, priority {} {}\n"
-                        "  TX: CPU core {}, priority {} {}\n"
-                        "  RX buffer: {} bytes, TX buffer: {} bytes\n",
-                        config.rxCpuCore, config.rxPriority, config.useRealtimeScheduling ? "(SCHED_FIFO)" : "",
-                        config.txCpuCore, config.txPriority, config.useRealtimeScheduling ? "(SCHED_FIFO)" : "",
-                        config.rxBufferSize, config.txBufferSize)
+                        "  RX: CPU core {}, priority {} ({})\n"
+                        "  TX: {}\n"
+                        "  RX buffer: {} bytes, TX buffer: {} bytes\n"
+                        "  RX delivery: {} ({} workers, batch {})\n"
+                        "  TX lanes: {}, batch {}, direct send {}\n"
+                        "  TX shaper: {}\n"
+                        "  TX coalescing: {}, RX unpacking {}\n"
+                        "  Rings: {}, stats: {}{}\n"
+                        "  NUMA node: RX ring {}, TX ring {}, RX stats {}, TX stats {}\n"
+                        "  Queue timestamps: {}\n"
+                        "  Low-latency profile: {}\n"
+                        "  CPU DMA latency: {}, host tuning: {}\n",
+                        config.rxCpuCore, config.rxPriority,
+                        (config.useRealtimeScheduling == true) ? ThreadScheduler::policyName(config.rtPolicy) : "SCHED_OTHER",
+                        (config.txDeadlineRuntimeNs > 0U) ?
+                            std::format("SCHED_DEADLINE runtime {} us / deadline {} us / period {} us (unpinned)",
+                                        config.txDeadlineRuntimeNs / 1000U, config.txDeadlineNs / 1000U,
+                                        config.txDeadlinePeriodNs / 1000U) :
+                            std::format("CPU core {}, priority {} ({})", config.txCpuCore, config.txPriority,
+                                        (config.useRealtimeScheduling == true) ?
+                                            ThreadScheduler::policyName(config.rtPolicy) : "SCHED_OTHER"),
+                        config.rxBufferSize, config.txBufferSize,
+                        (m_rxWorkerCount > 0U) ? "worker pool" : "inline",
+                        m_rxWorkerCount, config.rxWorkerBatchSize,
+                        (config.txScheduling == TxScheduling::Weighted) ?
+                            std::format("weighted {}:{} (control:bulk)",
+                                        config.txLaneWeights[0], config.txLaneWeights[1]) :
+                            std::string("strict priority (control > bulk)"),
+                        config.txBatchSize, (config.txDirectSend == true) ? "on" : "off",
+                        (m_txHot.shaper.isEnabled() == true) ?
+                            std::format("{} pps, {} bytes/s, burst {} packets / {} bytes",
+                                        config.txRatePps, config.txRateBytesPerSec,
+                                        config.txBurstPackets, config.txBurstBytes) :
+                            std::string("off"),
+                        (m_txCoalesce.mtu > 0U) ?
+                            std::format("up to {} bytes / {} packets / {} us", m_txCoalesce.mtu,
+                                        m_txCoalesce.maxPackets, config.txCoalesceDeadlineUs) :
+                            std::string("off"),
+                        (config.rxFrameSplitter != nullptr) ? "on" : "off",
+                        HugePageBuffer::backingName(m_txQueues[0].buffer().getBacking()),
+                        HugePageBuffer::backingName(m_rxLatencyStats.buffer().getBacking()),
+                        (m_txQueues[0].buffer().isLocked() == true) ? " (mlocked)" : "",
+                        m_rxQueues[0].buffer().getNumaNode(), m_txQueues[0].buffer().getNumaNode(),
+                        m_rxLatencyStats.buffer().getNumaNode(), m_txLatencyStats.buffer().getNumaNode(),
+                        (config.queueTimestamps == false) ? std::string("off") :
+                        (TscClock::isTscActive() == true) ?
+                            std::format("TSC ({} MHz)", TscClock::getFrequencyHz() / 1000000U) :
+                            std::string("steady_clock"),
+                        (config.lowLatencyProfile == false) ? std::string("off") :
+                            std::format("mlockall {}, stack {} KiB, heap reserve {} KiB, fault warm-up {} ms",
+                                        (m_allMemoryLocked == true) ? "on" : "FAILED",
+                                        ((config.threadStackSize > 0U) ? config.threadStackSize :
+                                            RealtimeProfile::DEFAULT_STACK_SIZE) / 1024U,
+                                        config.heapReserveSize / 1024U,
+                                        config.faultWarmupMs),
+                        (config.holdCpuDmaLatency == false) ? std::string("not held") :
+                        (m_hostTuning.isDmaLatencyHeld() == true) ?
+                            std::format("held at {} us", m_hostTuning.getDmaLatencyUs()) :
+                            std::string("FAILED"),
+                        (config.checkHostTuning == false) ? std::string("not checked") :
+                            std::format("{} findings", m_hostTuningFindings))
                         << std::endl;
                     
                     result = true;
@@ -157,22 +294,183 @@ UdpThreadManager::stop()
         m_txThread = 0;
     }
     
+    // Workers drain what the (now stopped) RX thread queued, then exit
+    stopRxWorkers();
+
+    // Deep C-states are fine again once no RT thread is running
+    m_hostTuning.releaseDmaLatency();
+    
+    RingOverflowStats rxOverflow = getRxOverflowStats();
+    size_t workerCount = 0U;
+
+    if (m_config.rxDeliveryMode == RxDeliveryMode::WorkerPool)
+    {
+        workerCount = std::clamp(m_config.rxWorkerCount, static_cast<size_t>(1U), RX_WORKER_MAX);
+    }
+
+    RxCounters rxCounters = getRxCounters();
+    TxCounters txCounters = getTxCounters();
+
     std::cout << std::format(
         "UdpThreadManager: Stopped\n"
         "  RX packets: {}, dropped: {}\n"
-        "  TX packets: {}, dropped: {}\n",
-        m_rxPacketCount.load(), m_rxDropCount.load(),
-        m_txPacketCount.load(), m_txDropCount.load())
+        "  TX packets: {}, dropped: {}\n"
+        "  RX queue overflow: newest dropped {}, oldest dropped {}, blocked {}, timeouts {}\n"
+        "  RX queue high-water mark: {}/{}",
+        rxCounters.packets, rxCounters.drops,
+        txCounters.packets, txCounters.drops,
+        rxOverflow.droppedNewest, rxOverflow.droppedOldest, rxOverflow.blocked, rxOverflow.blockTimeouts,
+        getRxQueueHighWaterMark(), getQueueCapacity())
         << std::endl;
 
+    std::cout << std::format("  TX shaped packets: {}, direct sent: {}, direct fell back: {}",
+                             txCounters.shaped, txCounters.direct, txCounters.directFallback)
+              << std::endl;
+
+    if (m_config.txDeadlineRuntimeNs > 0U)
+    {
+        std::cout << std::format("  TX deadline jobs: {}, overruns (SIGXCPU): {}",
+                                 txCounters.deadlineJobs, txCounters.deadlineOverruns)
+                  << std::endl;
+    }
+
+    for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+    {
+        RingOverflowStats txOverflow = getTxOverflowStats(static_cast<TxLane>(lane));
+
+        std::cout << std::format(
+            "  TX {} lane: sent {}, dropped {}, high-water mark {}/{}\n"
+            "    overflow: newest dropped {}, oldest dropped {}, blocked {}, timeouts {}",
+            txLaneName(lane), txCounters.lanePackets[lane], txCounters.laneDrops[lane],
+            getTxQueueHighWaterMark(static_cast<TxLane>(lane)), getQueueCapacity(),
+            txOverflow.droppedNewest, txOverflow.droppedOldest, txOverflow.blocked, txOverflow.blockTimeouts)
+            << std::endl;
+    }
+
+    if (m_config.lowLatencyProfile == true)
+    {
+        reportFaults(workerCount);
+    }
+    std::cout << std::endl;
+
     /* Print latency statistics on shutdown */
-    auto rxStats = m_rxLatencyStats.computeStats();
-    auto txStats = m_txLatencyStats.computeStats();
-    auto intervalStats = m_rxIntervalStats.computeStats();
+    auto rxStats = m_rxLatencyStats->computeStats();
+    auto txStats = m_txLatencyStats->computeStats();
+    auto intervalStats = m_rxIntervalStats->computeStats();
 
     std::cout << rxStats.toString("RX Processing Latency");
     std::cout << txStats.toString("TX Send Latency");
     std::cout << intervalStats.toString("RX Inter-Packet Interval");
+
+    if (m_txHot.shaper.isEnabled() == true)
+    {
+        std::cout << m_txShapingStats->computeStats().toString("TX Shaping Delay");
+    }
+
+    if (m_config.txDirectSend == true)
+    {
+        std::cout << m_txDirectLatencyStats->computeStats().toString("TX Direct End-to-End");
+        std::cout << m_txQueuedLatencyStats->computeStats().toString("TX Queued End-to-End");
+    }
+
+    if (m_config.txDeadlineRuntimeNs > 0U)
+    {
+        std::cout << m_txDeadlineJobStats->computeStats().toString("TX Deadline Job CPU Time");
+    }
+
+    if (m_config.queueTimestamps == true)
+    {
+        for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+        {
+            std::cout << m_txResidenceStats[lane]->computeStats().toString(
+                std::format("TX {} Queue Residence", txLaneName(lane)));
+        }
+        for (size_t idx = 0U; idx < workerCount; idx++)
+        {
+            std::cout << m_rxResidenceStats[idx]->computeStats().toString(
+                std::format("RX Queue Residence (worker {})", idx));
+        }
+    }
+
+    /* Threads are joined: these are the counters each thread sampled on exit */
+    std::cout << "Thread Telemetry (since thread start)\n"
+              << ThreadTelemetry::Sample::header() << "\n"
+              << m_rxExitTelemetry.toString("RX") << "\n"
+              << m_txExitTelemetry.toString("TX") << std::endl;
+
+    for (size_t idx = 0U; idx < workerCount; idx++)
+    {
+        std::cout << m_rxWorkers[idx].exitTelemetry.toString(std::format("RX worker {}", idx)) << std::endl;
+    }
+
+    if (AllocationTracker::isCompiledIn() == true)
+    {
+        std::cout << std::endl;
+        AllocationTracker::report(std::cout);
+    }
+}
+
+UdpThreadManager::RxCounters
+UdpThreadManager::getRxCounters() const
+{
+    RxCounters counters = {};
+
+    m_rxHot.sequence.read([&]()
+    {
+        counters.packets = m_rxHot.packets.load(std::memory_order_relaxed);
+        counters.frames = m_rxHot.frames.load(std::memory_order_relaxed);
+        counters.drops = m_rxHot.drops.load(std::memory_order_relaxed);
+    });
+
+    return counters;
+}
+
+UdpThreadManager::TxCounters
+UdpThreadManager::getTxCounters() const
+{
+    TxCounters counters = {};
+    uint64_t queueDrops[TX_LANE_COUNT] = {};
+    uint64_t fallbacks = 0U;
+
+    m_txHot.sequence.read([&]()
+    {
+        counters.packets = m_txHot.packets.load(std::memory_order_relaxed);
+        counters.drops = m_txHot.sendErrors.load(std::memory_order_relaxed);
+        for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+        {
+            counters.lanePackets[lane] = m_txHot.lanePackets[lane].load(std::memory_order_relaxed);
+            counters.laneDrops[lane] = m_txHot.laneSendErrors[lane].load(std::memory_order_relaxed);
+        }
+        counters.shaped = m_txHot.shaped.load(std::memory_order_relaxed);
+        counters.direct = m_txHot.direct.load(std::memory_order_relaxed);
+        counters.deadlineJobs = m_txHot.deadlineJobs.load(std::memory_order_relaxed);
+        counters.coalescedDatagrams = m_txHot.coalescedDatagrams.load(std::memory_order_relaxed);
+        counters.coalescedPackets = m_txHot.coalescedPackets.load(std::memory_order_relaxed);
+        for (size_t reason = 0U; reason < COALESCE_FLUSH_REASON_COUNT; reason++)
+        {
+            counters.coalesceFlushes[reason] = m_txHot.coalesceFlushes[reason].load(std::memory_order_relaxed);
+        }
+    });
+
+    m_txProducer.sequence.read([&]()
+    {
+        for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+        {
+            queueDrops[lane] = m_txProducer.laneQueueDrops[lane].load(std::memory_order_relaxed);
+        }
+        fallbacks = m_txProducer.directFallbacks.load(std::memory_order_relaxed);
+    });
+
+    /* Drops = send failures (sender) + queue full (application) */
+    for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+    {
+        counters.laneDrops[lane] += queueDrops[lane];
+        counters.drops += queueDrops[lane];
+    }
+    counters.directFallback = fallbacks;
+    counters.deadlineOverruns = ThreadScheduler::getOverrunCount();
+
+    return counters;
 }
 
 void
@@ -181,14 +479,155 @@ UdpThreadManager::setRxCallback(RxCallback callback)
     m_rxCallback = callback;
 }
 
+void
+UdpThreadManager::setRxBatchCallback(RxBatchCallback callback)
+{
+    m_rxBatchCallback = callback;
+}
+
+size_t
+UdpThreadManager::getRxQueueSize() const
+{
+    size_t total = 0U;
+
+    for (const auto& queue : m_rxQueues)
+    {
+        if (queue.isValid() == true)
+        {
+            total += queue->size();
+        }
+    }
+
+    return total;
+}
+
+RingOverflowStats
+UdpThreadManager::getRxOverflowStats() const
+{
+    RingOverflowStats total = {};
+
+    for (const auto& queue : m_rxQueues)
+    {
+        if (queue.isValid() == true)
+        {
+            RingOverflowStats stats = queue->getOverflowStats();
+            total.droppedNewest += stats.droppedNewest;
+            total.droppedOldest += stats.droppedOldest;
+            total.blocked       += stats.blocked;
+            total.blockTimeouts += stats.blockTimeouts;
+        }
+    }
+
+    return total;
+}
+
+size_t
+UdpThreadManager::getRxQueueHighWaterMark() const
+{
+    size_t peak = 0U;
+
+    for (const auto& queue : m_rxQueues)
+    {
+        if (queue.isValid() == true)
+        {
+            peak = std::max(peak, queue->getHighWaterMark());
+        }
+    }
+
+    return peak;
+}
+
+size_t
+UdpThreadManager::getTxQueueSize() const
+{
+    size_t total = 0U;
+
+    for (const auto& queue : m_txQueues)
+    {
+        if (queue.isValid() == true)
+        {
+            total += queue->size();
+        }
+    }
+
+    return total;
+}
+
+RingOverflowStats
+UdpThreadManager::getTxOverflowStats() const
+{
+    RingOverflowStats total = {};
+
+    for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+    {
+        RingOverflowStats stats = getTxOverflowStats(static_cast<TxLane>(lane));
+        total.droppedNewest += stats.droppedNewest;
+        total.droppedOldest += stats.droppedOldest;
+        total.blocked       += stats.blocked;
+        total.blockTimeouts += stats.blockTimeouts;
+    }
+
+    return total;
+}
+
+RingOverflowStats
+UdpThreadManager::getTxOverflowStats(TxLane lane) const
+{
+    RingOverflowStats stats = {};
+    const auto& queue = m_txQueues[static_cast<size_t>(lane)];
+
+    if (queue.isValid() == true)
+    {
+        stats = queue->getOverflowStats();
+    }
+
+    return stats;
+}
+
+size_t
+UdpThreadManager::getTxQueueHighWaterMark(TxLane lane) const
+{
+    const auto& queue = m_txQueues[static_cast<size_t>(lane)];
+
+    return (queue.isValid() == true) ? queue->getHighWaterMark() : 0U;
+}
+
+bool
+UdpThreadManager::queueTxPacket(const uint8_t* data, size_t length, TxLane lane)
+{
+    struct iovec iov = {const_cast<uint8_t*>(data), length};
+
+    return queueTxPacketv(&iov, 1U, lane);
+}
+
 bool
-UdpThreadManager::queueTxPacket(const uint8_t* data, size_t length)
+UdpThreadManager::queueTxPacketv(const struct iovec* iov, size_t iovcnt, TxLane lane)
 {
     bool result = true;
+    size_t index = static_cast<size_t>(lane);
+    size_t length = 0U;
+    bool stamp = (m_config.queueTimestamps == true) || (m_config.txDirectSend == true);
+    uint64_t enqueueTicks = (stamp == true) ? TscClock::now() : 0U;
+
+    for (size_t piece = 0U; piece < iovcnt; piece++)
+    {
+        length += iov[piece].iov_len;
+    }
+
+    bool sentDirect = (m_config.txDirectSend == true) && (index < TX_LANE_COUNT) &&
+                      (trySendDirect(iov, iovcnt, length, index, enqueueTicks) == true);
 
-    if (m_txQueue.push(data, length) == false)
+    if ((sentDirect == false) &&
+        ((index >= TX_LANE_COUNT) || (m_txQueues[index].isValid() == false) ||
+         (m_txQueues[index]->pushv(iov, iovcnt, enqueueTicks) == false)))
     {
-        m_txDropCount.fetch_add(1, std::memory_order_relaxed);
+        /* Invalid lanes are counted as Bulk drops */
+        size_t dropLane = (index < TX_LANE_COUNT) ? index : static_cast<size_t>(TxLane::Bulk);
+
+        m_txProducer.sequence.write([&]()
+        {
+            SeqLock::add(m_txProducer.laneQueueDrops[dropLane]);
+        });
         result = false;
     }
 
@@ -199,6 +638,76 @@ UdpThreadManager::queueTxPacket(const uint8_t* data, size_t length)
  * Private Methods
  ******************************************************************************/
 
+bool
+UdpThreadManager::trySendDirect(const struct iovec* iov, size_t iovcnt, size_t length, size_t lane,
+                                uint64_t startTicks)
+{
+    bool result = false;
+
+    /* Empty check before and after taking the lock: the first avoids touching the
+     * lock under load, the second catches packets queued on other lanes meanwhile.
+     * Packets held for a coalesced datagram count as queued. */
+    if ((m_running.load(std::memory_order_acquire) == true) &&
+        (txLanesEmpty() == true) && (tryLockTxSend() == true))
+    {
+        if ((txLanesEmpty() == true) && (m_txHot.coalescePending.load(std::memory_order_relaxed) == false) &&
+            ((m_txHot.shaper.isEnabled() == false) || (m_txHot.shaper.tryConsume(length, TscClock::now()) == true)))
+        {
+            auto txStart = std::chrono::steady_clock::now();
+
+            ssize_t sentLen = m_udpNode->sendv(iov, iovcnt);
+
+            auto txEnd = std::chrono::steady_clock::now();
+
+            if (sentLen > 0)
+            {
+                m_txHot.sequence.write([&]()
+                {
+                    SeqLock::add(m_txHot.packets);
+                    SeqLock::add(m_txHot.lanePackets[lane]);
+                    SeqLock::add(m_txHot.direct);
+                });
+                /* Both recorders are single-producer; the send lock serialises them with the TX thread */
+                m_txLatencyStats->recordSample(txStart, txEnd);
+                m_txDirectLatencyStats->recordSample(TscClock::toNanoseconds(TscClock::now() - startTicks));
+            }
+            else
+            {
+                m_txHot.sequence.write([&]()
+                {
+                    SeqLock::add(m_txHot.sendErrors);
+                    SeqLock::add(m_txHot.laneSendErrors[lane]);
+                });
+            }
+            result = true;
+        }
+        unlockTxSend();
+    }
+
+    if (result == false)
+    {
+        m_txProducer.sequence.write([&]()
+        {
+            SeqLock::add(m_txProducer.directFallbacks);
+        });
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::txLanesEmpty() const
+{
+    bool empty = true;
+
+    for (size_t lane = 0U; (lane < TX_LANE_COUNT) && (empty == true); lane++)
+    {
+        empty = (m_txQueues[lane].isValid() == false) || (m_txQueues[lane]->isEmpty() == true);
+    }
+
+    return empty;
+}
+
 void*
 UdpThreadManager::rxThreadEntry(void* arg)
 {
@@ -215,10 +724,18 @@ UdpThreadManager::txThreadEntry(void* arg)
     return nullptr;
 }
 
+void*
+UdpThreadManager::rxWorkerEntry(void* arg)
+{
+    RxWorker* worker = static_cast<RxWorker*>(arg);
+    worker->manager->rxWorkerLoop(worker->index);
+    return nullptr;
+}
+
 void
 UdpThreadManager::rxThreadLoop()
 {
-    uint8_t rxBuffer[2048];
+    uint8_t rxBuffer[PACKET_MAX_SIZE];
     bool shouldExit = false;
 
     // Block SIGINT/SIGTERM so signals are delivered to the main thread
@@ -226,47 +743,78 @@ UdpThreadManager::rxThreadLoop()
     sigemptyset(&sigmask);
     sigaddset(&sigmask, SIGINT);
     sigaddset(&sigmask, SIGTERM);
+    sigaddset(&sigmask, SIGXCPU);   /* Deadline overrun signals belong to the TX thread */
     pthread_sigmask(SIG_BLOCK, &sigmask, nullptr);
 
+    m_rxTid.store(gettid(), std::memory_order_release);
+    AllocationTracker::registerThread("RX", m_config.allocationWarmupMs, m_config.abortOnRtAllocation);
     std::cout << "RX thread started (TID: " << gettid() << ")" << std::endl;
+
+    if (m_config.lowLatencyProfile == true)
+    {
+        m_rxFaults.begin(m_config.faultWarmupMs);
+    }
     
     do
     {
+        m_rxFaults.poll();
+
         // Blocking receive from socket
         ssize_t recvLen = m_udpNode->receive(rxBuffer, sizeof(rxBuffer));
         
         if (recvLen > 0)
         {
             auto rxStart = std::chrono::steady_clock::now();
+            uint64_t rxTicks = (m_config.queueTimestamps == true) ? TscClock::now() : 0U;
 
-            m_rxPacketCount.fetch_add(1, std::memory_order_relaxed);
+            m_rxHot.sequence.write([&]()
+            {
+                SeqLock::add(m_rxHot.packets);
+            });
 
             /* Measure inter-packet interval (jitter) */
-            if (m_firstRxPacket == false)
+            if (m_rxHot.firstRxPacket == false)
             {
-                m_rxIntervalStats.recordSample(m_lastRxTime, rxStart);
+                m_rxIntervalStats->recordSample(m_rxHot.lastRxTime, rxStart);
             }
             else
             {
-                m_firstRxPacket = false;
+                m_rxHot.firstRxPacket = false;
             }
-            m_lastRxTime = rxStart;
+            m_rxHot.lastRxTime = rxStart;
             
-            // Push to queue for application processing
-            if (m_rxQueue.push(rxBuffer, static_cast<size_t>(recvLen)) == false)
+            // Unpack coalesced datagrams: each frame is delivered on its own
+            size_t length = static_cast<size_t>(recvLen);
+            size_t offset = 0U;
+            uint64_t frames = 0U;
+
+            do
             {
-                m_rxDropCount.fetch_add(1, std::memory_order_relaxed);
+                size_t frameLength = length - offset;
+
+                if (m_config.rxFrameSplitter != nullptr)
+                {
+                    size_t first = m_config.rxFrameSplitter(&rxBuffer[offset], frameLength);
+                    if ((first > 0U) && (first < frameLength))
+                    {
+                        frameLength = first;
+                    }
+                }
+
+                dispatchRxFrame(&rxBuffer[offset], frameLength, rxTicks);
+                offset += frameLength;
+                frames++;
             }
-            
-            // If callback is set, call it directly (bypass queue)
-            if (m_rxCallback != nullptr)
+            while (offset < length);
+
+            m_rxHot.sequence.write([&]()
             {
-                m_rxCallback(rxBuffer, static_cast<size_t>(recvLen));
-            }
+                SeqLock::add(m_rxHot.frames, frames);
+            });
 
-            /* Record RX processing latency: recvfrom completion -> callback done */
+            /* Record RX processing latency: recvfrom completion -> callback done (or enqueued) */
             auto rxEnd = std::chrono::steady_clock::now();
-            m_rxLatencyStats.recordSample(rxStart, rxEnd);
+            m_rxLatencyStats->recordSample(rxStart, rxEnd);
         }
         else if (recvLen < 0)
         {
@@ -283,71 +831,704 @@ UdpThreadManager::rxThreadLoop()
     }
     while ((m_running.load(std::memory_order_acquire) == true) && (shouldExit == false));
     
+    m_rxFaults.finish();
+    AllocationTracker::unregisterThread();
+    ThreadTelemetry::sample(gettid(), m_rxExitTelemetry);
+    m_rxTid.store(0, std::memory_order_release);
     std::cout << "RX thread stopped" << std::endl;
 }
 
 void
-UdpThreadManager::txThreadLoop()
+UdpThreadManager::dispatchRxFrame(const uint8_t* data, size_t length, uint64_t rxTicks)
 {
-    uint8_t txBuffer[2048];
-    size_t txLength;
+    if (m_rxWorkerCount > 0U)
+    {
+        // Hand off to the next worker; the RX thread only drains the socket
+        if (m_rxQueues[m_rxHot.nextWorker]->push(data, length, rxTicks) == false)
+        {
+            m_rxHot.sequence.write([&]()
+            {
+                SeqLock::add(m_rxHot.drops);
+            });
+        }
+        m_rxHot.nextWorker = (m_rxHot.nextWorker + 1U) % m_rxWorkerCount;
+    }
+    else if (m_rxBatchCallback != nullptr)
+    {
+        // Inline delivery: a batch of one, directly from the RX thread
+        struct iovec frame = {const_cast<uint8_t*>(data), length};
+        m_rxBatchCallback(&frame, 1U);
+    }
+    else if (m_rxCallback != nullptr)
+    {
+        // Inline delivery: call it directly from the RX thread
+        m_rxCallback(data, length);
+    }
+}
+
+void
+UdpThreadManager::rxWorkerLoop(size_t index)
+{
+    PacketQueue& queue = *m_rxQueues[index];
+    LatencyStats<>& residenceStats = *m_rxResidenceStats[index];
+    size_t batchSize = (m_config.rxWorkerBatchSize > 0U) ? m_config.rxWorkerBatchSize : 1U;
+    size_t consumed = 0U;
+    FaultMonitor& faults = m_rxWorkers[index].faults;
 
     // Block SIGINT/SIGTERM so signals are delivered to the main thread
     sigset_t sigmask;
     sigemptyset(&sigmask);
     sigaddset(&sigmask, SIGINT);
     sigaddset(&sigmask, SIGTERM);
+    sigaddset(&sigmask, SIGXCPU);
     pthread_sigmask(SIG_BLOCK, &sigmask, nullptr);
 
-    std::cout << "TX thread started (TID: " << gettid() << ")" << std::endl;
-    
-    do
+    m_rxWorkers[index].tid.store(gettid(), std::memory_order_release);
+    AllocationTracker::registerThread(std::format("RX worker {}", index).c_str(),
+                                      m_config.allocationWarmupMs, m_config.abortOnRtAllocation);
+    std::cout << "RX worker " << index << " started (TID: " << gettid() << ")" << std::endl;
+
+    if (m_config.lowLatencyProfile == true)
     {
-        // Try to get packet from queue
-        if (m_txQueue.pop(txBuffer, sizeof(txBuffer), txLength) == true)
-        {
-            auto txStart = std::chrono::steady_clock::now();
+        faults.begin(m_config.faultWarmupMs);
+    }
 
-            // Send packet
-            ssize_t sentLen = m_udpNode->send(txBuffer, txLength);
+    do
+    {
+        faults.poll();
 
-            auto txEnd = std::chrono::steady_clock::now();
-            
-            if (sentLen > 0)
-            {
-                m_txPacketCount.fetch_add(1, std::memory_order_relaxed);
-                /* Record TX send latency: sendto() call duration */
-                m_txLatencyStats.recordSample(txStart, txEnd);
-            }
-            else
-            {
-                m_txDropCount.fetch_add(1, std::memory_order_relaxed);
-            }
+        if (m_rxBatchCallback != nullptr)
+        {
+            consumed = queue.consumeBatch([this, &residenceStats](const struct iovec* frames,
+                                                                  const RingSlotMetadata* const* meta,
+                                                                  size_t count) {
+                for (size_t idx = 0U; idx < count; idx++)
+                {
+                    recordResidence(residenceStats, *meta[idx]);
+                }
+                m_rxBatchCallback(frames, count);
+            }, batchSize);
         }
         else
         {
-            // Queue empty - yield CPU briefly
-            usleep(10);  // 10 microseconds
-        }
-    }
+            consumed = queue.consume([this, &residenceStats](const uint8_t* data, size_t length,
+                                                             const RingSlotMetadata& meta) {
+                recordResidence(residenceStats, meta);
+
+                if (m_rxCallback != nullptr)
+                {
+                    m_rxCallback(data, length);
+                }
+            }, batchSize);
+        }
+
+        if (consumed == 0U)
+        {
+            // Queue empty - yield CPU briefly
+            usleep(10);  // 10 microseconds
+        }
+    }
+    while ((m_running.load(std::memory_order_acquire) == true) || (consumed > 0U));
+
+    faults.finish();
+    AllocationTracker::unregisterThread();
+    ThreadTelemetry::sample(gettid(), m_rxWorkers[index].exitTelemetry);
+    m_rxWorkers[index].tid.store(0, std::memory_order_release);
+    std::cout << "RX worker " << index << " stopped" << std::endl;
+}
+
+void
+UdpThreadManager::txThreadLoop()
+{
+    uint8_t txBuffer[PACKET_MAX_SIZE];
+    size_t txLength;
+    RingSlotMetadata txMeta{};
+    size_t lane = TX_LANE_COUNT;
+    size_t batchSize = (m_config.txBatchSize > 0U) ? m_config.txBatchSize : 1U;
+    uint64_t shapeStartTicks = 0U;
+    bool coalesce = (m_txCoalesce.mtu > 0U);
+    uint64_t coalesceDeadlineTicks = TscClock::fromNanoseconds(
+        static_cast<uint64_t>(m_config.txCoalesceDeadlineUs) * 1000U);
+    bool locked = false;
+    bool deadlineJobs = false;
+    uint64_t unpublishedJobs = 0U;
+    struct timespec jobStart = {};
+    struct timespec jobEnd = {};
+
+    // Block SIGINT/SIGTERM so signals are delivered to the main thread
+    sigset_t sigmask;
+    sigemptyset(&sigmask);
+    sigaddset(&sigmask, SIGINT);
+    sigaddset(&sigmask, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigmask, nullptr);
+
+    m_txTid.store(gettid(), std::memory_order_release);
+    AllocationTracker::registerThread("TX", m_config.allocationWarmupMs, m_config.abortOnRtAllocation);
+    std::cout << "TX thread started (TID: " << gettid() << ")" << std::endl;
+
+    m_txDeadlinePacing.store((m_config.txDeadlineRuntimeNs > 0U) && (applyTxDeadline() == true),
+                             std::memory_order_relaxed);
+
+    if (m_config.lowLatencyProfile == true)
+    {
+        m_txFaults.begin(m_config.faultWarmupMs);
+    }
+    
+    do
+    {
+        // The policy can change at run time (setThreadScheduling()): pace by the current one
+        deadlineJobs = m_txDeadlinePacing.load(std::memory_order_relaxed);
+        if (deadlineJobs == true)
+        {
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &jobStart);
+        }
+
+        m_txFaults.poll();
+
+        size_t sent = 0U;
+        uint64_t waitTicks = 0U;
+        bool more = true;
+
+        // Send up to a batch per wake-up; the shaper is asked before every packet
+        while ((more == true) && (sent < batchSize))
+        {
+            // Highest-priority (or due) lane
+            lane = selectTxLane();
+            more = (lane < TX_LANE_COUNT);
+
+            // A failed lock means a direct send is on the wire - retry after the idle sleep
+            if ((more == true) && (m_config.txDirectSend == true))
+            {
+                locked = tryLockTxSend();
+                more = locked;
+            }
+
+            if ((more == true) && (m_txHot.shaper.isEnabled() == true))
+            {
+                more = admitTxPacket(lane, shapeStartTicks, waitTicks);
+            }
+
+            if ((more == true) && (coalesce == true))
+            {
+                // Packets join the datagram being filled; it goes out on size, count, Control or deadline
+                if (coalesceTxPacket(lane) == true)
+                {
+                    if (m_config.txScheduling == TxScheduling::Weighted)
+                    {
+                        m_txHot.laneCredit--;
+                    }
+                    sent++;
+                }
+            }
+            else if ((more == true) &&
+                     (m_txQueues[lane]->pop(txBuffer, sizeof(txBuffer), txLength, &txMeta) == true))
+            {
+                recordResidence(*m_txResidenceStats[lane], txMeta);
+                if (m_config.txScheduling == TxScheduling::Weighted)
+                {
+                    m_txHot.laneCredit--;
+                }
+
+                auto txStart = std::chrono::steady_clock::now();
+
+                // Send packet
+                ssize_t sentLen = m_udpNode->send(txBuffer, txLength);
+
+                auto txEnd = std::chrono::steady_clock::now();
+                
+                if (sentLen > 0)
+                {
+                    m_txHot.sequence.write([&]()
+                    {
+                        SeqLock::add(m_txHot.packets);
+                        SeqLock::add(m_txHot.lanePackets[lane]);
+                    });
+                    /* Record TX send latency: sendto() call duration */
+                    m_txLatencyStats->recordSample(txStart, txEnd);
+                    if (txMeta.enqueueTicks != 0U)
+                    {
+                        m_txQueuedLatencyStats->recordSample(
+                            TscClock::toNanoseconds(TscClock::now() - txMeta.enqueueTicks));
+                    }
+                }
+                else
+                {
+                    m_txHot.sequence.write([&]()
+                    {
+                        SeqLock::add(m_txHot.sendErrors);
+                        SeqLock::add(m_txHot.laneSendErrors[lane]);
+                    });
+                }
+                sent++;
+            }
+
+            if (locked == true)
+            {
+                unlockTxSend();
+                locked = false;
+            }
+        }
+
+        // Oldest held packet is due: send the datagram even if it is not full
+        if ((coalesce == true) && (m_txCoalesce.packets > 0U) &&
+            ((TscClock::now() - m_txCoalesce.popTicks[0]) >= coalesceDeadlineTicks) &&
+            ((m_config.txDirectSend == false) || (tryLockTxSend() == true)))
+        {
+            flushTxCoalesced(CoalesceFlush::Deadline);
+            if (m_config.txDirectSend == true)
+            {
+                unlockTxSend();
+            }
+        }
+
+        if (deadlineJobs == true)
+        {
+            // Job done: record its CPU time and give up the rest of the runtime until the next period
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &jobEnd);
+            m_txDeadlineJobStats->recordSample(
+                static_cast<uint64_t>(jobEnd.tv_sec - jobStart.tv_sec) * 1000000000ULL +
+                static_cast<uint64_t>(jobEnd.tv_nsec) - static_cast<uint64_t>(jobStart.tv_nsec));
+            unpublishedJobs++;
+
+            // A direct sender also writes m_txHot: publish only while holding the send lock
+            if ((m_config.txDirectSend == false) || (tryLockTxSend() == true))
+            {
+                m_txHot.sequence.write([&]()
+                {
+                    SeqLock::add(m_txHot.deadlineJobs, unpublishedJobs);
+                });
+                unpublishedJobs = 0U;
+                if (m_config.txDirectSend == true)
+                {
+                    unlockTxSend();
+                }
+            }
+            sched_yield();
+        }
+        else if (waitTicks > 0U)
+        {
+            // Shaper is holding the head packet - sleep only for waits of a microsecond or more
+            uint64_t waitUs = TscClock::toNanoseconds(waitTicks) / 1000U;
+            if (waitUs > 0U)
+            {
+                usleep(static_cast<useconds_t>(std::min<uint64_t>(waitUs, 10U)));
+            }
+        }
+        else if (sent == 0U)
+        {
+            // All lanes empty - yield CPU briefly
+            usleep(10);  // 10 microseconds
+        }
+    }
     while (m_running.load(std::memory_order_acquire) == true);
     
+    if ((m_txCoalesce.packets > 0U) || (unpublishedJobs > 0U))
+    {
+        // Held packets still go out; a direct sender may be finishing its send
+        while ((m_config.txDirectSend == true) && (tryLockTxSend() == false))
+        {
+            sched_yield();
+        }
+        if (m_txCoalesce.packets > 0U)
+        {
+            flushTxCoalesced(CoalesceFlush::Deadline);
+        }
+        m_txHot.sequence.write([&]()
+        {
+            SeqLock::add(m_txHot.deadlineJobs, unpublishedJobs);
+        });
+        if (m_config.txDirectSend == true)
+        {
+            unlockTxSend();
+        }
+    }
+
+    m_txFaults.finish();
+    AllocationTracker::unregisterThread();
+    ThreadTelemetry::sample(gettid(), m_txExitTelemetry);
+    m_txTid.store(0, std::memory_order_release);
     std::cout << "TX thread stopped" << std::endl;
 }
 
 bool
-UdpThreadManager::configureThread(pthread_t thread, int cpuCore, int priority, bool useRealtime)
+UdpThreadManager::coalesceTxPacket(size_t lane)
+{
+    bool result = false;
+    TxCoalesceState& datagram = m_txCoalesce;
+    PacketQueue& queue = *m_txQueues[lane];
+    size_t headLength = 0U;
+    size_t length = 0U;
+    RingSlotMetadata meta{};
+
+    /* Send what is held first if the head packet would not fit */
+    if ((datagram.packets > 0U) && (queue.peekLength(headLength) == true) &&
+        ((datagram.length + headLength) > datagram.mtu))
+    {
+        flushTxCoalesced(CoalesceFlush::Size);
+    }
+
+    /* Popped straight into place; a packet larger than the MTU goes out alone */
+    if (queue.pop(&datagram.buffer[datagram.length], sizeof(datagram.buffer) - datagram.length,
+                  length, &meta) == true)
+    {
+        recordResidence(*m_txResidenceStats[lane], meta);
+
+        datagram.popTicks[datagram.packets] = TscClock::now();
+        datagram.enqueueTicks[datagram.packets] = meta.enqueueTicks;
+        datagram.lanePackets[lane]++;
+        datagram.packets++;
+        datagram.length += length;
+        m_txHot.coalescePending.store(true, std::memory_order_relaxed);
+        result = true;
+
+        if (datagram.length >= datagram.mtu)
+        {
+            flushTxCoalesced(CoalesceFlush::Size);
+        }
+        else if (datagram.packets >= datagram.maxPackets)
+        {
+            flushTxCoalesced(CoalesceFlush::Count);
+        }
+        else if (lane == static_cast<size_t>(TxLane::Control))
+        {
+            flushTxCoalesced(CoalesceFlush::Urgent);
+        }
+    }
+
+    return result;
+}
+
+void
+UdpThreadManager::flushTxCoalesced(CoalesceFlush reason)
+{
+    TxCoalesceState& datagram = m_txCoalesce;
+
+    if (datagram.packets > 0U)
+    {
+        auto txStart = std::chrono::steady_clock::now();
+
+        ssize_t sentLen = m_udpNode->send(datagram.buffer, datagram.length);
+
+        auto txEnd = std::chrono::steady_clock::now();
+        uint64_t doneTicks = TscClock::now();
+
+        m_txHot.sequence.write([&]()
+        {
+            if (sentLen > 0)
+            {
+                SeqLock::add(m_txHot.packets);
+                SeqLock::add(m_txHot.coalescedDatagrams);
+                SeqLock::add(m_txHot.coalescedPackets, datagram.packets);
+            }
+            else
+            {
+                SeqLock::add(m_txHot.sendErrors, datagram.packets);
+            }
+            for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+            {
+                SeqLock::add((sentLen > 0) ? m_txHot.lanePackets[lane] : m_txHot.laneSendErrors[lane],
+                             datagram.lanePackets[lane]);
+            }
+            SeqLock::add(m_txHot.coalesceFlushes[static_cast<size_t>(reason)]);
+        });
+
+        if (sentLen > 0)
+        {
+            m_txLatencyStats->recordSample(txStart, txEnd);
+
+            /* Per packet: time spent waiting for the datagram, and end to end */
+            for (size_t idx = 0U; idx < datagram.packets; idx++)
+            {
+                m_txCoalesceHoldStats->recordSample(TscClock::toNanoseconds(doneTicks - datagram.popTicks[idx]));
+                if (datagram.enqueueTicks[idx] != 0U)
+                {
+                    m_txQueuedLatencyStats->recordSample(
+                        TscClock::toNanoseconds(doneTicks - datagram.enqueueTicks[idx]));
+                }
+            }
+        }
+
+        datagram.length = 0U;
+        datagram.packets = 0U;
+        for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+        {
+            datagram.lanePackets[lane] = 0U;
+        }
+        m_txHot.coalescePending.store(false, std::memory_order_relaxed);
+    }
+}
+
+size_t
+UdpThreadManager::selectTxLane()
+{
+    size_t lane = TX_LANE_COUNT;
+
+    if (m_config.txScheduling == TxScheduling::Weighted)
+    {
+        /* Serve the current lane until its credit is spent or it runs dry,
+         * then move on; an idle lane forfeits its turn. */
+        for (size_t step = 0U; (step <= TX_LANE_COUNT) && (lane == TX_LANE_COUNT); step++)
+        {
+            if ((m_txHot.laneCredit > 0U) && (m_txQueues[m_txHot.laneCursor]->isEmpty() == false))
+            {
+                lane = m_txHot.laneCursor;
+            }
+            else
+            {
+                m_txHot.laneCursor = (m_txHot.laneCursor + 1U) % TX_LANE_COUNT;
+                m_txHot.laneCredit = std::max(m_config.txLaneWeights[m_txHot.laneCursor], 1U);
+            }
+        }
+    }
+    else
+    {
+        /* Lowest index = highest priority */
+        for (size_t idx = 0U; (idx < TX_LANE_COUNT) && (lane == TX_LANE_COUNT); idx++)
+        {
+            if (m_txQueues[idx]->isEmpty() == false)
+            {
+                lane = idx;
+            }
+        }
+    }
+
+    return lane;
+}
+
+bool
+UdpThreadManager::admitTxPacket(size_t lane, uint64_t& shapeStartTicks, uint64_t& waitTicks)
+{
+    bool result = true;
+    size_t length = 0U;
+    uint64_t nowTicks = TscClock::now();
+
+    if (m_txQueues[lane]->peekLength(length) == true)
+    {
+        if (m_txHot.shaper.tryConsume(length, nowTicks) == true)
+        {
+            /* Record how long the link was held back before this packet went out */
+            if (shapeStartTicks != 0U)
+            {
+                m_txShapingStats->recordSample(TscClock::toNanoseconds(nowTicks - shapeStartTicks));
+                m_txHot.sequence.write([&]()
+                {
+                    SeqLock::add(m_txHot.shaped);
+                });
+                shapeStartTicks = 0U;
+            }
+        }
+        else
+        {
+            if (shapeStartTicks == 0U)
+            {
+                shapeStartTicks = nowTicks;
+            }
+            waitTicks = std::max<uint64_t>(m_txHot.shaper.ticksUntilAvailable(length), 1U);
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::startRxWorkers()
 {
     bool result = true;
+    size_t count = 0U;
+
+    m_rxWorkerCount = 0U;
+    m_rxHot.nextWorker = 0U;
+
+    if (m_config.rxDeliveryMode == RxDeliveryMode::WorkerPool)
+    {
+        count = std::clamp(m_config.rxWorkerCount, static_cast<size_t>(1U), RX_WORKER_MAX);
+    }
+
+    for (size_t idx = 0U; (idx < count) && (result == true); idx++)
+    {
+        RxWorker& worker = m_rxWorkers[idx];
+        worker.manager = this;
+        worker.index = idx;
+        worker.faults = FaultMonitor();
+
+        if (createThread(worker.thread, rxWorkerEntry, &worker, worker.stack) == false)
+        {
+            std::cerr << std::format(
+                "UdpThreadManager: Failed to create RX worker {}: {}\n",
+                idx, strerror(errno))
+                << std::endl;
+            worker.thread = 0;
+            result = false;
+        }
+        else
+        {
+            m_rxWorkerCount++;
+
+            SchedSettings settings = {};
+            settings.policy = m_config.rtPolicy;
+            settings.priority = m_config.rxWorkerPriority;
+
+            if (configureThread(worker.thread, 0, m_config.rxWorkerCpuCores[idx],
+                                settings, m_config.useRealtimeScheduling) == false)
+            {
+                std::cerr << std::format("UdpThreadManager: Failed to configure RX worker {}\n", idx) << std::endl;
+                // Continue anyway - not fatal
+            }
+        }
+    }
+
+    return result;
+}
+
+void
+UdpThreadManager::stopRxWorkers()
+{
+    for (size_t idx = 0U; idx < m_rxWorkerCount; idx++)
+    {
+        if (m_rxWorkers[idx].thread != 0)
+        {
+            pthread_join(m_rxWorkers[idx].thread, nullptr);
+            m_rxWorkers[idx].thread = 0;
+        }
+    }
+
+    m_rxWorkerCount = 0U;
+}
+
+bool
+UdpThreadManager::createThread(pthread_t& thread, void* (*entry)(void*), void* arg, const HugePageBuffer& stack)
+{
+    bool result = false;
+    pthread_attr_t attr;
+
+    if (pthread_attr_init(&attr) == 0)
+    {
+        if ((stack.data() == nullptr) || (RealtimeProfile::setStack(attr, stack) == true))
+        {
+            result = (pthread_create(&thread, &attr, entry, arg) == 0);
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    return result;
+}
+
+void
+UdpThreadManager::applyLowLatencyProfile()
+{
+    /* Order matters: heap settings first, so the reserved block stays in the heap,
+     * then lock everything mapped so far (stacks, rings, heap) and everything to come */
+    RealtimeProfile::disableMallocTrim();
+    RealtimeProfile::reserveHeap(m_config.heapReserveSize);
+
+    m_allMemoryLocked = RealtimeProfile::lockAllMemory();
+
+    if (m_allMemoryLocked == false)
+    {
+        std::cerr << "UdpThreadManager: Continuing without mlockall" << std::endl;
+        // Continue anyway - not fatal
+    }
+}
+
+void
+UdpThreadManager::applyHostTuning()
+{
+    m_hostTuningFindings = 0U;
+
+    if (m_config.checkHostTuning == true)
+    {
+        std::vector<int> cores = {m_config.rxCpuCore, m_config.txCpuCore};
+
+        if (m_config.rxDeliveryMode == RxDeliveryMode::WorkerPool)
+        {
+            size_t workerCount = std::clamp(m_config.rxWorkerCount, static_cast<size_t>(1U), RX_WORKER_MAX);
+            cores.insert(cores.end(), m_config.rxWorkerCpuCores,
+                         m_config.rxWorkerCpuCores + workerCount);
+        }
+
+        /* Several threads may share a core: check each core once */
+        std::sort(cores.begin(), cores.end());
+        cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+
+        m_hostTuningFindings = m_hostTuning.checkCores(cores, m_udpNode->getInterfaceName());
+    }
+
+    if (m_config.holdCpuDmaLatency == true)
+    {
+        if (m_hostTuning.holdDmaLatency(m_config.cpuDmaLatencyUs) == false)
+        {
+            std::cerr << "UdpThreadManager: Continuing without CPU latency request" << std::endl;
+            // Continue anyway - not fatal
+        }
+    }
+}
+
+ThreadTelemetry::Sample
+UdpThreadManager::sampleThread(const std::atomic<pid_t>& tid, const ThreadTelemetry::Sample& exitSample)
+{
+    ThreadTelemetry::Sample sample = {};
+    pid_t current = tid.load(std::memory_order_acquire);
+
+    if (current != 0)
+    {
+        ThreadTelemetry::sample(current, sample);
+    }
+    else
+    {
+        sample = exitSample;
+    }
+
+    return sample;
+}
+
+void
+UdpThreadManager::reportFaults(size_t workerCount) const
+{
+    auto line = [](const std::string& name, const FaultMonitor& monitor) -> std::string
+    {
+        std::string text;
+
+        if (monitor.isArmed() == false)
+        {
+            text = std::format("  {} faults after warm-up: n/a (stopped during warm-up)", name);
+        }
+        else
+        {
+            const RealtimeProfile::FaultCounters& faults = monitor.getFaults();
+            text = std::format("  {} faults after warm-up: minor {}, major {} ({})",
+                               name, faults.minor, faults.major,
+                               ((faults.minor + faults.major) == 0U) ? "OK" : "WARNING");
+        }
+
+        return text;
+    };
+
+    std::cout << line("RX thread", m_rxFaults) << std::endl;
+    std::cout << line("TX thread", m_txFaults) << std::endl;
+
+    for (size_t idx = 0U; idx < workerCount; idx++)
+    {
+        std::cout << line(std::format("RX worker {}", idx), m_rxWorkers[idx].faults) << std::endl;
+    }
+}
+
+bool
+UdpThreadManager::configureThread(pthread_t thread, pid_t tid, int cpuCore, const SchedSettings& settings,
+                                  bool useRealtime)
+{
+    bool result = true;
+    const char* policy = ThreadScheduler::policyName(settings.policy);
     
-    // Set CPU affinity
-    if (cpuCore >= 0)
+    // Set CPU affinity (a deadline task must keep the affinity of its root domain)
+    if ((cpuCore >= 0) && (settings.policy == SchedPolicy::Deadline))
     {
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        CPU_SET(cpuCore, &cpuset);
-        
-        if (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) != 0)
+        std::cout << std::format("Not pinning to core {}: SCHED_DEADLINE uses the root-domain affinity\n",
+                                 cpuCore) << std::endl;
+    }
+    else if (cpuCore >= 0)
+    {
+        if (ThreadScheduler::setAffinity(thread, cpuCore) == false)
         {
             std::cerr << std::format(
                 "Failed to set CPU affinity to core {}: {}\n",
@@ -361,30 +1542,277 @@ UdpThreadManager::configureThread(pthread_t thread, int cpuCore, int priority, b
         }
     }
     
-    // Set real-time scheduling (SCHED_FIFO)
-    if ((useRealtime == true) && (priority > 0))
+    // Set real-time scheduling (SCHED_FIFO, SCHED_RR or SCHED_DEADLINE)
+    if ((useRealtime == true) && ((settings.priority > 0) || (settings.runtimeNs > 0U)))
     {
-        struct sched_param param;
-        param.sched_priority = priority;
-        
-        if (pthread_setschedparam(thread, SCHED_FIFO, &param) != 0)
+        if (ThreadScheduler::setScheduling(thread, tid, settings) == false)
         {
+            int error = errno;
+
             std::cerr << std::format(
-                "Failed to set SCHED_FIFO priority {}: {}\n"
-                "Note: May require root privileges or CAP_SYS_NICE capability\n",
-                priority, strerror(errno))
+                "Failed to set {} {}: {}\n"
+                "Note: May require root privileges or CAP_SYS_NICE capability{}\n",
+                policy,
+                (settings.policy == SchedPolicy::Deadline) ?
+                    std::format("runtime {} / deadline {} / period {} ns",
+                                settings.runtimeNs, settings.deadlineNs, settings.periodNs) :
+                    std::format("priority {}", settings.priority),
+                strerror(errno),
+                (errno == EBUSY) ? "; EBUSY: deadline admission control rejected the bandwidth" : "")
                 << std::endl;
+            errno = error;  /* Callers may retry on the reason */
             result = false;
         }
+        else if (settings.policy == SchedPolicy::Deadline)
+        {
+            std::cout << std::format("Set {} runtime {} us / deadline {} us / period {} us\n", policy,
+                                     settings.runtimeNs / 1000U, settings.deadlineNs / 1000U,
+                                     settings.periodNs / 1000U) << std::endl;
+        }
         else
         {
-            std::cout << std::format("Set SCHED_FIFO priority {}\n", priority) << std::endl;
+            std::cout << std::format("Set {} priority {}\n", policy, settings.priority) << std::endl;
         }
     }
     
     return result;
 }
 
+bool
+UdpThreadManager::applyTxDeadline()
+{
+    bool result = false;
+    SchedSettings settings = {};
+
+    settings.policy = SchedPolicy::Deadline;
+    settings.runtimeNs = m_config.txDeadlineRuntimeNs;
+    settings.deadlineNs = m_config.txDeadlineNs;
+    settings.periodNs = m_config.txDeadlinePeriodNs;
+    settings.overrunSignal = ThreadScheduler::installOverrunHandler();
+
+    result = configureThread(pthread_self(), gettid(), m_config.txCpuCore, settings, true);
+
+    /* Kernels before 4.16 reject SCHED_FLAG_DL_OVERRUN: run without overrun signals */
+    if ((result == false) && (errno == EINVAL) && (settings.overrunSignal == true))
+    {
+        settings.overrunSignal = false;
+        result = configureThread(pthread_self(), gettid(), -1, settings, true);
+        if (result == true)
+        {
+            std::cerr << "TX deadline overruns not reported: kernel lacks SCHED_FLAG_DL_OVERRUN" << std::endl;
+        }
+    }
+
+    if (result == false)
+    {
+        SchedSettings fallback = {};
+        fallback.policy = m_config.rtPolicy;
+        fallback.priority = m_config.txPriority;
+
+        std::cerr << "TX thread: SCHED_DEADLINE unavailable, falling back to priority scheduling" << std::endl;
+        configureThread(pthread_self(), gettid(), m_config.txCpuCore, fallback, m_config.useRealtimeScheduling);
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::findManagedThread(ManagedThread thread, size_t worker, pthread_t& handle, pid_t& tid,
+                                    int*& cpuCore, int*& priority)
+{
+    bool result = false;
+
+    if (m_running.load(std::memory_order_acquire) == true)
+    {
+        switch (thread)
+        {
+            case ManagedThread::Rx:
+                handle = m_rxThread;
+                tid = m_rxTid.load(std::memory_order_acquire);
+                cpuCore = &m_config.rxCpuCore;
+                priority = &m_config.rxPriority;
+                result = true;
+                break;
+            case ManagedThread::Tx:
+                handle = m_txThread;
+                tid = m_txTid.load(std::memory_order_acquire);
+                cpuCore = &m_config.txCpuCore;
+                priority = &m_config.txPriority;
+                result = true;
+                break;
+            case ManagedThread::RxWorker:
+                if (worker < m_rxWorkerCount)
+                {
+                    handle = m_rxWorkers[worker].thread;
+                    tid = m_rxWorkers[worker].tid.load(std::memory_order_acquire);
+                    cpuCore = &m_config.rxWorkerCpuCores[worker];
+                    priority = &m_config.rxWorkerPriority;
+                    result = true;
+                }
+                break;
+        }
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::setThreadAffinity(ManagedThread thread, size_t worker, int cpuCore)
+{
+    bool result = false;
+    pthread_t handle = 0;
+    pid_t tid = 0;
+    int* configCore = nullptr;
+    int* configPriority = nullptr;
+
+    if (findManagedThread(thread, worker, handle, tid, configCore, configPriority) == false)
+    {
+        std::cerr << "UdpThreadManager: No such running thread" << std::endl;
+    }
+    else if (ThreadScheduler::setAffinity(handle, cpuCore) == false)
+    {
+        std::cerr << std::format("UdpThreadManager: Failed to move TID {} to core {}: {}",
+                                 tid, cpuCore, strerror(errno)) << std::endl;
+        m_error = Error::SetAffinityFail;
+    }
+    else
+    {
+        int oldNode = m_numa.getNodeOfCpu(*configCore);
+        int newNode = m_numa.getNodeOfCpu(cpuCore);
+
+        std::cout << std::format("UdpThreadManager: Moved TID {} from core {} to core {}",
+                                 tid, *configCore, cpuCore) << std::endl;
+
+        if ((oldNode >= 0) && (newNode != oldNode))
+        {
+            std::cerr << std::format(
+                "UdpThreadManager: Warning: core {} is on NUMA node {}, rings and stats placed for node {} "
+                "stay there until the next start()", cpuCore, newNode, oldNode) << std::endl;
+        }
+
+        *configCore = cpuCore;
+        result = true;
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::setThreadScheduling(ManagedThread thread, size_t worker, const SchedSettings& settings)
+{
+    bool result = false;
+    pthread_t handle = 0;
+    pid_t tid = 0;
+    int* configCore = nullptr;
+    int* configPriority = nullptr;
+
+    if (findManagedThread(thread, worker, handle, tid, configCore, configPriority) == false)
+    {
+        std::cerr << "UdpThreadManager: No such running thread" << std::endl;
+    }
+    else if (ThreadScheduler::setScheduling(handle, tid, settings) == false)
+    {
+        std::cerr << std::format(
+            "UdpThreadManager: Failed to set {} on TID {}: {}{}",
+            ThreadScheduler::policyName(settings.policy), tid, strerror(errno),
+            ((settings.policy == SchedPolicy::Deadline) && (errno == EPERM)) ?
+                " (SCHED_DEADLINE needs root and an affinity covering the root domain)" : "")
+            << std::endl;
+        m_error = Error::SetSchedulerFail;
+    }
+    else
+    {
+        std::cout << std::format("UdpThreadManager: TID {} now {}", tid, ThreadScheduler::describe(tid))
+                  << std::endl;
+
+        if ((settings.policy == SchedPolicy::Fifo) || (settings.policy == SchedPolicy::RoundRobin))
+        {
+            *configPriority = settings.priority;
+        }
+
+        /* The TX loop yields per period only under SCHED_DEADLINE; any other policy sleeps when idle */
+        if (thread == ManagedThread::Tx)
+        {
+            m_txDeadlinePacing.store(settings.policy == SchedPolicy::Deadline, std::memory_order_relaxed);
+        }
+        result = true;
+    }
+
+    return result;
+}
+
+bool
+UdpThreadManager::setSocketBufferSizes(size_t rxBufferSize, size_t txBufferSize)
+{
+    bool result = false;
+
+    if (m_running.load(std::memory_order_acquire) == false)
+    {
+        std::cerr << "UdpThreadManager: Not running" << std::endl;
+    }
+    else
+    {
+        size_t previousRx = m_config.rxBufferSize;
+        size_t previousTx = m_config.txBufferSize;
+
+        /* configureSocketBuffers() leaves a zero size untouched */
+        m_config.rxBufferSize = rxBufferSize;
+        m_config.txBufferSize = txBufferSize;
+        result = configureSocketBuffers();
+
+        m_config.rxBufferSize = (rxBufferSize > 0U) ? rxBufferSize : previousRx;
+        m_config.txBufferSize = (txBufferSize > 0U) ? txBufferSize : previousTx;
+
+        if (result == false)
+        {
+            m_error = Error::SetSocketBufferFail;
+        }
+    }
+
+    return result;
+}
+
+std::string
+UdpThreadManager::describeThreads() const
+{
+    std::string text;
+    int sockFd = (m_udpNode != nullptr) ? m_udpNode->getFd() : -1;
+    int rcvBuf = 0;
+    int sndBuf = 0;
+    socklen_t optlen = sizeof(int);
+
+    if (m_running.load(std::memory_order_acquire) == true)
+    {
+        pid_t rxTid = m_rxTid.load(std::memory_order_acquire);
+        pid_t txTid = m_txTid.load(std::memory_order_acquire);
+
+        text += std::format("rx: core {}, {}, tid {}\n", m_config.rxCpuCore, ThreadScheduler::describe(rxTid), rxTid);
+        text += std::format("tx: core {}, {}, tid {}\n", m_config.txCpuCore, ThreadScheduler::describe(txTid), txTid);
+
+        for (size_t idx = 0U; idx < m_rxWorkerCount; idx++)
+        {
+            pid_t workerTid = m_rxWorkers[idx].tid.load(std::memory_order_acquire);
+
+            text += std::format("worker{}: core {}, {}, tid {}\n", idx, m_config.rxWorkerCpuCores[idx],
+                                ThreadScheduler::describe(workerTid), workerTid);
+        }
+    }
+    else
+    {
+        text += "threads: not running\n";
+    }
+
+    if (sockFd >= 0)
+    {
+        getsockopt(sockFd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, &optlen);
+        optlen = sizeof(int);
+        getsockopt(sockFd, SOL_SOCKET, SO_SNDBUF, &sndBuf, &optlen);
+        text += std::format("sockbuf: rx {} bytes, tx {} bytes\n", rcvBuf, sndBuf);
+    }
+
+    return text;
+}
+
 bool
 UdpThreadManager::configureSocketBuffers()
 {
@@ -468,3 +1896,200 @@ UdpThreadManager::configureSocketBuffers()
     
     return result;
 }
+
+bool
+UdpThreadManager::allocateBuffers()
+{
+    bool result = true;
+    bool useHuge = m_config.useHugePages;
+    int rxNode = -1;
+    int txNode = -1;
+
+    /* Binding only pays off with more than one node */
+    if (m_numa.getNodeCount() > 1)
+    {
+        rxNode = m_numa.getNodeOfCpu(m_config.rxCpuCore);
+        txNode = m_numa.getNodeOfCpu(m_config.txCpuCore);
+    }
+
+    /* RX rings: RX thread writes, workers read. TX rings: application writes, TX thread reads.
+     * The application thread is not pinned, so its side falls back to the RT thread's node. */
+    int txQueueNode = selectRingNode(-1, txNode);
+    size_t rxQueueCount = 0U;
+
+    if (m_config.rxDeliveryMode == RxDeliveryMode::WorkerPool)
+    {
+        rxQueueCount = std::clamp(m_config.rxWorkerCount, static_cast<size_t>(1U), RX_WORKER_MAX);
+    }
+
+    /* Buffers survive stop()/start() so statistics accumulate across restarts. Each one is
+     * checked on its own: after a partial failure, the next start() fills in the rest. */
+    auto ensure = [useHuge](auto& buffer, int node) {
+        return (buffer.isValid() == true) || (buffer.create(useHuge, node) == true);
+    };
+
+    result = (ensure(m_rxLatencyStats, rxNode) == true) &&
+             (ensure(m_txLatencyStats, txNode) == true) &&
+             (ensure(m_rxIntervalStats, rxNode) == true) &&
+             (ensure(m_txShapingStats, txNode) == true) &&
+             (ensure(m_txDirectLatencyStats, txNode) == true) &&
+             (ensure(m_txQueuedLatencyStats, txNode) == true) &&
+             (ensure(m_txDeadlineJobStats, txNode) == true) &&
+             (ensure(m_txCoalesceHoldStats, txNode) == true);
+
+    /* One SPSC queue per TX lane: application writes, TX thread reads */
+    for (size_t lane = 0U; (lane < TX_LANE_COUNT) && (result == true); lane++)
+    {
+        result = (ensure(m_txQueues[lane], txQueueNode) == true) &&
+                 (ensure(m_txResidenceStats[lane], txNode) == true);
+    }
+
+    /* One SPSC queue per worker: RX thread writes, worker reads */
+    for (size_t idx = 0U; (idx < rxQueueCount) && (result == true); idx++)
+    {
+        int workerNode = (rxNode >= 0) ? m_numa.getNodeOfCpu(m_config.rxWorkerCpuCores[idx]) : -1;
+        result = (ensure(m_rxQueues[idx], selectRingNode(rxNode, workerNode)) == true) &&
+                 (ensure(m_rxResidenceStats[idx], workerNode) == true);
+    }
+
+    /* Prefaulted, node-local stacks: first deep calls on an RT thread must not fault */
+    if ((m_config.lowLatencyProfile == true) && (result == true))
+    {
+        size_t stackSize = (m_config.threadStackSize > 0U) ?
+                           m_config.threadStackSize : RealtimeProfile::DEFAULT_STACK_SIZE;
+
+        if (m_rxStack.data() == nullptr)
+        {
+            result = RealtimeProfile::allocateStack(m_rxStack, stackSize, rxNode);
+        }
+        if ((m_txStack.data() == nullptr) && (result == true))
+        {
+            result = RealtimeProfile::allocateStack(m_txStack, stackSize, txNode);
+        }
+        for (size_t idx = 0U; (idx < rxQueueCount) && (result == true); idx++)
+        {
+            if (m_rxWorkers[idx].stack.data() == nullptr)
+            {
+                int workerNode = (rxNode >= 0) ? m_numa.getNodeOfCpu(m_config.rxWorkerCpuCores[idx]) : -1;
+                result = RealtimeProfile::allocateStack(m_rxWorkers[idx].stack, stackSize, workerNode);
+            }
+        }
+    }
+
+    if (result == false)
+    {
+        std::cerr << "UdpThreadManager: Failed to allocate ring/statistics buffers" << std::endl;
+    }
+    else
+    {
+        std::chrono::microseconds blockTimeout(m_config.overflowBlockTimeoutUs);
+
+        /* Set on every start(): threads are not running yet, so this is safe */
+        for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+        {
+            m_txQueues[lane]->setOverflowPolicy(m_config.txOverflowPolicy[lane], blockTimeout);
+        }
+        for (size_t idx = 0U; idx < rxQueueCount; idx++)
+        {
+            m_rxQueues[idx]->setOverflowPolicy(m_config.rxOverflowPolicy, blockTimeout);
+        }
+
+        if (m_config.lockMemory == true)
+        {
+            /* Attempt every buffer even if one fails, so as much as possible stays resident */
+            bool locked = m_rxLatencyStats.lock();
+            locked = (m_txLatencyStats.lock() == true) && (locked == true);
+            locked = (m_rxIntervalStats.lock() == true) && (locked == true);
+            locked = (m_txShapingStats.lock() == true) && (locked == true);
+            locked = (m_txDirectLatencyStats.lock() == true) && (locked == true);
+            locked = (m_txQueuedLatencyStats.lock() == true) && (locked == true);
+            locked = (m_txDeadlineJobStats.lock() == true) && (locked == true);
+            locked = (m_txCoalesceHoldStats.lock() == true) && (locked == true);
+
+            for (size_t lane = 0U; lane < TX_LANE_COUNT; lane++)
+            {
+                locked = (m_txQueues[lane].lock() == true) && (locked == true);
+                locked = (m_txResidenceStats[lane].lock() == true) && (locked == true);
+            }
+
+            for (size_t idx = 0U; idx < rxQueueCount; idx++)
+            {
+                locked = (m_rxQueues[idx].lock() == true) && (locked == true);
+                locked = (m_rxResidenceStats[idx].lock() == true) && (locked == true);
+            }
+
+            if (locked == false)
+            {
+                std::cerr << "UdpThreadManager: Failed to mlock buffers, continuing unlocked" << std::endl;
+                // Continue anyway - not fatal
+            }
+        }
+    }
+
+    return result;
+}
+
+int
+UdpThreadManager::selectRingNode(int writerNode, int readerNode) const
+{
+    int node = -1;
+
+    if (m_config.ringPlacement == RingPlacement::Reader)
+    {
+        node = (readerNode >= 0) ? readerNode : writerNode;
+    }
+    else
+    {
+        node = (writerNode >= 0) ? writerNode : readerNode;
+    }
+
+    return node;
+}
+
+void
+UdpThreadManager::recordResidence(LatencyStats<>& stats, const RingSlotMetadata& meta)
+{
+    /* Unstamped slots carry 0; a later stamp than now means unsynchronised TSCs */
+    if (meta.enqueueTicks != 0U)
+    {
+        uint64_t nowTicks = TscClock::now();
+
+        if (nowTicks >= meta.enqueueTicks)
+        {
+            stats.recordSample(TscClock::toNanoseconds(nowTicks - meta.enqueueTicks));
+        }
+    }
+}
+
+void
+UdpThreadManager::checkNicLocality() const
+{
+    std::string ifname = m_udpNode->getInterfaceName();
+    int nicNode = NumaTopology::getNodeOfNetDevice(ifname);
+    int rxNode = m_numa.getNodeOfCpu(m_config.rxCpuCore);
+    int txNode = m_numa.getNodeOfCpu(m_config.txCpuCore);
+
+    if ((nicNode >= 0) && (rxNode >= 0) && (rxNode != nicNode))
+    {
+        std::cerr << std::format(
+            "UdpThreadManager: Warning: RX core {} is on NUMA node {}, NIC {} is on node {}\n",
+            m_config.rxCpuCore, rxNode, ifname, nicNode)
+            << std::endl;
+    }
+
+    if ((nicNode >= 0) && (txNode >= 0) && (txNode != nicNode))
+    {
+        std::cerr << std::format(
+            "UdpThreadManager: Warning: TX core {} is on NUMA node {}, NIC {} is on node {}\n",
+            m_config.txCpuCore, txNode, ifname, nicNode)
+            << std::endl;
+    }
+
+    if ((rxNode >= 0) && (txNode >= 0) && (rxNode != txNode))
+    {
+        std::cerr << std::format(
+            "UdpThreadManager: Warning: RX core {} (node {}) and TX core {} (node {}) span NUMA nodes\n",
+            m_config.rxCpuCore, rxNode, m_config.txCpuCore, txNode)
+            << std::endl;
+    }
+}
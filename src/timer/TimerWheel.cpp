@@ -0,0 +1,250 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file TimerWheel.cpp
+ * @ingroup timer
+ * @class TimerWheel
+ * @brief Hierarchical timer wheel for many deadlines with O(1) schedule/expire
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <bit>
+
+#include "timer/TimerWheel.hpp"
+
+
+/*******************************************************************************
+ * Constructor/Destructor
+ ******************************************************************************/
+TimerWheel::TimerWheel()
+    : m_now(0U),
+      m_scheduled(0U)
+{
+    m_heads.fill(NONE);
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Allocate the per-id tables and set the current tick
+ *
+ * @param[in] capacity    Ids 0..capacity-1 can be scheduled
+ * @param[in] start_tick  Current tick
+ * @return false if the capacity is 0 or does not fit an id
+ */
+bool
+TimerWheel::initialize(size_t capacity, uint64_t start_tick)
+{
+    bool result = false;
+
+    if ((capacity == 0U) || (capacity >= NONE))
+    {
+        goto TimerWheel_initialize_exit;
+    }
+
+    m_next.assign(capacity, NONE);
+    m_prev.assign(capacity, NONE);
+    m_expiry.assign(capacity, 0U);
+    m_slot.assign(capacity, NO_SLOT);
+    m_heads.fill(NONE);
+    m_now = start_tick;
+    m_scheduled = 0U;
+    result = true;
+
+TimerWheel_initialize_exit:
+    return result;
+}
+
+/**
+ * @brief Set the deadline of an id, replacing any earlier one
+ *
+ * @param[in] id           Index below the capacity
+ * @param[in] expiry_tick  Deadline; a tick already reached expires on the next advance()
+ * @return false if the id is out of range
+ */
+bool
+TimerWheel::schedule(uint32_t id, uint64_t expiry_tick)
+{
+    bool result = false;
+
+    if (id < m_slot.size())
+    {
+        if (m_slot[id] != NO_SLOT)
+        {
+            unlink(id);
+        }
+        m_expiry[id] = expiry_tick;
+        place(id);
+        result = true;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Remove the deadline of an id
+ *
+ * @return true if the id was scheduled
+ */
+bool
+TimerWheel::cancel(uint32_t id)
+{
+    bool result = false;
+
+    if (isScheduled(id) == true)
+    {
+        unlink(id);
+        result = true;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Check whether an id has a pending deadline
+ */
+bool
+TimerWheel::isScheduled(uint32_t id) const
+{
+    return (id < m_slot.size()) && (m_slot[id] != NO_SLOT);
+}
+
+/**
+ * @brief Get the tick reached by the last advance()
+ */
+uint64_t
+TimerWheel::getCurrentTick(void) const
+{
+    return m_now;
+}
+
+/**
+ * @brief Get the number of pending deadlines
+ */
+size_t
+TimerWheel::getScheduledCount(void) const
+{
+    return m_scheduled;
+}
+
+/**
+ * @brief Get the number of ids
+ */
+size_t
+TimerWheel::getCapacity(void) const
+{
+    return m_slot.size();
+}
+
+/**
+ * @brief Put an unlinked id into the slot its deadline belongs to
+ *
+ * The level is that of the highest 6-bit group in which the deadline
+ * differs from the current tick, so the slot lies ahead in its level
+ * and is cascaded exactly when the deadline's range begins.
+ */
+void
+TimerWheel::place(uint32_t id)
+{
+    uint64_t expiry = std::max(m_expiry[id], m_now + 1U);
+    size_t level = static_cast<size_t>(std::bit_width(expiry ^ m_now) - 1U) / SLOT_BITS;
+    size_t slot = 0U;
+
+    if (level >= LEVELS)
+    {
+        /* Past a top-level boundary: less than a rotation ahead it still has its own
+           top slot (behind the current one); further out it parks in the one that
+           comes round last and is placed again from there */
+        level = LEVELS - 1U;
+        if (((expiry >> (level * SLOT_BITS)) - (m_now >> (level * SLOT_BITS))) < SLOTS)
+        {
+            slot = static_cast<size_t>(expiry >> (level * SLOT_BITS)) & (SLOTS - 1U);
+        }
+        else
+        {
+            slot = static_cast<size_t>((m_now >> (level * SLOT_BITS)) - 1U) & (SLOTS - 1U);
+        }
+    }
+    else
+    {
+        slot = static_cast<size_t>(expiry >> (level * SLOT_BITS)) & (SLOTS - 1U);
+    }
+
+    link(id, (level * SLOTS) + slot);
+}
+
+/**
+ * @brief Push an id at the head of a slot list
+ */
+void
+TimerWheel::link(uint32_t id, size_t slot)
+{
+    uint32_t head = m_heads[slot];
+
+    m_next[id] = head;
+    m_prev[id] = NONE;
+    if (head != NONE)
+    {
+        m_prev[head] = id;
+    }
+    m_heads[slot] = id;
+    m_slot[id] = static_cast<uint16_t>(slot);
+    m_scheduled++;
+}
+
+/**
+ * @brief Take a linked id out of its slot list
+ */
+void
+TimerWheel::unlink(uint32_t id)
+{
+    uint32_t next = m_next[id];
+    uint32_t prev = m_prev[id];
+
+    if (prev != NONE)
+    {
+        m_next[prev] = next;
+    }
+    else
+    {
+        m_heads[m_slot[id]] = next;
+    }
+    if (next != NONE)
+    {
+        m_prev[next] = prev;
+    }
+
+    m_next[id] = NONE;
+    m_prev[id] = NONE;
+    m_slot[id] = NO_SLOT;
+    m_scheduled--;
+}
+
+/**
+ * @brief Re-place every id of the level's current slot against the new tick
+ */
+void
+TimerWheel::cascade(size_t level)
+{
+    size_t slot = (level * SLOTS) + (static_cast<size_t>(m_now >> (level * SLOT_BITS)) & (SLOTS - 1U));
+
+    while (m_heads[slot] != NONE)
+    {
+        uint32_t id = m_heads[slot];
+
+        unlink(id);
+        place(id);
+    }
+}
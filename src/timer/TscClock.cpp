@@ -0,0 +1,123 @@
+/* SPDX-License-Identifier: MIT License */
+/*******************************************************************************
+ *
+ * This document and its contents are parts of the Agent Team Test project.
+ *
+ * Copyright (C) 2026 Tawan Thintawornkul <tawandawei@gmail.com>
+ *
+ *//*!
+ * @file TscClock.cpp
+ * @ingroup timer
+ * @class TscClock
+ * @brief Time-stamp counter calibration
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "timer/TscClock.hpp"
+
+
+/*******************************************************************************
+ * Constant
+ ******************************************************************************/
+static constexpr uint64_t NSEC_PER_SEC = 1'000'000'000ULL;
+static constexpr uint64_t Q32_ONE      = 1ULL << 32U;
+static constexpr auto CALIBRATION_PERIOD = std::chrono::milliseconds(10);
+
+static constexpr unsigned int CPUID_ADVANCED_POWER_MGMT = 0x80000007U;
+static constexpr unsigned int CPUID_INVARIANT_TSC_BIT   = 1U << 8U;
+
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+bool     TscClock::s_useTsc        = false;
+uint64_t TscClock::s_frequencyHz   = NSEC_PER_SEC;
+uint64_t TscClock::s_nsPerTickQ32  = Q32_ONE;
+uint64_t TscClock::s_ticksPerNsQ32 = Q32_ONE;
+
+
+/*******************************************************************************
+ * Static Function
+ ******************************************************************************/
+
+/**
+ * @brief Whether the TSC ticks at a constant rate across P/C-states
+ */
+static bool
+hasInvariantTsc(void)
+{
+    bool result = false;
+
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax = 0U;
+    unsigned int ebx = 0U;
+    unsigned int ecx = 0U;
+    unsigned int edx = 0U;
+
+    if (__get_cpuid(CPUID_ADVANCED_POWER_MGMT, &eax, &ebx, &ecx, &edx) != 0)
+    {
+        result = ((edx & CPUID_INVARIANT_TSC_BIT) != 0U);
+    }
+#endif
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Function Definition
+ ******************************************************************************/
+
+/**
+ * @brief Measure the TSC frequency against steady_clock
+ *
+ * @return true if the TSC is used for now()
+ */
+bool
+TscClock::calibrate(void)
+{
+    static std::once_flag once;
+
+    std::call_once(once, []()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        if (hasInvariantTsc() == true)
+        {
+            auto wallStart = std::chrono::steady_clock::now();
+            uint64_t tscStart = __rdtsc();
+
+            std::this_thread::sleep_for(CALIBRATION_PERIOD);
+
+            uint64_t tscEnd = __rdtsc();
+            auto wallEnd = std::chrono::steady_clock::now();
+
+            uint64_t ticks = tscEnd - tscStart;
+            uint64_t ns = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - wallStart).count());
+
+            if ((ticks > 0U) && (ns > 0U))
+            {
+                s_frequencyHz   = static_cast<uint64_t>(
+                    (static_cast<unsigned __int128>(ticks) * NSEC_PER_SEC) / ns);
+                s_nsPerTickQ32  = static_cast<uint64_t>(
+                    (static_cast<unsigned __int128>(ns) << 32U) / ticks);
+                s_ticksPerNsQ32 = static_cast<uint64_t>(
+                    (static_cast<unsigned __int128>(ticks) << 32U) / ns);
+                s_useTsc = true;
+            }
+        }
+#endif
+    });
+
+    return s_useTsc;
+}